@@ -1,6 +1,8 @@
 #include "Base/ExampleBase.h"
 
 #include <cassert>
+#include <cstring>
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 
@@ -151,13 +153,20 @@ ExampleBase::ExampleBase(CWindow& aWindow, const char* apApplicationName, uint32
     CreateLogicalDevice();
     GetDeviceQueues();
 
+    mDeviceAllocator = std::make_unique<vkpp::DeviceAllocator>(mLogicalDevice, mPhysicalDeviceMemoryProperties, mPhysicalDeviceProperties.limits);
+
     CreateSwapchain();
 }
 
 
 ExampleBase::~ExampleBase(void)
 {
+    std::cout << "Fences created/reused:\t" << mFencePool.GetCreatedCount() << '/' << mFencePool.GetReusedCount() << std::endl;
+
+    mFencePool.Clear();
+
     mSwapchain.Release();
+    mDeviceAllocator.reset();
 
     mLogicalDevice.Reset();
     mInstance.DestroySurface(mSurface);
@@ -197,13 +206,22 @@ void ExampleBase::CreateInstance(const char* apApplicationName, uint32_t aApplic
         LUNARG_STANDARD_VALIDATION_NAME
     };
 
-    constexpr std::array<const char*, 3> lInstanceExtensions
+    std::vector<const char*> lInstanceExtensions
     {
         KHR_SURFACE_EXT_NAME,
         KHR_OS_SURFACE_EXT_NAME,
         EXT_DEBUG_REPORT_EXT_NAME
     };
 
+    // Optional, lets CreateLogicalDevice query extension features such as descriptor indexing.
+    mPhysicalDeviceProperties2Enabled = std::any_of(lExtensions.cbegin(), lExtensions.cend(), [](const auto& aExtension)
+    {
+        return std::strcmp(aExtension.extensionName, KHR_GET_PHYSICAL_DEVICE_PROPERTIES2_EXT_NAME) == 0;
+    });
+
+    if (mPhysicalDeviceProperties2Enabled)
+        lInstanceExtensions.push_back(KHR_GET_PHYSICAL_DEVICE_PROPERTIES2_EXT_NAME);
+
     const vkpp::InstanceInfo lInstanceInfo
     {
         lApplicationInfo,
@@ -292,6 +310,12 @@ bool ExampleBase::CheckPhysicalDeviceProperties(const vkpp::PhysicalDevice& aPhy
             mGraphicsQueue.familyIndex = lIndex;
             mPresentQueue.familyIndex = lIndex;
 
+            // Uploads go to a dedicated transfer family when available so that streaming overlaps with rendering.
+            mTransferQueue.familyIndex = aPhysicalDevice.GetQueueFamilyIndex(vkpp::QueueFlagBits::eTransfer, vkpp::QueueFlagBits::eGraphics | vkpp::QueueFlagBits::eCompute);
+
+            if (mTransferQueue.familyIndex == UINT32_MAX)
+                mTransferQueue.familyIndex = lIndex;
+
             return true;
         }
     }
@@ -308,11 +332,59 @@ void ExampleBase::CreateLogicalDevice(void)
     std::vector<vkpp::QueueCreateInfo> lQueueCreateInfos;
     lQueueCreateInfos.emplace_back(mGraphicsQueue.familyIndex, lProprities);
 
-    constexpr std::array<const char*, 1> lDeviceExts
+    if (mTransferQueue.familyIndex != mGraphicsQueue.familyIndex)
+        lQueueCreateInfos.emplace_back(mTransferQueue.familyIndex, lProprities);
+
+    std::vector<const char*> lDeviceExts
     {
         KHR_SWAPCHAIN_EXT_NAME
     };
 
+    const auto& lPhysicalDeviceExts = mPhysicalDevice.GetExtensions();
+    const auto lHasDeviceExt = [&lPhysicalDeviceExts](const char* apExtensionName)
+    {
+        return std::any_of(lPhysicalDeviceExts.cbegin(), lPhysicalDeviceExts.cend(), [apExtensionName](const auto& aExtension)
+        {
+            return std::strcmp(aExtension.extensionName, apExtensionName) == 0;
+        });
+    };
+
+    // Optional, lets the samples write a whole descriptor set from one packed block.
+    mDescriptorUpdateTemplateEnabled = lHasDeviceExt(KHR_DESCRIPTOR_UPDATE_TEMPLATE_EXT_NAME);
+
+    if (mDescriptorUpdateTemplateEnabled)
+        lDeviceExts.push_back(KHR_DESCRIPTOR_UPDATE_TEMPLATE_EXT_NAME);
+
+    // Optional, everything vkpp::BindlessTable needs: partially bound, update-after-bind descriptor arrays indexed from push constants.
+    vkpp::ext::PhysicalDeviceDescriptorIndexingFeatures lDescriptorIndexingFeatures;
+
+    if (mPhysicalDeviceProperties2Enabled && lHasDeviceExt(EXT_DESCRIPTOR_INDEXING_EXT_NAME) && lHasDeviceExt(KHR_MAINTENANCE3_EXT_NAME))
+    {
+        vkpp::ext::PhysicalDeviceDescriptorIndexingFeatures lSupportedFeatures;
+        mPhysicalDevice.GetFeatures(mInstance, &lSupportedFeatures);
+
+        mDescriptorIndexingEnabled = mPhysicalDeviceFeatures.shaderSampledImageArrayDynamicIndexing
+            && lSupportedFeatures.runtimeDescriptorArray
+            && lSupportedFeatures.descriptorBindingPartiallyBound
+            && lSupportedFeatures.descriptorBindingUpdateUnusedWhilePending
+            && lSupportedFeatures.descriptorBindingSampledImageUpdateAfterBind
+            && lSupportedFeatures.descriptorBindingStorageBufferUpdateAfterBind;
+    }
+
+    if (mDescriptorIndexingEnabled)
+    {
+        lDeviceExts.push_back(KHR_MAINTENANCE3_EXT_NAME);
+        lDeviceExts.push_back(EXT_DESCRIPTOR_INDEXING_EXT_NAME);
+
+        mEnabledFeatures.shaderSampledImageArrayDynamicIndexing = VK_TRUE;
+
+        lDescriptorIndexingFeatures.runtimeDescriptorArray = VK_TRUE;
+        lDescriptorIndexingFeatures.descriptorBindingPartiallyBound = VK_TRUE;
+        lDescriptorIndexingFeatures.descriptorBindingUpdateUnusedWhilePending = VK_TRUE;
+        lDescriptorIndexingFeatures.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+        lDescriptorIndexingFeatures.descriptorBindingStorageBufferUpdateAfterBind = VK_TRUE;
+    }
+
     mEnabledFeatures.fillModeNonSolid = mPhysicalDeviceFeatures.fillModeNonSolid;
 
     // Wide lines must be present for line width > 1.0f.
@@ -322,13 +394,25 @@ void ExampleBase::CreateLogicalDevice(void)
     mEnabledFeatures.samplerAnisotropy = mPhysicalDeviceFeatures.samplerAnisotropy;
     mEnabledFeatures.shaderClipDistance = mPhysicalDeviceFeatures.shaderClipDistance;
 
-    const vkpp::LogicalDeviceCreateInfo lLogicalDeviceCreateInfo
+    // Pipeline statistics and exact occlusion sample counts for PipelineStatisticsProfiler.
+    mEnabledFeatures.pipelineStatisticsQuery = mPhysicalDeviceFeatures.pipelineStatisticsQuery;
+    mEnabledFeatures.occlusionQueryPrecise = mPhysicalDeviceFeatures.occlusionQueryPrecise;
+    mEnabledFeatures.inheritedQueries = mPhysicalDeviceFeatures.inheritedQueries;
+
+    // Several draws per indirect command, and firstInstance in indirect records, for vkpp::DrawCommandBuffer.
+    mEnabledFeatures.multiDrawIndirect = mPhysicalDeviceFeatures.multiDrawIndirect;
+    mEnabledFeatures.drawIndirectFirstInstance = mPhysicalDeviceFeatures.drawIndirectFirstInstance;
+
+    vkpp::LogicalDeviceCreateInfo lLogicalDeviceCreateInfo
     {
         lQueueCreateInfos,
         lDeviceExts,
         &mEnabledFeatures
     };
 
+    if (mDescriptorIndexingEnabled)
+        lLogicalDeviceCreateInfo.SetNext(&lDescriptorIndexingFeatures);
+
     mLogicalDevice.Reset(mPhysicalDevice, lLogicalDeviceCreateInfo);
 }
 
@@ -337,10 +421,11 @@ void ExampleBase::GetDeviceQueues(void)
 {
     mGraphicsQueue.handle = mLogicalDevice.GetQueue(mGraphicsQueue.familyIndex, 0);
     mPresentQueue.handle = mLogicalDevice.GetQueue(mPresentQueue.familyIndex, 0);
+    mTransferQueue.handle = mLogicalDevice.GetQueue(mTransferQueue.familyIndex, 0);
 }
 
 
-void ExampleBase::CreateSwapchain(const Swapchain& aOldSwapchain)
+void ExampleBase::CreateSwapchain(const Swapchain& aOldSwapchain, vkpp::DeletionQueue* apDeletionQueue)
 {
     const auto& lSurfacePresentModes = mPhysicalDevice.GetSurfacePresentModes(mSurface);
     auto lDesiredPresentMode = GetSwapchainPresentMode(lSurfacePresentModes);
@@ -371,23 +456,37 @@ void ExampleBase::CreateSwapchain(const Swapchain& aOldSwapchain)
     auto lSwapchain = mLogicalDevice.CreateSwapchain(lSwapchainCreateInfo);
 
     // If an existing swapchain is re-created, destroy the old swapchain.
-    // This also cleans up all the presentable images.
-    aOldSwapchain.Release();
+    // This also cleans up all the presentable images. With a deletion queue, frames still in flight may keep presenting from it meanwhile.
+    if (apDeletionQueue != nullptr)
+        aOldSwapchain.Release(*apDeletionQueue);
+    else
+        aOldSwapchain.Release();
 
     mSwapchain.handle = lSwapchain;
     mSwapchain.device = mLogicalDevice;
     mSwapchain.surfaceFormat = lDesiredSurfaceFormat;
     mSwapchain.extent = lDesiredExtent;
 
-    const auto& lImages = mLogicalDevice.GetSwapchainImages(mSwapchain.handle);
-    CreateSwapchainImageViews(lImages);
+    // Runs on every resize, so the images are fetched into inline storage rather than a new vector.
+    vkpp::FixedVector<vkpp::Image, MAX_SWAPCHAIN_IMAGE_COUNT> lImages;
+
+    if (mLogicalDevice.GetSwapchainImages(mSwapchain.handle, lImages) == VK_SUCCESS)
+        CreateSwapchainImageViews(static_cast<uint32_t>(lImages.size()), lImages.data());
+    else
+    {
+        // VK_INCOMPLETE: the implementation created more images than the inline storage holds.
+        const auto& lAllImages = mLogicalDevice.GetSwapchainImages(mSwapchain.handle);
+        CreateSwapchainImageViews(static_cast<uint32_t>(lAllImages.size()), lAllImages.data());
+    }
 }
 
 
-void ExampleBase::CreateSwapchainImageViews(const std::vector<vkpp::Image>& aImages) const
+void ExampleBase::CreateSwapchainImageViews(uint32_t aImageCount, const vkpp::Image* apImages) const
 {
-    for(auto& lImage : aImages)
+    for (uint32_t lIndex = 0; lIndex < aImageCount; ++lIndex)
     {
+        const auto& lImage = apImages[lIndex];
+
         vkpp::ImageViewCreateInfo lImageViewCreateInfo
         {
             lImage, vkpp::ImageViewType::e2D,
@@ -5,6 +5,9 @@
 
 #include <Type/Instance.h>
 #include <Type/LogicalDevice.h>
+#include <Type/FencePool.h>
+#include <Memory/DeviceAllocator.h>
+#include <Memory/DeletionQueue.h>
 
 #ifdef _DEBUG
 #include <Type/DebugReportCallback.h>
@@ -40,43 +43,26 @@ class DeviceResource
 {
 protected:
     const vkpp::LogicalDevice& device;
-    const vkpp::PhysicalDeviceMemoryProperties& physicalMemProperties;
+    vkpp::DeviceAllocator& allocator;
 
 public:
-    DeviceResource(const vkpp::LogicalDevice& aDevice, const vkpp::PhysicalDeviceMemoryProperties& aPhysicalDeviceMemProperties)
-        : device(aDevice), physicalMemProperties(aPhysicalDeviceMemProperties)
+    explicit DeviceResource(vkpp::DeviceAllocator& aAllocator) : device(aAllocator.GetLogicalDevice()), allocator(aAllocator)
     {}
 
     virtual ~DeviceResource(void)
     {}
-
-    // Return the index of the memory type that supports all the property flags (e.g. device local, host visible) requested.
-    uint32_t GetMemoryTypeIndex(uint32_t aMemoryTypeBits, const vkpp::MemoryPropertyFlags& aMemProperties) const
-    {
-        for (uint32_t lIndex = 0; lIndex < physicalMemProperties.memoryTypeCount; ++lIndex)
-        {
-            // memoryTypeBits is a bitmask and contains one bit set for every supported memory type for the resource.
-            // Bit i is set iff the i-th type of the memoryTypes array in the VkPhysicalDeviceMemoryProperties structure is supported for the resource.
-            if (aMemoryTypeBits & (1 << lIndex) &&
-                (physicalMemProperties.memoryTypes[lIndex].propertyFlags & aMemProperties) == aMemProperties)
-                return lIndex;
-        }
-
-        assert(false);
-        return UINT32_MAX;
-    }
 };
 
 
 
+// Memory comes from the sample's DeviceAllocator; host visible memory stays mapped for the lifetime of the allocation.
 struct BufferResource : public DeviceResource
 {
     vkpp::Buffer buffer;
-    vkpp::DeviceMemory memory;
+    vkpp::MemoryAllocation allocation;
     vkpp::BufferView view;
 
-    BufferResource(const vkpp::LogicalDevice& aDevice, const vkpp::PhysicalDeviceMemoryProperties& aPhysicalDeviceMemProperties)
-        : DeviceResource(aDevice, aPhysicalDeviceMemProperties)
+    explicit BufferResource(vkpp::DeviceAllocator& aAllocator) : DeviceResource(aAllocator)
     {}
 
     virtual ~BufferResource(void)
@@ -86,32 +72,44 @@ struct BufferResource : public DeviceResource
 
     void Reset(void)
     {
-        assert(device);
-
         if (view)
         {
             device.DestroyBufferView(view);
             view = nullptr;
         }
 
-        if (memory)
-        {
-            device.FreeMemory(memory);
-            memory = nullptr;
-        }
-
         if (buffer)
         {
             device.DestroyBuffer(buffer);
             buffer = nullptr;
         }
+
+        allocator.Free(allocation);
+    }
+
+    // Same as above, for a buffer the GPU may still be using: the objects are destroyed once the frame being recorded has completed.
+    void Reset(vkpp::DeletionQueue& aDeletionQueue)
+    {
+        aDeletionQueue.Destroy(view);
+        aDeletionQueue.Destroy(buffer);
+
+        if (allocation)
+        {
+            aDeletionQueue.Push([&lAllocator = allocator, lAllocation = allocation](void) mutable
+            {
+                lAllocator.Free(lAllocation);
+            });
+        }
+
+        view = nullptr;
+        buffer = nullptr;
+        allocation = vkpp::MemoryAllocation{};
     }
 
     void Reset(const vkpp::BufferCreateInfo& aBufferCreateInfo, const vkpp::MemoryPropertyFlags& aMemProperties)
     {
         buffer = device.CreateBuffer(aBufferCreateInfo);
-        memory = AllocateBufferMemory(aMemProperties);
-        device.BindBufferMemory(buffer, memory);
+        allocation = allocator.AllocateBufferMemory(buffer, aMemProperties);
     }
 
     void Reset(const vkpp::BufferCreateInfo& aBufferCreateInfo, vkpp::BufferViewCreateInfo& aBufferViewCreateInfo, const vkpp::MemoryPropertyFlags& aMemProperties)
@@ -125,30 +123,12 @@ struct BufferResource : public DeviceResource
     template <typename T>
     T* Map(void) const
     {
-        return static_cast<T*>(device.MapMemory(memory));
+        return allocation.Map<T>();
     }
 
-    void* Map(void) const
+    void* Map(vkpp::DeviceSize aOffset = 0) const
     {
-        return Map<void>();
-    }
-
-    void Unmap(void) const
-    {
-        device.UnmapMemory(memory);
-    }
-
-    vkpp::DeviceMemory AllocateBufferMemory(const vkpp::MemoryPropertyFlags& aMemProperties) const
-    {
-        const auto& lBufferMemRequirements = device.GetBufferMemoryRequirements(buffer);
-
-        const MemoryAllocateInfo lMemoryAllocateInfo
-        {
-            lBufferMemRequirements.size,
-            GetMemoryTypeIndex(lBufferMemRequirements.memoryTypeBits, aMemProperties)
-        };
-
-        return device.AllocateMemory(lMemoryAllocateInfo);
+        return Map<char>() + aOffset;
     }
 };
 
@@ -157,12 +137,11 @@ struct BufferResource : public DeviceResource
 struct ImageResource : public DeviceResource
 {
     vkpp::Image image;
-    vkpp::DeviceMemory memory;
+    vkpp::MemoryAllocation allocation;
     vkpp::ImageView view;
     vkpp::DeviceSize memSize{ 0 };
 
-    ImageResource(const vkpp::LogicalDevice& aDevice, const vkpp::PhysicalDeviceMemoryProperties& aPhysicalDeviceMemProperties)
-        : DeviceResource(aDevice, aPhysicalDeviceMemProperties)
+    explicit ImageResource(vkpp::DeviceAllocator& aAllocator) : DeviceResource(aAllocator)
     {}
 
     virtual ~ImageResource(void)
@@ -172,49 +151,48 @@ struct ImageResource : public DeviceResource
 
     void Reset(void)
     {
-        assert(device);
-
         if (view)
         {
             device.DestroyImageView(view);
             view = nullptr;
         }
 
-        if (memory)
-        {
-            device.FreeMemory(memory);
-            memory = nullptr;
-        }
-
         if (image)
         {
             device.DestroyImage(image);
             image = nullptr;
         }
+
+        allocator.Free(allocation);
     }
 
-    void Reset(const vkpp::ImageCreateInfo& aImageCreateInfo, vkpp::ImageViewCreateInfo& aImageViewCreateInfo, const vkpp::MemoryPropertyFlags& aMemProperties)
+    // Same as above, for an image the GPU may still be using: the objects are destroyed once the frame being recorded has completed.
+    void Reset(vkpp::DeletionQueue& aDeletionQueue)
     {
-        image = device.CreateImage(aImageCreateInfo);
-        memory = AllocateImageMemory(aMemProperties);
-        device.BindImageMemory(image, memory);
+        aDeletionQueue.Destroy(view);
+        aDeletionQueue.Destroy(image);
 
-        aImageViewCreateInfo.SetImage(image);
-        view = device.CreateImageView(aImageViewCreateInfo);
+        if (allocation)
+        {
+            aDeletionQueue.Push([&lAllocator = allocator, lAllocation = allocation](void) mutable
+            {
+                lAllocator.Free(lAllocation);
+            });
+        }
+
+        view = nullptr;
+        image = nullptr;
+        allocation = vkpp::MemoryAllocation{};
     }
 
-    vkpp::DeviceMemory AllocateImageMemory(const vkpp::MemoryPropertyFlags& aMemoryProperties)
+    void Reset(const vkpp::ImageCreateInfo& aImageCreateInfo, vkpp::ImageViewCreateInfo& aImageViewCreateInfo, const vkpp::MemoryPropertyFlags& aMemProperties)
     {
-        const auto &lImageRequirements = device.GetImageMemoryRequirements(image);
-        memSize = lImageRequirements.size;
-
-        const vkpp::MemoryAllocateInfo lMemAllocateInfo
-        {
-            memSize,
-            GetMemoryTypeIndex(lImageRequirements.memoryTypeBits, aMemoryProperties)
-        };
+        image = device.CreateImage(aImageCreateInfo);
+        allocation = allocator.AllocateImageMemory(image, aMemProperties, aImageCreateInfo.tiling);
+        memSize = allocation.size;
 
-        return device.AllocateMemory(lMemAllocateInfo);
+        aImageViewCreateInfo.SetImage(image);
+        view = device.CreateImageView(aImageViewCreateInfo);
     }
 };
 
@@ -248,6 +226,19 @@ struct Swapchain
         buffers.clear();
         device.DestroySwapchain(handle);
     }
+
+    // Retire a replaced swapchain once the frames that may still present from it have completed.
+    void Release(vkpp::DeletionQueue& aDeletionQueue) const
+    {
+        if (!handle)
+            return;
+
+        for (auto& lImageView : buffers)
+            aDeletionQueue.Destroy(lImageView.view);
+
+        buffers.clear();
+        aDeletionQueue.Destroy(handle);
+    }
 };
 
 
@@ -259,9 +250,14 @@ class CWindow;
 class ExampleBase
 {
 protected:
+    static constexpr std::size_t MAX_SWAPCHAIN_IMAGE_COUNT = 8;
+
     CWindow& mWindow;
     vkpp::Instance mInstance;
+    bool mPhysicalDeviceProperties2Enabled{ false }; // VK_KHR_get_physical_device_properties2
     vkpp::PhysicalDeviceFeatures mEnabledFeatures{};
+    bool mDescriptorUpdateTemplateEnabled{ false };  // VK_KHR_descriptor_update_template
+    bool mDescriptorIndexingEnabled{ false };        // VK_EXT_descriptor_indexing with the features vkpp::BindlessTable needs.
 
 #ifdef _DEBUG
     vkpp::ext::DebugReportCallback mDebugReportCallback;
@@ -271,9 +267,16 @@ protected:
     vkpp::PhysicalDevice mPhysicalDevice;
     DeviceQueue mGraphicsQueue;
     DeviceQueue mPresentQueue;
+    DeviceQueue mTransferQueue;                     // Transfer-only family if the device has one, otherwise the graphics queue.
     vkpp::LogicalDevice mLogicalDevice;
     Swapchain mSwapchain;
 
+    // Shared by the one-shot submissions so that they stop creating and destroying a fence each.
+    mutable vkpp::FencePool mFencePool{ mLogicalDevice };
+
+    // Backs every BufferResource and ImageResource, so that they suballocate from a few large blocks instead of one vkAllocateMemory each.
+    std::unique_ptr<vkpp::DeviceAllocator> mDeviceAllocator;
+
     vkpp::PhysicalDeviceProperties mPhysicalDeviceProperties;
     vkpp::PhysicalDeviceFeatures mPhysicalDeviceFeatures;
     vkpp::PhysicalDeviceMemoryProperties mPhysicalDeviceMemoryProperties;
@@ -285,8 +288,8 @@ protected:
     void PickPhysicalDevice(void);
     void CreateLogicalDevice(void);
     void GetDeviceQueues(void);
-    void CreateSwapchain(const Swapchain& aOldSwapchain = nullptr);
-    void CreateSwapchainImageViews(const std::vector<vkpp::Image>& aImages) const;
+    void CreateSwapchain(const Swapchain& aOldSwapchain = nullptr, vkpp::DeletionQueue* apDeletionQueue = nullptr);
+    void CreateSwapchainImageViews(uint32_t aImageCount, const vkpp::Image* apImages) const;
 
     vkpp::ShaderModule CreateShaderModule(const std::string& aFilename) const;
 
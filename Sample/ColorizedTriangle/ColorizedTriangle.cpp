@@ -10,10 +10,10 @@ namespace vkpp::sample
 
 ColorizedTriangle::ColorizedTriangle(CWindow& aWindow, const char* apApplicationName, uint32_t aApplicationVersion, const char* apEngineName, uint32_t aEngineVersion)
     : ExampleBase(aWindow, apApplicationName, aApplicationVersion, apEngineName, aEngineVersion), CWindowEvent(aWindow),
-      mDepthResources(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mVertexBufferResource(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mIndexBufferResource(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mUniformBufferResource(mLogicalDevice, mPhysicalDeviceMemoryProperties)
+      mDepthResources(*mDeviceAllocator),
+      mVertexBufferResource(*mDeviceAllocator),
+      mIndexBufferResource(*mDeviceAllocator),
+      mUniformBufferResource(*mDeviceAllocator)
 {
     mResizedFunc = [this](Sint32 /*aWidth*/, Sint32 /*aHeight*/)
     {
@@ -85,7 +85,8 @@ ColorizedTriangle::~ColorizedTriangle(void)
     for (auto& lFramebuffer : mFramebuffers)
         mLogicalDevice.DestroyFramebuffer(lFramebuffer);
 
-    mLogicalDevice.DestroyPipelineCache(mPipelineCache);
+    // Writes the compiled pipelines back for the next run.
+    mPipelineCacheStore.reset();
     mLogicalDevice.DestroyRenderPass(mRenderPass);
 
     for (auto& lFence : mWaitFences)
@@ -247,8 +248,7 @@ void ColorizedTriangle::CreateRenderPass(void)
 
 void ColorizedTriangle::CreatePipelineCache(void)
 {
-    const vkpp::PipelineCacheCreateInfo lPipelineCacheCreateInfo;
-    mPipelineCache = mLogicalDevice.CreatePipelineCache(lPipelineCacheCreateInfo);
+    mPipelineCacheStore = std::make_unique<vkpp::PipelineCacheStore>(mLogicalDevice, mPhysicalDeviceProperties, "ColorizedTriangle.cache");
 }
 
 
@@ -385,7 +385,7 @@ void ColorizedTriangle::CreateGraphicsPipeline(void)
         0
     };
 
-    mGraphicsPipeline = mLogicalDevice.CreateGraphicsPipeline(lGraphicsPipelineCreateInfo);
+    mGraphicsPipeline = mLogicalDevice.CreateGraphicsPipeline(lGraphicsPipelineCreateInfo, mPipelineCacheStore->GetPipelineCache());
 
     mLogicalDevice.DestroyShaderModule(lFragmentShaderModule);
     mLogicalDevice.DestroyShaderModule(lVertexShaderModule);
@@ -545,13 +545,12 @@ void ColorizedTriangle::CreateVertexBuffer(void)
 
     mVertexBufferResource.Reset(lBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eDeviceLocal);
 
-    BufferResource lStagingResource{ mLogicalDevice, mPhysicalDeviceMemoryProperties };
+    BufferResource lStagingResource{ *mDeviceAllocator };
     lBufferCreateInfo.SetUsage(vkpp::BufferUsageFlagBits::eTransferSrc);
     lStagingResource.Reset(lBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
 
-    auto lMappedMemory = mLogicalDevice.MapMemory(lStagingResource.memory, 0, lVertexDataSize);
+    auto lMappedMemory = lStagingResource.Map();
     std::memcpy(lMappedMemory, lVertexData.data(), lVertexDataSize);
-    mLogicalDevice.UnmapMemory(lStagingResource.memory);
 
     CopyBuffer(lVertexDataSize, lStagingResource.buffer, mVertexBufferResource.buffer);
 }
@@ -571,13 +570,12 @@ void ColorizedTriangle::CreateIndexBuffer(void)
 
     mIndexBufferResource.Reset(lBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eDeviceLocal);
 
-    BufferResource lStagingResource{ mLogicalDevice, mPhysicalDeviceMemoryProperties };
+    BufferResource lStagingResource{ *mDeviceAllocator };
     lBufferCreateInfo.SetUsage(vkpp::BufferUsageFlagBits::eTransferSrc);
     lStagingResource.Reset(lBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
 
-    auto lMappedMemory = mLogicalDevice.MapMemory(lStagingResource.memory, 0, lIndexDataSize);
+    auto lMappedMemory = lStagingResource.Map();
     std::memcpy(lMappedMemory, lIndexData.data(), lIndexDataSize);
-    mLogicalDevice.UnmapMemory(lStagingResource.memory);
 
     CopyBuffer(lIndexDataSize, lStagingResource.buffer, mIndexBufferResource.buffer);
 }
@@ -617,11 +615,10 @@ void ColorizedTriangle::CopyBuffer(DeviceSize aSize, const vkpp::Buffer& aSrcBuf
 
 void ColorizedTriangle::UpdateUniformBuffer(void) const
 {
-    auto lMappedMemory = mLogicalDevice.MapMemory(mUniformBufferResource.memory, 0, sizeof(UniformBufferObject));
+    auto lMappedMemory = mUniformBufferResource.Map();
     std::memcpy(lMappedMemory, &mMVPMatrix, sizeof(UniformBufferObject));
 
     // Note: Since we requested a host coherent memory for the uniform buffer, the write is instantly visible to the GPU.
-    mLogicalDevice.UnmapMemory(mUniformBufferResource.memory);
 }
 
 
@@ -656,15 +653,12 @@ void ColorizedTriangle::EndOneTimeCommandBuffer(const vkpp::CommandBuffer& aCmdB
     };
 
     // Create fence to ensure that the command buffer has finished executing.
-    constexpr vkpp::FenceCreateInfo lFenceCreateInfo;
-    const auto& lFence = mLogicalDevice.CreateFence(lFenceCreateInfo);
+    const auto lFence = mFencePool.Acquire();
 
     mGraphicsQueue.handle.Submit(lSubmitInfo, lFence);
 
     // Wait for the fence to signal that command buffer has finished executing.
-    mLogicalDevice.WaitForFence(lFence);
-
-    mLogicalDevice.DestroyFence(lFence);
+    mFencePool.WaitAndRecycle(lFence);
     mLogicalDevice.FreeCommandBuffer(mCommandPool, aCmdBuffer);
 }
 
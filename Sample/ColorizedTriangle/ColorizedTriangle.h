@@ -3,6 +3,8 @@
 
 
 
+#include <memory>
+
 #include <Info/PipelineStage.h>
 
 #define GLM_FORCE_RADIANS
@@ -11,6 +13,7 @@
 
 #include "Base/ExampleBase.h"
 #include "Window/WindowEvent.h"
+#include "Type/PipelineCacheStore.h"
 
 
 
@@ -87,7 +90,7 @@ private:
     vkpp::Semaphore mRenderCompleteSemaphore;
     std::vector<vkpp::Fence> mWaitFences;
     vkpp::RenderPass mRenderPass;
-    vkpp::PipelineCache mPipelineCache;
+    std::unique_ptr<vkpp::PipelineCacheStore> mPipelineCacheStore;
     std::vector<vkpp::Framebuffer> mFramebuffers;
     vkpp::DescriptorSetLayout mSetLayout;
     vkpp::PipelineLayout mPipelineLayout;
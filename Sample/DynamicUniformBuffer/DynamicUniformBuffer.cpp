@@ -10,41 +10,16 @@ namespace vkpp::sample
 
 
 
-// Wrapper functions for aligned memory allocation.
-// C++17 added a standard cross-platform function, namely std::aligned_alloc, to do this, but it is not supported in VS2017.
-void* AlignedAlloc(std::size_t aAlignment, std::size_t aSize)
-{
-#ifdef _WIN32
-    return _aligned_malloc(aSize, aAlignment);
-#else
-    static_assert(false);
-#endif
-}
-
-
-void AlignedFree(void* apData)
-{
-#ifdef _WIN32
-    _aligned_free(apData);
-#else
-    static_assert(false);
-#endif
-}
-
-
-
 DynamicUniformBuffer::DynamicUniformBuffer(CWindow& aWindow, const char* apAppName, uint32_t aAppVersion, const char* apEngineName, uint32_t aEngineVersion)
     : ExampleBase(aWindow, apAppName, aAppVersion, apEngineName, aEngineVersion),
       CWindowEvent(aWindow), CMouseMotionEvent(aWindow), CMouseWheelEvent(aWindow),
-      mDepthRes(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mVtxBufferRes(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mIdxBufferRes(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mUBORes(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mDynamicRes(mLogicalDevice, mPhysicalDeviceMemoryProperties)
+      mDepthRes(*mDeviceAllocator),
+      mVtxBufferRes(*mDeviceAllocator),
+      mIdxBufferRes(*mDeviceAllocator),
+      mUBORes(*mDeviceAllocator)
 {
     theApp.RegisterUpdateEvent([this](void)
     {
-        UpdateDynamicUniformBuffer();
         Update();
     });
 
@@ -67,31 +42,24 @@ DynamicUniformBuffer::DynamicUniformBuffer(CWindow& aWindow, const char* apAppNa
 
     mResizedFunc = [this](Sint32 /*aWidth*/, Sint32 /*aHeight*/)
     {
-        // Ensure all operations on the device have been finished before destroying resources.
-        mLogicalDevice.Wait();
+        // The frames in flight may still use the replaced objects, so they are retired through the deletion queue instead of idling the device.
 
         // Re-create swapchain.
-        CreateSwapchain(mSwapchain);
+        CreateSwapchain(mSwapchain, &mDeletionQueue);
 
-        mDepthRes.Reset();
+        mDepthRes.Reset(mDeletionQueue);
         CreateDepthResource();
 
         // Re-create framebuffers.
         for (auto& lFramebuffer : mFramebuffers)
-            mLogicalDevice.DestroyFramebuffer(lFramebuffer);
+            mDeletionQueue.Destroy(lFramebuffer);
 
         mFramebuffers.clear();
         CreateFramebuffers();
 
-        // Command buffers need to be recreated as they reference to the destroyed framebuffer.
-        mLogicalDevice.FreeCommandBuffers(mCmdPool, mDrawCmdBuffers);
-        AllocateCmdBuffers();
-        BuildCmdBuffers();
+        // Command buffers are re-recorded every frame, so there is nothing to rebuild here.
     };
 
-    CreateCmdPool();
-    AllocateCmdBuffers();
-
     CreateRenderPass();
     CreateDepthResource();
     CreateFramebuffers();
@@ -108,14 +76,10 @@ DynamicUniformBuffer::DynamicUniformBuffer(CWindow& aWindow, const char* apAppNa
     CreateIndexBuffer();
     CreateUniformBuffer();
     UpdateUniformBuffer();
-    UpdateDynamicUniformBuffer();
 
     UpdateDescriptorSets();
 
-    BuildCmdBuffers();
-
-    CreateSemaphores();
-    CreateFences();
+    CreateFrameRing();
 }
 
 
@@ -123,17 +87,13 @@ DynamicUniformBuffer::~DynamicUniformBuffer(void)
 {
     mLogicalDevice.Wait();
 
-    AlignedFree(mpUBODataDynamic);
-
-    mLogicalDevice.DestroySemaphore(mRenderingCompleteSemaphore);
-    mLogicalDevice.DestroySemaphore(mPresentCompleteSemaphore);
-
-    mLogicalDevice.DestroyFences(mWaitFences);
+    // Run what resizes left queued, and the pipeline's deferred destruction, while the fences of the frames they wait on still exist.
+    mGraphicsPipeline.Reset();
+    mDeletionQueue.Flush();
 
-    mLogicalDevice.UnmapMemory(mUBORes.memory);
-    mLogicalDevice.UnmapMemory(mDynamicRes.memory);
+    mFrameRing.reset();
 
-    mDynamicRes.Reset();
+    mDynamicRing.reset();
     mUBORes.Reset();
 
     mIdxBufferRes.Reset();
@@ -141,41 +101,12 @@ DynamicUniformBuffer::~DynamicUniformBuffer(void)
 
     mLogicalDevice.DestroyDescriptorPool(mDescriptorPool);
 
-    mLogicalDevice.DestroyPipeline(mGraphicsPipeline);
-
     mLogicalDevice.DestroyPipelineLayout(mPipelineLayout);
     mLogicalDevice.DestroyDescriptorSetLayout(mSetLayout);
 
     mLogicalDevice.DestroyFramebuffers(mFramebuffers);
     mDepthRes.Reset();
     mLogicalDevice.DestroyRenderPass(mRenderPass);
-
-    mLogicalDevice.FreeCommandBuffers(mCmdPool, mDrawCmdBuffers);
-    mLogicalDevice.DestroyCommandPool(mCmdPool);
-}
-
-
-void DynamicUniformBuffer::CreateCmdPool(void)
-{
-    const vkpp::CommandPoolCreateInfo lCmdCreateInfo
-    {
-        mGraphicsQueue.familyIndex,
-        vkpp::CommandPoolCreateFlagBits::eResetCommandBuffer
-    };
-
-    mCmdPool = mLogicalDevice.CreateCommandPool(lCmdCreateInfo);
-}
-
-
-void DynamicUniformBuffer::AllocateCmdBuffers(void)
-{
-    const vkpp::CommandBufferAllocateInfo lCmdAllocateInfo
-    {
-        mCmdPool,
-        static_cast<uint32_t>(mSwapchain.buffers.size())            // Create one command buffer for each swap-chain image and reuse for rendering.
-    };
-
-    mDrawCmdBuffers = mLogicalDevice.AllocateCommandBuffers(lCmdAllocateInfo);
 }
 
 
@@ -407,7 +338,8 @@ void DynamicUniformBuffer::CreateGraphicsPipeline(void)
         0
     };
 
-    mGraphicsPipeline = mLogicalDevice.CreateGraphicsPipeline(lGraphicsPipelineCreateInfo);
+    const VkPipeline lGraphicsPipeline = mLogicalDevice.CreateGraphicsPipeline(lGraphicsPipelineCreateInfo);
+    mGraphicsPipeline = decltype(mGraphicsPipeline){ lGraphicsPipeline, mDeletionQueue, static_cast<VkDevice>(mLogicalDevice), VKPP_DEVICE_PROC(vkDestroyPipeline) };
 
     mLogicalDevice.DestroyShaderModule(lFragmentShaderModule);
     mLogicalDevice.DestroyShaderModule(lVertexShaderModule);
@@ -467,9 +399,8 @@ void DynamicUniformBuffer::CreateVertexBuffer(void)
 
     mVtxBufferRes.Reset(lBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
 
-    auto lpMappedMem = mLogicalDevice.MapMemory(mVtxBufferRes.memory, 0, lVtxDataSize);
+    auto lpMappedMem = mVtxBufferRes.Map();
     std::memcpy(lpMappedMem, lVertices.data(), lVtxDataSize);
-    mLogicalDevice.UnmapMemory(mVtxBufferRes.memory);
 }
 
 
@@ -491,24 +422,18 @@ void DynamicUniformBuffer::CreateIndexBuffer(void)
 
     mIdxBufferRes.Reset(lBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
 
-    auto lpMappedMem = mLogicalDevice.MapMemory(mIdxBufferRes.memory, 0, lIdxDataSize);
+    auto lpMappedMem = mIdxBufferRes.Map();
     std::memcpy(lpMappedMem, lIndices.data(), lIdxDataSize);
-    mLogicalDevice.UnmapMemory(mIdxBufferRes.memory);
 }
 
 
 void DynamicUniformBuffer::CreateUniformBuffer(void)
 {
-    // Allocate data for the dynamic uniform buffer object.
-    // We allocate this manually as the alignment of the offset differs between GPUs.
-
     // Calculate required alignment depending on device limits.
-    const auto lUBOAlignment = mPhysicalDeviceProperties.limits.minUniformBufferOffsetAlignment;
-    mDynamicAlignment = sizeof(glm::mat4) / lUBOAlignment * lUBOAlignment + sizeof(glm::mat4) % lUBOAlignment > 0 ? lUBOAlignment : 0;
+    const auto lUBOAlignment = vkpp::RingBuffer::GetUniformAlignment(mPhysicalDeviceProperties.limits);
+    mDynamicAlignment = static_cast<std::size_t>(vkpp::AlignUp(sizeof(glm::mat4), lUBOAlignment));
 
     mDynamicBufferSize = OBJECT_INSTANCES * mDynamicAlignment;
-    mpUBODataDynamic = static_cast<glm::mat4*>(AlignedAlloc(mDynamicAlignment, mDynamicBufferSize));
-    assert(mpUBODataDynamic != nullptr);
 
     // Vertex shader uniform buffer lock.
 
@@ -520,16 +445,10 @@ void DynamicUniformBuffer::CreateUniformBuffer(void)
 
     mUBORes.Reset(lStaticBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
 
-    // Uniform buffer object with per-object matrices.
-    const vkpp::BufferCreateInfo lDynamicBufferCreateInfo
-    {
-        static_cast<uint32_t>(mDynamicBufferSize), vkpp::BufferUsageFlagBits::eUniformBuffer
-    };
-
-    mDynamicRes.Reset(lDynamicBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible);
+    // Ring of per-object matrices, large enough for every frame in flight plus the one being written.
+    mDynamicRing = std::make_unique<vkpp::RingBuffer>(*mDeviceAllocator, (FRAMES_IN_FLIGHT + 1) * mDynamicBufferSize, vkpp::BufferUsageFlagBits::eUniformBuffer, lUBOAlignment);
 
-    mpMatrixUBOMapped = mLogicalDevice.MapMemory(mUBORes.memory, 0, sizeof(UniformBufferObject));
-    mpDynamicUBOMapped = mLogicalDevice.MapMemory(mDynamicRes.memory, 0, mDynamicBufferSize);
+    mpMatrixUBOMapped = mUBORes.Map();
 
     // Prepare per-object matrices with offsets and random rotations.
     std::random_device lRndDev;
@@ -544,21 +463,10 @@ void DynamicUniformBuffer::CreateUniformBuffer(void)
 }
 
 
-void DynamicUniformBuffer::CreateSemaphores(void)
+void DynamicUniformBuffer::CreateFrameRing(void)
 {
-    constexpr vkpp::SemaphoreCreateInfo lSemaphoreCreateInfo;
-
-    mPresentCompleteSemaphore = mLogicalDevice.CreateSemaphore(lSemaphoreCreateInfo);
-    mRenderingCompleteSemaphore = mLogicalDevice.CreateSemaphore(lSemaphoreCreateInfo);
-}
-
-
-void DynamicUniformBuffer::CreateFences(void)
-{
-    constexpr vkpp::FenceCreateInfo lFenceCreateInfo{ vkpp::FenceCreateFlagBits::eSignaled };
-
-    for (std::size_t lIndex = 0; lIndex < mDrawCmdBuffers.size(); ++lIndex)
-        mWaitFences.emplace_back(mLogicalDevice.CreateFence(lFenceCreateInfo));
+    // Matrices written for a frame are recycled together with its command pool once its fence is signaled.
+    mFrameRing = std::make_unique<vkpp::FrameContextRing>(mLogicalDevice, mGraphicsQueue.familyIndex, FRAMES_IN_FLIGHT, mDynamicRing.get(), &mDeletionQueue);
 }
 
 
@@ -581,9 +489,13 @@ void DynamicUniformBuffer::UpdateUniformBuffer(void)
 }
 
 
-void DynamicUniformBuffer::UpdateDynamicUniformBuffer(void)
+vkpp::RingAllocation DynamicUniformBuffer::UpdateDynamicUniformBuffer(void)
 {
     // Dynamic ubo with per-object model matrices indexed by offsets in command buffer.
+    // The matrices are written in place into this frame's range of the mapped ring.
+    const auto& lAllocation = mDynamicRing->Allocate(mDynamicBufferSize);
+    auto lpUBODataDynamic = lAllocation.Map<char>();
+
     auto lDim = static_cast<uint32_t>(pow(OBJECT_INSTANCES, (1.0f / 3.0f)));
     glm::vec3 lOffset(5.0f);
 
@@ -599,7 +511,7 @@ void DynamicUniformBuffer::UpdateDynamicUniformBuffer(void)
                 uint32_t lIndex = x * lDim * lDim + y * lDim + z;
 
                 // Aligned offset
-                glm::mat4* lModelMat = (glm::mat4*)(((uint64_t)mpUBODataDynamic + (lIndex * mDynamicAlignment)));
+                auto lModelMat = reinterpret_cast<glm::mat4*>(lpUBODataDynamic + lIndex * mDynamicAlignment);
 
                 // Update rotations
                 mRotations[lIndex] += lAnimationTimer * mRotationSpeeds[lIndex];
@@ -616,16 +528,14 @@ void DynamicUniformBuffer::UpdateDynamicUniformBuffer(void)
 
     lAnimationTimer = 0.0f;
 
-    std::memcpy(mpDynamicUBOMapped, mpUBODataDynamic, mDynamicBufferSize);
-
-    // Flush to make changes visible to the device.
-    mLogicalDevice.FlushMappedMemoryRange({ mDynamicRes.memory, 0, mDynamicBufferSize });
+    // The ring flushes the whole frame at once in EndFrame.
+    return lAllocation;
 }
 
 
-void DynamicUniformBuffer::BuildCmdBuffers(void)
+void DynamicUniformBuffer::BuildCmdBuffer(const vkpp::CommandBuffer& aDrawCmdBuffer, std::size_t aIndex, const vkpp::RingAllocation& aDynamicAllocation)
 {
-    constexpr vkpp::CommandBufferBeginInfo lCmdBufferBeginInfo;
+    constexpr vkpp::CommandBufferBeginInfo lCmdBufferBeginInfo{ vkpp::CommandBufferUsageFlagBits::eOneTimeSubmit };
 
     constexpr vkpp::ClearValue lClearValues[]
     {
@@ -633,91 +543,89 @@ void DynamicUniformBuffer::BuildCmdBuffers(void)
         { 0.129411f, 0.156862f, 0.188235f, 1.0f }
     };
 
-    for (std::size_t lIndex = 0; lIndex < mDrawCmdBuffers.size(); ++lIndex)
+    const vkpp::RenderPassBeginInfo lRenderPassBeginInfo
     {
-        const vkpp::RenderPassBeginInfo lRenderPassBeginInfo
+        mRenderPass,
+        mFramebuffers[aIndex],
         {
-            mRenderPass,
-            mFramebuffers[lIndex],
-            {
-                { 0, 0 },
-                mSwapchain.extent
-            },
-            2, lClearValues
-        };
+            { 0, 0 },
+            mSwapchain.extent
+        },
+        2, lClearValues
+    };
 
-        const auto& lDrawCmdBuffer = mDrawCmdBuffers[lIndex];
+    aDrawCmdBuffer.Begin(lCmdBufferBeginInfo);
 
-        lDrawCmdBuffer.Begin(lCmdBufferBeginInfo);
+    // The draws are recorded into secondary command buffers by the worker threads.
+    aDrawCmdBuffer.BeginRenderPass(lRenderPassBeginInfo, vkpp::SubpassContents::eSecondaryCommandBuffers);
 
-        lDrawCmdBuffer.BeginRenderPass(lRenderPassBeginInfo);
-        lDrawCmdBuffer.BindVertexBuffer(mVtxBufferRes.buffer, 0);
-        lDrawCmdBuffer.BindIndexBuffer(mIdxBufferRes.buffer, 0, vkpp::IndexType::eUInt32);
+    const vkpp::CommandBufferInheritanceInfo lInheritanceInfo
+    {
+        mRenderPass, 0,
+        mFramebuffers[aIndex],
+        vkpp::OcclusionQuery::Disable
+    };
 
-        const vkpp::Viewport lViewport
-        {
-            0.0f, 0.0f,
-            static_cast<float>(mSwapchain.extent.width), static_cast<float>(mSwapchain.extent.height)
-        };
+    const vkpp::Viewport lViewport
+    {
+        0.0f, 0.0f,
+        static_cast<float>(mSwapchain.extent.width), static_cast<float>(mSwapchain.extent.height)
+    };
 
-        lDrawCmdBuffer.SetViewport(lViewport);
+    const vkpp::Rect2D lScissor
+    {
+        { 0, 0 },
+        mSwapchain.extent
+    };
 
-        const vkpp::Rect2D lScissor
-        {
-            { 0, 0 },
-            mSwapchain.extent
-        };
+    // Split the objects into contiguous ranges, a few per worker so that a slow thread does not hold up the whole frame.
+    const auto lJobCount = std::min<uint32_t>(mCmdRecorder.GetThreadCount() * 4, OBJECT_INSTANCES);
+
+    mCmdRecorder.Record(aDrawCmdBuffer, lInheritanceInfo, lJobCount, [&](const vkpp::CommandBuffer& aSecondaryCmdBuffer, uint32_t aJobIndex)
+    {
+        const auto lGraphicsPipeline = mGraphicsPipeline;
 
-        lDrawCmdBuffer.SetScissor(lScissor);
+        // Secondary command buffers do not inherit any state from the primary one.
+        aSecondaryCmdBuffer.BindVertexBuffer(mVtxBufferRes.buffer, 0);
+        aSecondaryCmdBuffer.BindIndexBuffer(mIdxBufferRes.buffer, 0, vkpp::IndexType::eUInt32);
+        aSecondaryCmdBuffer.SetViewport(lViewport);
+        aSecondaryCmdBuffer.SetScissor(lScissor);
+        aSecondaryCmdBuffer.BindGraphicsPipeline(vkpp::Pipeline{ lGraphicsPipeline.Get() });
 
-        lDrawCmdBuffer.BindGraphicsPipeline(mGraphicsPipeline);
+        const auto lFirstObject = aJobIndex * OBJECT_INSTANCES / lJobCount;
+        const auto lLastObject = (aJobIndex + 1) * OBJECT_INSTANCES / lJobCount;
 
         // Render multiple objects using different mode matrices into the ubo containing all mode matrices.
-        for (uint32_t lIdx = 0; lIdx < OBJECT_INSTANCES; ++lIdx)
+        for (auto lIdx = lFirstObject; lIdx < lLastObject; ++lIdx)
         {
-            // One dynamic offset per dynamic descriptor to offset into the ubo containing all model matrices.
-            auto lDynamicOffset = lIdx * static_cast<uint32_t>(mDynamicAlignment);
+            // One dynamic offset per dynamic descriptor to offset into this frame's range of the ring.
+            auto lDynamicOffset = aDynamicAllocation.DynamicOffset() + lIdx * static_cast<uint32_t>(mDynamicAlignment);
 
             // Bind the descriptor set for rendering a mesh using the dynamic offset.
-            lDrawCmdBuffer.BindGraphicsDescriptorSet(mPipelineLayout, 0, mDescriptorSet, lDynamicOffset);
+            aSecondaryCmdBuffer.BindGraphicsDescriptorSet(mPipelineLayout, 0, mDescriptorSet, lDynamicOffset);
 
-            lDrawCmdBuffer.DrawIndexed(mIndexCount);
+            aSecondaryCmdBuffer.DrawIndexed(mIndexCount);
         }
+    });
 
-        lDrawCmdBuffer.EndRenderPass();
+    aDrawCmdBuffer.EndRenderPass();
 
-        lDrawCmdBuffer.End();
-    }
+    aDrawCmdBuffer.End();
 }
 
 
 void DynamicUniformBuffer::Update()
 {
-    auto lIndex = mLogicalDevice.AcquireNextImage(mSwapchain.handle, mPresentCompleteSemaphore);
-
-    mLogicalDevice.WaitForFence(mWaitFences[lIndex]);
-    mLogicalDevice.ResetFence(mWaitFences[lIndex]);
-
-    constexpr vkpp::PipelineStageFlags lWaitDstStageMask{ vkpp::PipelineStageFlagBits::eColorAttachmentOutput };
+    // Only blocks on the frame submitted FRAMES_IN_FLIGHT frames ago; its command pool and ring range are recycled here.
+    const auto& lFrame = mFrameRing->BeginFrame(mSwapchain.handle);
+    mCmdRecorder.BeginFrame(mFrameRing->GetFrameIndex());
 
-    const vkpp::SubmitInfo lSubmitInfo
-    {
-        1, mPresentCompleteSemaphore.AddressOf(),
-        &lWaitDstStageMask,
-        1, mDrawCmdBuffers[lIndex].AddressOf(),
-        1, mRenderingCompleteSemaphore.AddressOf()
-    };
-
-    mPresentQueue.handle.Submit(lSubmitInfo, mWaitFences[lIndex]);
-
-    const vkpp::khr::PresentInfo lPresentInfo
-    {
-        1, mRenderingCompleteSemaphore.AddressOf(),
-        1, mSwapchain.handle.AddressOf(),
-        &lIndex
-    };
+    const auto& lDrawCmdBuffer = mFrameRing->AllocateCommandBuffer();
+    BuildCmdBuffer(lDrawCmdBuffer, lFrame.imageIndex, UpdateDynamicUniformBuffer());
 
-    mPresentQueue.handle.Present(lPresentInfo);
+    // Flushes this frame's matrices and hands the range over to the frame fence.
+    mFrameRing->Submit(mPresentQueue.handle, lDrawCmdBuffer);
+    mFrameRing->Present(mPresentQueue.handle, mSwapchain.handle);
 }
 
 
@@ -728,9 +636,10 @@ void DynamicUniformBuffer::UpdateDescriptorSets(void) const
         mUBORes.buffer, 0
     };
 
+    // The range of a dynamic descriptor is a single element; the dynamic offset selects it.
     const vkpp::DescriptorBufferInfo lDynamicUniformDescriptor
     {
-        mDynamicRes.buffer, 0
+        mDynamicRing->GetBuffer(), 0, sizeof(glm::mat4)
     };
 
     const std::vector<vkpp::WriteDescriptorSetInfo> lWriteDescriptorSets
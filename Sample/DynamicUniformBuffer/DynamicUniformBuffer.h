@@ -3,7 +3,16 @@
 
 
 
+#include <memory>
+
 #include <Base/ExampleBase.h>
+#include <Memory/DeviceAllocator.h>
+#include <Memory/AutoPtr.h>
+#include <Memory/DeletionQueue.h>
+#include <Memory/RingBuffer.h>
+#include <Memory/FrameContext.h>
+#include <Memory/ThreadPool.h>
+#include <Memory/ParallelCommandRecorder.h>
 #include <Window/WindowEvent.h>
 #include <Window/MouseEvent.h>
 
@@ -70,9 +79,10 @@ class DynamicUniformBuffer : public ExampleBase, private CWindowEvent, private C
 private:
     constexpr static float MINIMUM_ZOOM_LEVEL = 0.05f;
     constexpr static auto OBJECT_INSTANCES = 125;
+    constexpr static uint32_t FRAMES_IN_FLIGHT = 2;
 
-    vkpp::CommandPool mCmdPool;
-    std::vector<vkpp::CommandBuffer> mDrawCmdBuffers;
+    // Retires objects once the frames in flight that may still use them have completed; the frame ring closes a frame of it on every submit.
+    vkpp::DeletionQueue mDeletionQueue{ mLogicalDevice };
 
     vkpp::RenderPass mRenderPass;
     ImageResource mDepthRes;
@@ -80,7 +90,8 @@ private:
 
     vkpp::DescriptorSetLayout mSetLayout;
     vkpp::PipelineLayout mPipelineLayout;
-    vkpp::Pipeline mGraphicsPipeline;
+    // Shared with the recording jobs, which each hold a reference for as long as they record with it.
+    vkpp::AutoPtr<VkPipeline, vkpp::DeferredDeleter<vkpp::DeviceDeleter<VkPipeline>, vkpp::DeletionQueue>> mGraphicsPipeline;
 
     vkpp::DescriptorPool mDescriptorPool;
     vkpp::DescriptorSet mDescriptorSet;
@@ -89,20 +100,21 @@ private:
     BufferResource mVtxBufferRes;
     BufferResource mIdxBufferRes;
     BufferResource mUBORes;
-    BufferResource mDynamicRes;
 
-    vkpp::Semaphore mRenderingCompleteSemaphore;
-    vkpp::Semaphore mPresentCompleteSemaphore;
-    std::vector<vkpp::Fence> mWaitFences;
+    // Per-object matrices are written straight into a persistently mapped ring, one range per frame in flight.
+    std::unique_ptr<vkpp::RingBuffer> mDynamicRing;
+
+    // Command pool, semaphores and fence of each frame in flight; the draw command buffer is re-recorded every frame.
+    std::unique_ptr<vkpp::FrameContextRing> mFrameRing;
+
+    // Per-thread, per-frame command pools for recording the draws in parallel.
+    vkpp::ThreadPool mThreadPool;
+    vkpp::ParallelCommandRecorder mCmdRecorder{ mLogicalDevice, mThreadPool, mGraphicsQueue.familyIndex, FRAMES_IN_FLIGHT };
 
     // Store random per-object rotations.
     std::array<glm::vec3, OBJECT_INSTANCES> mRotations;
     std::array<glm::vec3, OBJECT_INSTANCES> mRotationSpeeds;
 
-    // One big uniform buffer that contains all matrices.
-    // Note that we need to manually allocate the data to copy for GPU-specific uniform buffer offset alignments.
-    glm::mat4* mpUBODataDynamic{ nullptr };
-
     std::size_t mDynamicAlignment{ 0 };
     float mCurrentZoomLevel{ -30.0f };
     glm::vec3 mCurrentRotation{};
@@ -110,10 +122,6 @@ private:
     UniformBufferObject mUniformBufferObject;
     std::size_t mDynamicBufferSize{ 0 };
     void* mpMatrixUBOMapped{ nullptr };
-    void* mpDynamicUBOMapped{ nullptr };
-
-    void CreateCmdPool(void);
-    void AllocateCmdBuffers(void);
 
     void CreateRenderPass(void);
     void CreateDepthResource(void);
@@ -130,14 +138,13 @@ private:
     void CreateIndexBuffer(void);
     void CreateUniformBuffer(void);
     void UpdateUniformBuffer(void);
-    void UpdateDynamicUniformBuffer(void);
+    vkpp::RingAllocation UpdateDynamicUniformBuffer(void);
 
     void UpdateDescriptorSets(void) const;
 
-    void BuildCmdBuffers(void);
+    void BuildCmdBuffer(const vkpp::CommandBuffer& aDrawCmdBuffer, std::size_t aIndex, const vkpp::RingAllocation& aDynamicAllocation);
 
-    void CreateSemaphores(void);
-    void CreateFences(void);
+    void CreateFrameRing(void);
 
     void Update(void);
 
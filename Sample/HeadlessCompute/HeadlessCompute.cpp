@@ -0,0 +1,399 @@
+#include "HeadlessCompute/HeadlessCompute.h"
+
+#include <array>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <algorithm>
+
+#include <System/Exception.h>
+
+
+
+namespace vkpp::sample
+{
+
+
+
+HeadlessCompute::HeadlessCompute(const char* apApplicationName, uint32_t aApplicationVersion, bool aPreferCPU)
+{
+    assert(apApplicationName != nullptr);
+
+    CreateInstance(apApplicationName, aApplicationVersion);
+    PickPhysicalDevice(aPreferCPU);
+    CreateLogicalDevice();
+
+    CreateCommandPool();
+    CreateDescriptorSetLayout();
+    CreatePipelineLayout();
+    CreateComputePipeline();
+
+    CreateStorageBuffer();
+    CreateDescriptorPool();
+    AllocateDescriptorSet();
+    UpdateDescriptorSet();
+}
+
+
+HeadlessCompute::~HeadlessCompute(void)
+{
+    mLogicalDevice.Wait();
+
+    mLogicalDevice.DestroyDescriptorPool(mDescriptorPool);
+
+    // The buffer has to go before the allocator and the device it was created from.
+    mStorageBufferResource.reset();
+    mDeviceAllocator.reset();
+
+    mLogicalDevice.DestroyPipeline(mComputePipeline);
+    mLogicalDevice.DestroyPipelineLayout(mPipelineLayout);
+    mLogicalDevice.DestroyDescriptorSetLayout(mSetLayout);
+    mLogicalDevice.DestroyCommandPool(mCommandPool);
+
+    mLogicalDevice.Reset();
+}
+
+
+void HeadlessCompute::CreateInstance(const char* apApplicationName, uint32_t aApplicationVersion)
+{
+    const vkpp::ApplicationInfo lApplicationInfo
+    {
+        apApplicationName, aApplicationVersion
+    };
+
+    // Neither surface extensions nor validation layers are requested, so that the sample runs wherever a Vulkan driver is installed.
+    const vkpp::InstanceInfo lInstanceInfo
+    {
+        lApplicationInfo
+    };
+
+    mInstance.Reset(lInstanceInfo);
+}
+
+
+void HeadlessCompute::PickPhysicalDevice(bool aPreferCPU)
+{
+    // Enumerate into inline storage and query every device once, rather than asking the driver again in each predicate below.
+    vkpp::FixedVector<vkpp::PhysicalDevice, MAX_PHYSICAL_DEVICE_COUNT> lPhysicalDevices;
+    mInstance.GetPhysicalDevices(lPhysicalDevices);
+
+    vkpp::FixedVector<vkpp::PhysicalDeviceSnapshot, MAX_PHYSICAL_DEVICE_COUNT> lSnapshots;
+
+    for (const auto& lPhysicalDevice : lPhysicalDevices)
+        lSnapshots.push_back(vkpp::PhysicalDeviceSnapshot{ lPhysicalDevice });
+
+    const auto HasComputeQueue = [](const vkpp::PhysicalDeviceSnapshot& aSnapshot)
+    {
+        return aSnapshot.GetQueueFamilyIndex(vkpp::QueueFlagBits::eCompute) != UINT32_MAX;
+    };
+
+    auto lDeviceIter = lSnapshots.cend();
+
+    // Software implementations report themselves as CPU devices.
+    if (aPreferCPU)
+    {
+        lDeviceIter = std::find_if(lSnapshots.cbegin(), lSnapshots.cend(), [&HasComputeQueue](const auto& aSnapshot)
+        {
+            return aSnapshot.GetProperties().deviceType == vkpp::PhysicalDeviceType::eCPU && HasComputeQueue(aSnapshot);
+        });
+    }
+
+    if (lDeviceIter == lSnapshots.cend())
+        lDeviceIter = std::find_if(lSnapshots.cbegin(), lSnapshots.cend(), HasComputeQueue);
+
+    assert(lDeviceIter != lSnapshots.cend());
+
+    mPhysicalDevice = lDeviceIter->GetPhysicalDevice();
+    mPhysicalDeviceLimits = lDeviceIter->GetProperties().limits;
+    mPhysicalDeviceMemoryProperties = lDeviceIter->GetMemoryProperties();
+
+    // Prefer a compute-only family, which is usually the asynchronous compute queue.
+    mComputeQueue.familyIndex = lDeviceIter->GetQueueFamilyIndex(vkpp::QueueFlagBits::eCompute, vkpp::QueueFlagBits::eGraphics);
+
+    if (mComputeQueue.familyIndex == UINT32_MAX)
+        mComputeQueue.familyIndex = lDeviceIter->GetQueueFamilyIndex(vkpp::QueueFlagBits::eCompute);
+
+    std::cout << "Device:\t" << lDeviceIter->GetProperties().deviceName << std::endl
+        << "Compute Queue Family:\t" << mComputeQueue.familyIndex << std::endl;
+}
+
+
+void HeadlessCompute::CreateLogicalDevice(void)
+{
+    constexpr std::array<float, 1> lProprities{ 1.0f };
+    const std::array<vkpp::QueueCreateInfo, 1> lQueueCreateInfos{ { { mComputeQueue.familyIndex, lProprities } } };
+
+    const vkpp::LogicalDeviceCreateInfo lLogicalDeviceCreateInfo
+    {
+        1, lQueueCreateInfos.data(),
+        0, nullptr,                 // No device extensions, there is no swapchain.
+        nullptr
+    };
+
+    mLogicalDevice.Reset(mPhysicalDevice, lLogicalDeviceCreateInfo);
+    mComputeQueue.handle = mLogicalDevice.GetQueue(mComputeQueue.familyIndex, 0);
+
+    mDeviceAllocator = std::make_unique<vkpp::DeviceAllocator>(mLogicalDevice, mPhysicalDeviceMemoryProperties, mPhysicalDeviceLimits);
+}
+
+
+void HeadlessCompute::CreateCommandPool(void)
+{
+    const vkpp::CommandPoolCreateInfo lCmdCreateInfo
+    {
+        mComputeQueue.familyIndex,
+        vkpp::CommandPoolCreateFlagBits::eTransient
+    };
+
+    mCommandPool = mLogicalDevice.CreateCommandPool(lCmdCreateInfo);
+}
+
+
+void HeadlessCompute::CreateDescriptorSetLayout(void)
+{
+    // Binding 0: Storage Buffer (Compute Shader).
+    constexpr vkpp::DescriptorSetLayoutBinding lSetLayoutBinding
+    {
+        0, vkpp::DescriptorType::eStorageBuffer,
+        1, vkpp::ShaderStageFlagBits::eCompute
+    };
+
+    const vkpp::DescriptorSetLayoutCreateInfo lSetLayoutCreateInfo
+    {
+        1, lSetLayoutBinding.AddressOf()
+    };
+
+    mSetLayout = mLogicalDevice.CreateDescriptorSetLayout(lSetLayoutCreateInfo);
+}
+
+
+void HeadlessCompute::CreatePipelineLayout(void)
+{
+    // The element count is pushed so that the last workgroup can skip the invocations past the end of the buffer.
+    constexpr vkpp::PushConstantRange lPushConstantRange
+    {
+        vkpp::ShaderStageFlagBits::eCompute,
+        0, sizeof(uint32_t)
+    };
+
+    mPipelineLayout = mLogicalDevice.CreatePipelineLayout({ mSetLayout, lPushConstantRange });
+}
+
+
+void HeadlessCompute::CreateComputePipeline(void)
+{
+    // The SPIR-V is not shipped; it has to be compiled from Shader/square.comp first.
+    if (!std::ifstream{ "Shader/SPV/square.comp.spv" }.good())
+    {
+        std::cerr << "Shader/SPV/square.comp.spv is missing: compile it with Shader/gen.bat." << std::endl;
+        throw CException{ "Shader/SPV/square.comp.spv is missing." };
+    }
+
+    // Destroyed when leaving the scope, including when creating the pipeline throws.
+    const auto& lComputeShaderModule = mLogicalDevice.CreateShaderModuleUnique("Shader/SPV/square.comp.spv");
+
+    const vkpp::PipelineShaderStageCreateInfo lShaderStageCreateInfo
+    {
+        vkpp::ShaderStageFlagBits::eCompute,
+        lComputeShaderModule
+    };
+
+    const vkpp::ComputePipelineCreateInfo lComputePipelineCreateInfo
+    {
+        lShaderStageCreateInfo,
+        mPipelineLayout
+    };
+
+    mComputePipeline = mLogicalDevice.CreateComputePipeline(lComputePipelineCreateInfo);
+}
+
+
+void HeadlessCompute::CreateStorageBuffer(void)
+{
+    const vkpp::BufferCreateInfo lBufferCreateInfo
+    {
+        ELEMENT_COUNT * sizeof(uint32_t),
+        vkpp::BufferUsageFlagBits::eStorageBuffer
+    };
+
+    // Host visible so that the input is written and the result read back without a staging copy; fine for a sample of this size.
+    mStorageBufferResource = std::make_unique<BufferResource>(*mDeviceAllocator);
+    mStorageBufferResource->Reset(lBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
+}
+
+
+void HeadlessCompute::CreateDescriptorPool(void)
+{
+    constexpr vkpp::DescriptorPoolSize lPoolSize
+    {
+        vkpp::DescriptorType::eStorageBuffer,
+        1
+    };
+
+    const vkpp::DescriptorPoolCreateInfo lDescriptorPoolCreateInfo
+    {
+        1, lPoolSize.AddressOf(),
+        1
+    };
+
+    mDescriptorPool = mLogicalDevice.CreateDescriptorPool(lDescriptorPoolCreateInfo);
+}
+
+
+void HeadlessCompute::AllocateDescriptorSet(void)
+{
+    const vkpp::DescriptorSetAllocateInfo lSetAllocateInfo
+    {
+        mDescriptorPool,
+        1, mSetLayout.AddressOf()
+    };
+
+    mDescriptorSet = mLogicalDevice.AllocateDescriptorSet(lSetAllocateInfo);
+}
+
+
+void HeadlessCompute::UpdateDescriptorSet(void) const
+{
+    const vkpp::DescriptorBufferInfo lDescriptorBufferInfo
+    {
+        mStorageBufferResource->buffer,
+        0,
+        ELEMENT_COUNT * sizeof(uint32_t)
+    };
+
+    const vkpp::WriteDescriptorSetInfo lWriteDescriptorSetInfo
+    {
+        mDescriptorSet,
+        0,                          // Binding 0: storage buffer.
+        vkpp::DescriptorType::eStorageBuffer,
+        lDescriptorBufferInfo
+    };
+
+    mLogicalDevice.UpdateDescriptorSet(lWriteDescriptorSetInfo);
+}
+
+
+void HeadlessCompute::Dispatch(void) const
+{
+    const vkpp::CommandBufferAllocateInfo lCmdBufferAllocateInfo
+    {
+        mCommandPool,
+        1                   // Command buffer count.
+    };
+
+    const auto& lCmdBuffer = mLogicalDevice.AllocateCommandBuffer(lCmdBufferAllocateInfo);
+
+    constexpr vkpp::CommandBufferBeginInfo lCmdBufferBeginInfo
+    {
+        vkpp::CommandBufferUsageFlagBits::eOneTimeSubmit
+    };
+
+    lCmdBuffer.Begin(lCmdBufferBeginInfo);
+
+    lCmdBuffer.BindComputePipeline(mComputePipeline);
+    lCmdBuffer.BindComputeDescriptorSet(mPipelineLayout, 0, mDescriptorSet);
+    lCmdBuffer.PushConstants(mPipelineLayout, vkpp::ShaderStageFlagBits::eCompute, 0, sizeof(ELEMENT_COUNT), &ELEMENT_COUNT);
+
+    // Round up, the shader discards the invocations past ELEMENT_COUNT.
+    lCmdBuffer.Dispatch((ELEMENT_COUNT + WORKGROUP_SIZE - 1) / WORKGROUP_SIZE);
+
+    // Make the shader writes visible to the host read after the fence.
+    constexpr vkpp::MemoryBarrier lMemoryBarrier
+    {
+        vkpp::AccessFlagBits::eShaderWrite,
+        vkpp::AccessFlagBits::eHostRead
+    };
+
+    lCmdBuffer.PipelineBarrier(vkpp::PipelineStageFlagBits::eComputeShader, vkpp::PipelineStageFlagBits::eHost, vkpp::DefaultFlags, lMemoryBarrier);
+
+    lCmdBuffer.End();
+
+    const vkpp::SubmitInfo lSubmitInfo
+    {
+        lCmdBuffer
+    };
+
+    constexpr vkpp::FenceCreateInfo lFenceCreateInfo;
+    const auto& lFence = mLogicalDevice.CreateFenceUnique(lFenceCreateInfo);
+
+    mComputeQueue.handle.Submit(lSubmitInfo, lFence);
+
+    mLogicalDevice.WaitForFence(lFence);
+    mLogicalDevice.FreeCommandBuffer(mCommandPool, lCmdBuffer);
+}
+
+
+bool HeadlessCompute::Run(void) const
+{
+    auto lpValues = mStorageBufferResource->Map<uint32_t>();
+
+    for (uint32_t lIndex = 0; lIndex < ELEMENT_COUNT; ++lIndex)
+        lpValues[lIndex] = lIndex;
+
+    Dispatch();
+
+    uint32_t lMismatchCount{ 0 };
+
+    for (uint32_t lIndex = 0; lIndex < ELEMENT_COUNT; ++lIndex)
+    {
+        if (lpValues[lIndex] != lIndex * lIndex)
+            ++lMismatchCount;
+    }
+
+    std::cout << "Squared " << ELEMENT_COUNT << " values, " << lMismatchCount << " mismatches." << std::endl;
+
+    return lMismatchCount == 0;
+}
+
+
+void HeadlessCompute::RunDispatchBenchmark(uint32_t aCommandCount) const
+{
+    const vkpp::CommandBufferAllocateInfo lCmdBufferAllocateInfo
+    {
+        mCommandPool,
+        1                   // Command buffer count.
+    };
+
+    const auto& lCmdBuffer = mLogicalDevice.AllocateCommandBuffer(lCmdBufferAllocateInfo);
+
+    vkpp::internal::DeviceDispatchTable lDispatchTable;
+    lDispatchTable.Load(mLogicalDevice);
+
+    constexpr vkpp::CommandBufferBeginInfo lCmdBufferBeginInfo
+    {
+        vkpp::CommandBufferUsageFlagBits::eOneTimeSubmit
+    };
+
+    // Recording only, the command buffer is never submitted. Push constants are about the cheapest command for the driver to record.
+    const auto TimeRecording = [&](PFN_vkCmdPushConstants apCmdPushConstants)
+    {
+        mLogicalDevice.ResetCommandPool(mCommandPool);
+        lCmdBuffer.Begin(lCmdBufferBeginInfo);
+
+        const auto lStart = std::chrono::steady_clock::now();
+
+        for (uint32_t lIndex = 0; lIndex < aCommandCount; ++lIndex)
+            apCmdPushConstants(lCmdBuffer, mPipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(lIndex), &lIndex);
+
+        const std::chrono::duration<double, std::nano> lElapsed = std::chrono::steady_clock::now() - lStart;
+
+        lCmdBuffer.End();
+
+        return lElapsed.count() / aCommandCount;
+    };
+
+    // Warm up the driver's command allocator before timing either path.
+    TimeRecording(vkCmdPushConstants);
+
+    const auto lTrampolineTime = TimeRecording(vkCmdPushConstants);
+    const auto lDispatchTableTime = TimeRecording(lDispatchTable.vkCmdPushConstants);
+
+    std::cout << aCommandCount << " commands:" << std::endl
+        << "Loader trampoline:\t" << lTrampolineTime << " ns per command" << std::endl
+        << "Dispatch table:\t" << lDispatchTableTime << " ns per command" << std::endl;
+
+    mLogicalDevice.FreeCommandBuffer(mCommandPool, lCmdBuffer);
+}
+
+
+}                   // End of namespace vkpp::sample.
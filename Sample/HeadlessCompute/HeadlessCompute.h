@@ -0,0 +1,79 @@
+#ifndef __VKPP_SAMPLE_HEADLESS_COMPUTE_H__
+#define __VKPP_SAMPLE_HEADLESS_COMPUTE_H__
+
+
+
+#include <memory>
+
+#include <Type/Instance.h>
+#include <Type/LogicalDevice.h>
+
+#include "Base/ExampleBase.h"
+
+
+
+namespace vkpp::sample
+{
+
+
+
+// Squares a storage buffer of unsigned integers on the GPU and checks the result on the CPU.
+// No window or surface is involved, so it also runs on software implementations (e.g. SwiftShader, lavapipe) and on CI machines without a display.
+class HeadlessCompute
+{
+private:
+    static constexpr uint32_t ELEMENT_COUNT = 1000;
+    static constexpr uint32_t WORKGROUP_SIZE = 64;      // Must match local_size_x of Shader/square.comp.
+    static constexpr std::size_t MAX_PHYSICAL_DEVICE_COUNT = 8;
+
+    vkpp::Instance mInstance;
+    vkpp::PhysicalDevice mPhysicalDevice;
+    vkpp::PhysicalDeviceLimits mPhysicalDeviceLimits;
+    vkpp::PhysicalDeviceMemoryProperties mPhysicalDeviceMemoryProperties;
+    DeviceQueue mComputeQueue;
+    vkpp::LogicalDevice mLogicalDevice;
+    std::unique_ptr<vkpp::DeviceAllocator> mDeviceAllocator;
+
+    vkpp::CommandPool mCommandPool;
+    vkpp::DescriptorSetLayout mSetLayout;
+    vkpp::PipelineLayout mPipelineLayout;
+    vkpp::Pipeline mComputePipeline;
+    vkpp::DescriptorPool mDescriptorPool;
+    vkpp::DescriptorSet mDescriptorSet;
+
+    std::unique_ptr<BufferResource> mStorageBufferResource;
+
+    void CreateInstance(const char* apApplicationName, uint32_t aApplicationVersion);
+    void PickPhysicalDevice(bool aPreferCPU);
+    void CreateLogicalDevice(void);
+
+    void CreateCommandPool(void);
+    void CreateDescriptorSetLayout(void);
+    void CreatePipelineLayout(void);
+    void CreateComputePipeline(void);
+    void CreateStorageBuffer(void);
+    void CreateDescriptorPool(void);
+    void AllocateDescriptorSet(void);
+    void UpdateDescriptorSet(void) const;
+
+    void Dispatch(void) const;
+
+public:
+    HeadlessCompute(const char* apApplicationName, uint32_t aApplicationVersion, bool aPreferCPU = false);
+    ~HeadlessCompute(void);
+
+    // Run the shader once and return whether every element was squared.
+    bool Run(void) const;
+
+    // Record aCommandCount push constant commands through the loader trampolines and through a vkpp::internal::DeviceDispatchTable,
+    // and print the CPU time per command of both.
+    void RunDispatchBenchmark(uint32_t aCommandCount) const;
+};
+
+
+
+}                   // End of namespace vkpp::sample.
+
+
+
+#endif              // __VKPP_SAMPLE_HEADLESS_COMPUTE_H__
@@ -0,0 +1,400 @@
+#include "HeadlessCompute/SelfTest.h"
+
+#include <iostream>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <functional>
+
+#include <Memory/DeviceAllocator.h>
+#include <Memory/AutoPtr.h>
+#include <Type/PipelineRegistry.h>
+
+
+
+namespace vkpp::sample
+{
+
+
+
+namespace
+{
+
+
+
+bool Check(bool aCondition, const char* apDescription)
+{
+    if (!aCondition)
+        std::cerr << "Self test failed:\t" << apDescription << std::endl;
+
+    return aCondition;
+}
+
+
+bool TestBlockMetadataAlignment(void)
+{
+    vkpp::internal::BlockMetadata lBlock{ 1024 };
+    vkpp::DeviceSize lOffset{ 0 };
+    bool lPassed{ true };
+
+    lPassed &= Check(lBlock.Allocate(10, 1, vkpp::SubAllocationType::eLinear, lOffset) && lOffset == 0, "first allocation starts the block");
+    lPassed &= Check(lBlock.Allocate(100, 256, vkpp::SubAllocationType::eLinear, lOffset) && lOffset == 256, "offset is aligned up");
+
+    // [0, 10) used, [10, 256) padding, [256, 356) used, [356, 1024) free.
+    lPassed &= Check(lBlock.GetRangeCount() == 4, "alignment padding is kept as a free range");
+    lPassed &= Check(lBlock.GetFreeSize() == 1024 - 110, "padding is not counted as allocated");
+
+    lPassed &= Check(lBlock.Allocate(16, 16, vkpp::SubAllocationType::eLinear, lOffset) && lOffset == 16, "padding is reused");
+    lPassed &= Check(!lBlock.Allocate(1024, 1, vkpp::SubAllocationType::eLinear, lOffset), "oversized request fails");
+    lPassed &= Check(!lBlock.Allocate(600, 512, vkpp::SubAllocationType::eLinear, lOffset), "request not fitting once aligned fails");
+    lPassed &= Check(lBlock.GetAllocationCount() == 3, "failed requests allocate nothing");
+
+    return lPassed;
+}
+
+
+bool TestBlockMetadataGranularity(void)
+{
+    constexpr vkpp::DeviceSize lGranularity{ 1024 };
+    bool lPassed{ true };
+
+    {
+        vkpp::internal::BlockMetadata lBlock{ 4096, lGranularity };
+        vkpp::DeviceSize lOffset{ 0 };
+
+        lPassed &= Check(lBlock.Allocate(100, 1, vkpp::SubAllocationType::eLinear, lOffset) && lOffset == 0, "linear resource at the start");
+        lPassed &= Check(lBlock.Allocate(100, 1, vkpp::SubAllocationType::eNonLinear, lOffset) && lOffset == lGranularity,
+            "optimal image after a buffer starts on the next page");
+        lPassed &= Check(lBlock.Allocate(100, 1, vkpp::SubAllocationType::eLinear, lOffset) && lOffset == 100,
+            "linear resources share a page");
+        lPassed &= Check(lBlock.Allocate(900, 1, vkpp::SubAllocationType::eLinear, lOffset) && lOffset == 2 * lGranularity,
+            "buffer after an optimal image starts on the next page");
+    }
+
+    {
+        vkpp::internal::BlockMetadata lBlock{ 4096, lGranularity };
+        vkpp::DeviceSize lFirst{ 0 }, lSecond{ 0 }, lOffset{ 0 };
+
+        lBlock.Allocate(1536, 1, vkpp::SubAllocationType::eNonLinear, lFirst);
+        lBlock.Allocate(100, 1, vkpp::SubAllocationType::eNonLinear, lSecond);
+        lBlock.Free(lFirst);
+
+        // [0, 1536) is free again, but a buffer ending past 1023 would share a page with the image at 1536.
+        lPassed &= Check(lBlock.Allocate(1100, 1, vkpp::SubAllocationType::eLinear, lOffset) && lOffset == 2 * lGranularity,
+            "buffer before an optimal image doesn't reach into its page");
+        lPassed &= Check(lBlock.Allocate(1000, 1, vkpp::SubAllocationType::eLinear, lOffset) && lOffset == 0,
+            "buffer ending on an earlier page fits before an optimal image");
+    }
+
+    return lPassed;
+}
+
+
+bool TestBlockMetadataMerge(void)
+{
+    vkpp::internal::BlockMetadata lBlock{ 1024 };
+    vkpp::DeviceSize lFirst{ 0 }, lSecond{ 0 }, lThird{ 0 }, lOffset{ 0 };
+    bool lPassed{ true };
+
+    lBlock.Allocate(256, 1, vkpp::SubAllocationType::eLinear, lFirst);
+    lBlock.Allocate(256, 1, vkpp::SubAllocationType::eLinear, lSecond);
+    lBlock.Allocate(256, 1, vkpp::SubAllocationType::eLinear, lThird);
+
+    lPassed &= Check(lBlock.GetRangeCount() == 4, "three allocations and the remainder");
+
+    lBlock.Free(lSecond);
+    lPassed &= Check(lBlock.GetRangeCount() == 4, "a free range between used ones stays separate");
+
+    lBlock.Free(lFirst);
+    lPassed &= Check(lBlock.GetRangeCount() == 3, "released range merges with the next free one");
+
+    lBlock.Free(lThird);
+    lPassed &= Check(lBlock.GetRangeCount() == 1, "released range merges with both neighbours");
+    lPassed &= Check(lBlock.IsEmpty() && lBlock.GetFreeSize() == 1024, "block is empty again");
+    lPassed &= Check(lBlock.Allocate(1024, 1, vkpp::SubAllocationType::eLinear, lOffset) && lOffset == 0, "merged block is allocatable as a whole");
+
+    return lPassed;
+}
+
+
+
+// Stands in for a Vulkan destroy function: the handles point at counters of how often they were destroyed.
+class CountingDeleter
+{
+private:
+    std::atomic<uint32_t>* mpDeleteCount{ nullptr };
+
+public:
+    explicit CountingDeleter(std::atomic<uint32_t>& aDeleteCount) noexcept : mpDeleteCount(&aDeleteCount)
+    {}
+
+    void operator()(uint32_t* apHandle) const noexcept
+    {
+        ++*apHandle;
+        mpDeleteCount->fetch_add(1, std::memory_order_relaxed);
+    }
+};
+
+
+bool TestAutoPtrThreads(void)
+{
+    using HandlePtr = vkpp::AutoPtr<uint32_t*, CountingDeleter>;
+
+    constexpr uint32_t lHandleCount{ 100 };
+    constexpr uint32_t lThreadCount{ 8 };
+    constexpr uint32_t lRoundCount{ 20000 };
+
+    std::array<uint32_t, lHandleCount> lHandles{};
+    std::atomic<uint32_t> lDeleteCount{ 0 };
+    bool lPassed{ true };
+
+    // Small chunks, so that the pool grows while the handles are created.
+    HandlePtr::PoolType lPool{ 16 };
+
+    {
+        // Every other control block comes from the pool, the rest from the heap.
+        std::vector<HandlePtr> lShared;
+
+        for (uint32_t lIndex = 0; lIndex < lHandleCount; ++lIndex)
+        {
+            if (lIndex % 2 == 0)
+                lShared.emplace_back(lPool, &lHandles[lIndex], lDeleteCount);
+            else
+                lShared.emplace_back(&lHandles[lIndex], lDeleteCount);
+        }
+
+        lPassed &= Check(lPool.GetUsedCount() == lHandleCount / 2, "pool hands out one block per pooled handle");
+
+        // Workers copy, move and drop references to the shared handles, and each keeps the last few it took until the end of its run.
+        std::vector<std::vector<HandlePtr>> lKept(lThreadCount);
+        std::vector<std::thread> lThreads;
+
+        for (uint32_t lThread = 0; lThread < lThreadCount; ++lThread)
+        {
+            lThreads.emplace_back([&lShared, &lKeptRefs = lKept[lThread], lThread](void)
+            {
+                std::vector<HandlePtr> lRefs;
+
+                for (uint32_t lRound = 0; lRound < lRoundCount; ++lRound)
+                {
+                    HandlePtr lCopy{ lShared[(lThread * 7 + lRound) % lHandleCount] };
+                    HandlePtr lMoved{ std::move(lCopy) };
+
+                    lRefs.push_back(lMoved);
+
+                    if (lRefs.size() > 8)
+                        lRefs.erase(lRefs.begin());
+                }
+
+                lKeptRefs = std::move(lRefs);
+            });
+        }
+
+        for (auto& lThread : lThreads)
+            lThread.join();
+
+        lPassed &= Check(lDeleteCount == 0, "no handle is destroyed while referenced");
+
+        // Hand the last references to the workers, so that the deleters run on them.
+        lShared.clear();
+        lPassed &= Check(lDeleteCount < lHandleCount, "references held by workers keep their handles alive");
+
+        lThreads.clear();
+
+        for (uint32_t lThread = 0; lThread < lThreadCount; ++lThread)
+        {
+            lThreads.emplace_back([&lKeptRefs = lKept[lThread]](void)
+            {
+                lKeptRefs.clear();
+            });
+        }
+
+        for (auto& lThread : lThreads)
+            lThread.join();
+    }
+
+    lPassed &= Check(lDeleteCount == lHandleCount, "every handle is destroyed once the last reference is gone");
+    lPassed &= Check(std::all_of(lHandles.cbegin(), lHandles.cend(), [](uint32_t aCount) { return aCount == 1; }), "no handle is destroyed twice");
+    lPassed &= Check(lPool.GetUsedCount() == 0, "released control blocks go back to the pool");
+
+    return lPassed;
+}
+
+
+bool TestAutoPtrDeferredDeleter(void)
+{
+    // Anything with a Push will do; the DeletionQueue used by the samples needs a device.
+    struct Queue
+    {
+        std::vector<std::function<void(void)>> functions;
+
+        void Push(std::function<void(void)> aFunction)
+        {
+            functions.push_back(std::move(aFunction));
+        }
+    };
+
+    using DeferredPtr = vkpp::AutoPtr<uint32_t*, vkpp::DeferredDeleter<CountingDeleter, Queue>>;
+
+    uint32_t lHandle{ 0 };
+    std::atomic<uint32_t> lDeleteCount{ 0 };
+    Queue lQueue;
+    bool lPassed{ true };
+
+    DeferredPtr lPtr{ &lHandle, lQueue, lDeleteCount };
+    auto lCopy = lPtr;
+
+    lPtr.Reset();
+    lPassed &= Check(lQueue.functions.empty(), "nothing is queued while a reference remains");
+
+    lCopy.Reset();
+    lPassed &= Check(lQueue.functions.size() == 1 && lDeleteCount == 0, "the last release queues the destruction instead of running it");
+
+    for (const auto& lFunction : lQueue.functions)
+        lFunction();
+
+    lPassed &= Check(lDeleteCount == 1 && lHandle == 1, "running the queue destroys the handle once");
+
+    return lPassed;
+}
+
+
+
+// Owns everything a graphics pipeline create info points to, so that two instances have equal contents at different addresses.
+// Handles are left null: the registry hashes them by value and never dereferences them.
+struct PipelineState
+{
+    char entryName[5]{ "main" };
+    std::array<uint32_t, 2> specializationData{ { 1, 2 } };
+    std::array<VkSpecializationMapEntry, 2> mapEntries{ { { 0, 0, sizeof(uint32_t) }, { 1, sizeof(uint32_t), sizeof(uint32_t) } } };
+    VkSpecializationInfo specializationInfo{};
+    std::array<VkPipelineShaderStageCreateInfo, 2> stages{};
+    VkPipelineColorBlendAttachmentState blendAttachment{};
+    VkPipelineColorBlendStateCreateInfo colorBlendState{};
+    std::array<VkDynamicState, 2> dynamicStates{ { VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR } };
+    VkPipelineDynamicStateCreateInfo dynamicState{};
+    VkGraphicsPipelineCreateInfo createInfo{};
+
+    PipelineState(void)
+    {
+        specializationInfo = { static_cast<uint32_t>(mapEntries.size()), mapEntries.data(), sizeof(specializationData), specializationData.data() };
+
+        stages[0] = { VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO, nullptr, 0, VK_SHADER_STAGE_VERTEX_BIT, VK_NULL_HANDLE, entryName, nullptr };
+        stages[1] = { VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO, nullptr, 0, VK_SHADER_STAGE_FRAGMENT_BIT, VK_NULL_HANDLE, entryName, &specializationInfo };
+
+        blendAttachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+
+        colorBlendState.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+        colorBlendState.attachmentCount = 1;
+        colorBlendState.pAttachments = &blendAttachment;
+
+        dynamicState.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+        dynamicState.dynamicStateCount = static_cast<uint32_t>(dynamicStates.size());
+        dynamicState.pDynamicStates = dynamicStates.data();
+
+        createInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+        createInfo.stageCount = static_cast<uint32_t>(stages.size());
+        createInfo.pStages = stages.data();
+        createInfo.pColorBlendState = &colorBlendState;
+        createInfo.pDynamicState = &dynamicState;
+        createInfo.basePipelineIndex = -1;
+    }
+
+    PipelineState(const PipelineState&) = delete;
+    PipelineState& operator=(const PipelineState&) = delete;
+
+    uint64_t Hash(vkpp::internal::HashKey& aKey) const
+    {
+        aKey.clear();
+
+        return vkpp::PipelineRegistry::Hash(vkpp::GraphicsPipelineCreateInfo{ createInfo }, &aKey);
+    }
+};
+
+
+bool TestPipelineRegistryHash(void)
+{
+    PipelineState lState, lEqualState;
+    vkpp::internal::HashKey lKey, lOtherKey;
+    bool lPassed{ true };
+
+    const auto lHash = lState.Hash(lKey);
+
+    lPassed &= Check(lEqualState.Hash(lOtherKey) == lHash && lOtherKey == lKey, "equal create infos at different addresses hash and key equal");
+
+    PipelineState lSpecializedState;
+    lSpecializedState.specializationData[1] = 3;
+    lPassed &= Check(lSpecializedState.Hash(lOtherKey) != lHash && lOtherKey != lKey, "specialization data is part of the key");
+
+    PipelineState lBlendState;
+    lBlendState.blendAttachment.blendEnable = VK_TRUE;
+    lPassed &= Check(lBlendState.Hash(lOtherKey) != lHash && lOtherKey != lKey, "blend attachments are part of the key");
+
+    PipelineState lEmptyState, lAbsentState;
+    lEmptyState.dynamicState.dynamicStateCount = 0;
+    lAbsentState.createInfo.pDynamicState = nullptr;
+    lEmptyState.Hash(lKey);
+    lAbsentState.Hash(lOtherKey);
+    lPassed &= Check(lOtherKey != lKey, "an absent state differs from an empty one");
+
+    return lPassed;
+}
+
+
+bool TestPipelineRegistryCollision(void)
+{
+    PipelineState lState, lOtherState;
+    lOtherState.entryName[0] = 'M';
+
+    vkpp::internal::HashKey lKey, lOtherKey;
+    lState.Hash(lKey);
+    lOtherState.Hash(lOtherKey);
+
+    // Force both keys into one bucket, as a colliding hash would.
+    constexpr uint64_t lHash{ 42 };
+    vkpp::internal::HashTable<uint32_t> lTable;
+    bool lPassed{ true };
+
+    lTable.Insert(lHash, lKey, 1);
+    lPassed &= Check(lTable.Find(lHash, lOtherKey) == nullptr, "a colliding hash with a different key is not a hit");
+
+    lTable.Insert(lHash, lOtherKey, 2);
+
+    const auto lpValue = lTable.Find(lHash, lKey);
+    const auto lpOtherValue = lTable.Find(lHash, lOtherKey);
+
+    lPassed &= Check(lpValue != nullptr && *lpValue == 1 && lpOtherValue != nullptr && *lpOtherValue == 2, "colliding entries are told apart by their keys");
+    lPassed &= Check(lTable.Find(lHash + 1, lKey) == nullptr, "an equal key under another hash is not a hit");
+    lPassed &= Check(lTable.GetSize() == 2, "colliding entries are kept side by side");
+
+    return lPassed;
+}
+
+
+
+}
+
+
+
+bool RunSelfTests(void)
+{
+    bool lPassed{ true };
+
+    lPassed &= TestBlockMetadataAlignment();
+    lPassed &= TestBlockMetadataGranularity();
+    lPassed &= TestBlockMetadataMerge();
+    lPassed &= TestAutoPtrThreads();
+    lPassed &= TestAutoPtrDeferredDeleter();
+    lPassed &= TestPipelineRegistryHash();
+    lPassed &= TestPipelineRegistryCollision();
+
+    std::cout << "Self tests " << (lPassed ? "passed." : "FAILED.") << std::endl;
+
+    return lPassed;
+}
+
+
+
+}                   // End of namespace vkpp::sample.
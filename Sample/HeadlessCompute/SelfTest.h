@@ -0,0 +1,20 @@
+#ifndef __VKPP_SAMPLE_SELF_TEST_H__
+#define __VKPP_SAMPLE_SELF_TEST_H__
+
+
+
+namespace vkpp::sample
+{
+
+
+
+// Exercises the parts of vkpp that don't need a device, prints every failed check and returns whether all of them passed.
+bool RunSelfTests(void);
+
+
+
+}                   // End of namespace vkpp::sample.
+
+
+
+#endif              // __VKPP_SAMPLE_SELF_TEST_H__
@@ -0,0 +1,2 @@
+if not exist SPV mkdir SPV
+glslangvalidator -V square.comp -o SPV/square.comp.spv
@@ -0,0 +1,39 @@
+#include <cstring>
+
+#include "HeadlessCompute/HeadlessCompute.h"
+#include "HeadlessCompute/SelfTest.h"
+
+
+
+using namespace vkpp::sample;
+
+
+
+// Pass --cpu to run on a software implementation when a hardware device is present as well.
+// Pass --benchmark to also compare the cost of recording commands through the loader and through a dispatch table.
+// Pass --selftest to only run the checks of the device independent parts of vkpp; no Vulkan driver is needed.
+int main(int argc, char* argv[])
+{
+    static constexpr auto ApplicationName = "Headless Compute";
+
+    bool lPreferCPU{ false };
+    bool lBenchmark{ false };
+    bool lSelfTest{ false };
+
+    for (int lIndex = 1; lIndex < argc; ++lIndex)
+    {
+        lPreferCPU = lPreferCPU || std::strcmp(argv[lIndex], "--cpu") == 0;
+        lBenchmark = lBenchmark || std::strcmp(argv[lIndex], "--benchmark") == 0;
+        lSelfTest = lSelfTest || std::strcmp(argv[lIndex], "--selftest") == 0;
+    }
+
+    if (lSelfTest)
+        return RunSelfTests() ? 0 : 1;
+
+    HeadlessCompute lHeadlessCompute(ApplicationName, 1, lPreferCPU);
+
+    if (lBenchmark)
+        lHeadlessCompute.RunDispatchBenchmark(100000);
+
+    return lHeadlessCompute.Run() ? 0 : 1;
+}
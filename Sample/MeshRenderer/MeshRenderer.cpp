@@ -10,11 +10,11 @@ namespace vkpp::sample
 MeshRenderer::MeshRenderer(CWindow& aWindow, const char* apAppName, uint32_t aAppVersion, const char* apEngineName, uint32_t aEngineVersion)
     : ExampleBase(aWindow, apAppName, aAppVersion, apEngineName, aEngineVersion),
       CWindowEvent(aWindow), CMouseMotionEvent(aWindow), CMouseWheelEvent(aWindow),
-      mDepthRes(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mVertexBufferRes(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mIndexBufferRes(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mTextureRes(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mUBORes(mLogicalDevice, mPhysicalDeviceMemoryProperties)
+      mDepthRes(*mDeviceAllocator),
+      mVertexBufferRes(*mDeviceAllocator),
+      mIndexBufferRes(*mDeviceAllocator),
+      mTextureRes(*mDeviceAllocator),
+      mUBORes(*mDeviceAllocator)
 {
     theApp.RegisterUpdateEvent([this](void)
     {
@@ -102,10 +102,9 @@ MeshRenderer::~MeshRenderer(void)
 
     mLogicalDevice.DestroyFences(mWaitFences);
 
-    mLogicalDevice.UnmapMemory(mUBORes.memory);
-
     mUBORes.Reset();
 
+    mDrawCommands.reset();
     mIndexBufferRes.Reset();
     mVertexBufferRes.Reset();
 
@@ -429,11 +428,19 @@ void MeshRenderer::LoadModel(const std::string& aFilename)
 
     std::vector<float> lVertexBuffer;
     std::vector<uint32_t> lIndexBuffer;
+    uint32_t lVertexCount{ 0 };
+
+    // The command buffers are recorded once, so a single region of indirect records is enough.
+    mDrawCommands = std::make_unique<vkpp::DrawCommandBuffer>(*mDeviceAllocator, lpScene->mNumMeshes);
+    mDrawCommands->BeginFrame(0);
 
     // Iterate through all meshes in the file and extract the vertex components.
     for (unsigned int lMeshIdx = 0; lMeshIdx < lpScene->mNumMeshes; ++lMeshIdx)
     {
         const auto lpMesh = lpScene->mMeshes[lMeshIdx];
+        const auto lFirstVertex = lVertexCount;
+
+        lVertexCount += lpMesh->mNumVertices;
 
         for (unsigned int lVtxIdx = 0; lVtxIdx < lpMesh->mNumVertices; ++lVtxIdx)
         {
@@ -461,7 +468,7 @@ void MeshRenderer::LoadModel(const std::string& aFilename)
             lVertexBuffer.emplace_back(lColor.b);
         }
 
-        mIndexCount = static_cast<uint32_t>(lIndexBuffer.size());
+        const auto lFirstIndex = static_cast<uint32_t>(lIndexBuffer.size());
         for (unsigned int lIdxIndex = 0; lIdxIndex < lpMesh->mNumFaces; ++lIdxIndex)
         {
             const auto& lFace = lpMesh->mFaces[lIdxIndex];
@@ -470,12 +477,17 @@ void MeshRenderer::LoadModel(const std::string& aFilename)
                 continue;
 
             // Assume that all faces are triangulated
-            lIndexBuffer.emplace_back(mIndexCount + lFace.mIndices[0]);
-            lIndexBuffer.emplace_back(mIndexCount + lFace.mIndices[1]);
-            lIndexBuffer.emplace_back(mIndexCount + lFace.mIndices[2]);
+            lIndexBuffer.emplace_back(lFace.mIndices[0]);
+            lIndexBuffer.emplace_back(lFace.mIndices[1]);
+            lIndexBuffer.emplace_back(lFace.mIndices[2]);
         }
+
+        // Indices are local to the mesh; vertexOffset moves them to its vertices.
+        mDrawCommands->Add(static_cast<uint32_t>(lIndexBuffer.size()) - lFirstIndex, 1, lFirstIndex, static_cast<int32_t>(lFirstVertex));
     }
 
+    mDrawCommands->Flush();
+
     // Static mesh should always be device local.
     // Use staging buffer to move vertex and index buffers to device local memory.
 
@@ -486,12 +498,11 @@ void MeshRenderer::LoadModel(const std::string& aFilename)
         lVtxBufferSize, vkpp::BufferUsageFlagBits::eTransferSrc
     };
 
-    BufferResource lVtxStagingBuffer{ mLogicalDevice, mPhysicalDeviceMemoryProperties };
+    BufferResource lVtxStagingBuffer{ *mDeviceAllocator };
     lVtxStagingBuffer.Reset(lVtxStagingBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
 
-    auto lMappedMem = mLogicalDevice.MapMemory(lVtxStagingBuffer.memory, 0, lVtxBufferSize);
+    auto lMappedMem = lVtxStagingBuffer.Map();
     std::memcpy(lMappedMem, lVertexBuffer.data(), lVtxBufferSize);
-    mLogicalDevice.UnmapMemory(lVtxStagingBuffer.memory);
 
     // Index buffer
     const auto lIdxBufferSize = static_cast<uint32_t>(lIndexBuffer.size()) * sizeof(uint32_t);
@@ -500,12 +511,11 @@ void MeshRenderer::LoadModel(const std::string& aFilename)
         lIdxBufferSize, vkpp::BufferUsageFlagBits::eTransferSrc
     };
 
-    BufferResource lIdxStagingBuffer{ mLogicalDevice, mPhysicalDeviceMemoryProperties };
+    BufferResource lIdxStagingBuffer{ *mDeviceAllocator };
     lIdxStagingBuffer.Reset(lIdxStagingBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
 
-    lMappedMem = mLogicalDevice.MapMemory(lIdxStagingBuffer.memory, 0, lIdxBufferSize);
+    lMappedMem = lIdxStagingBuffer.Map();
     std::memcpy(lMappedMem, lIndexBuffer.data(), lIdxBufferSize);
-    mLogicalDevice.UnmapMemory(lIdxStagingBuffer.memory);
 
     // Create device local target buffers.
     // Vertex buffer
@@ -548,12 +558,11 @@ void MeshRenderer::LoadTexture(const std::string& aFilename, vkpp::Format aTexFo
         vkpp::BufferUsageFlagBits::eTransferSrc             // This buffer is used as a transfer source for the buffer copy.
     };
 
-    BufferResource lStagingBufferRes{ mLogicalDevice, mPhysicalDeviceMemoryProperties };
+    BufferResource lStagingBufferRes{ *mDeviceAllocator };
     lStagingBufferRes.Reset(lStagingBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
 
-    auto lMappedMem = mLogicalDevice.MapMemory(lStagingBufferRes.memory, 0, lTex2D.size());
+    auto lMappedMem = lStagingBufferRes.Map();
     std::memcpy(lMappedMem, lTex2D.data(), lTex2D.size());
-    mLogicalDevice.UnmapMemory(lStagingBufferRes.memory);
 
     // Setup buffer copy regions for each mip-level.
     std::vector<vkpp::BufferImageCopy> lBufferCopyRegions;
@@ -687,7 +696,7 @@ void MeshRenderer::CreateUniformBuffer()
     mUBORes.Reset(lBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
 
     // Map persistent
-    mpMatrixUBOMapped = mLogicalDevice.MapMemory(mUBORes.memory, 0, VK_WHOLE_SIZE);
+    mpMatrixUBOMapped = mUBORes.Map();
 }
 
 
@@ -800,7 +809,7 @@ void MeshRenderer::BuildCmdBuffers(void)
         lDrawCmdBuffer.BindGraphicsPipeline(mGraphicsPipeline);
         lDrawCmdBuffer.BindGraphicsDescriptorSet(mPipelineLayout, 0, mDescriptorSet);
 
-        lDrawCmdBuffer.DrawIndexed(mIndexCount);
+        mDrawCommands->Record(lDrawCmdBuffer, vkpp::DrawCommandBuffer::GetMaxDrawsPerCommand(mEnabledFeatures, mPhysicalDeviceProperties.limits));
 
         lDrawCmdBuffer.EndRenderPass();
 
@@ -893,16 +902,13 @@ void MeshRenderer::EndOneTimeCmdBuffer(const vkpp::CommandBuffer& aCmdBuffer) co
 {
     aCmdBuffer.End();
 
-    constexpr vkpp::FenceCreateInfo lFenceCreateInfo;
-    const auto& lFence = mLogicalDevice.CreateFence(lFenceCreateInfo);
+    const auto lFence = mFencePool.Acquire();
 
     const vkpp::SubmitInfo lSubmitInfo{ aCmdBuffer };
 
     mGraphicsQueue.handle.Submit(lSubmitInfo, lFence);
 
-    mLogicalDevice.WaitForFence(lFence);
-
-    mLogicalDevice.DestroyFence(lFence);
+    mFencePool.WaitAndRecycle(lFence);
     mLogicalDevice.FreeCommandBuffer(mCmdPool, aCmdBuffer);
 }
 
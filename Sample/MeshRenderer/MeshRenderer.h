@@ -3,7 +3,9 @@
 
 
 
+#include <memory>
 #include <Base/ExampleBase.h>
+#include <Memory/DrawCommandBuffer.h>
 #include <Window/WindowEvent.h>
 #include <Window/MouseEvent.h>
 
@@ -115,7 +117,7 @@ private:
 
     BufferResource mVertexBufferRes;
     BufferResource mIndexBufferRes;
-    uint32_t mIndexCount{ 0 };
+    std::unique_ptr<vkpp::DrawCommandBuffer> mDrawCommands;    // One indexed draw per mesh of the model.
 
     Texture mTexture;
     ImageResource mTextureRes;
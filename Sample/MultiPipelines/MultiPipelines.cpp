@@ -31,9 +31,9 @@ decltype(auto) SetEnabledFeatures(const vkpp::PhysicalDeviceFeatures& aPhysicalD
 MultiPipelines::MultiPipelines(CWindow& aWindow, const char* apApplicationName, uint32_t aApplicationVersion, const char* apEngineName, uint32_t aEngineVersion)
     : ExampleBase(aWindow, apApplicationName, aApplicationVersion, apEngineName, aEngineVersion),
       CWindowEvent(aWindow),
-      mModel(*this, mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mDepthResource(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mUniformBufferResource(mLogicalDevice, mPhysicalDeviceMemoryProperties)
+      mModel(*this, *mDeviceAllocator),
+      mDepthResource(*mDeviceAllocator),
+      mUniformBufferResource(*mDeviceAllocator)
 {
     mResizedFunc = [this](Sint32 /*aWidth*/, Sint32 /*aHeight*/)
     {
@@ -296,11 +296,10 @@ void MultiPipelines::UpdateUniformBuffer(void)
     mMVPMatrix.modelView = glm::rotate(mMVPMatrix.modelView, glm::radians(lRotation.y), glm::vec3(0.0f, 1.0f, 0.0f));
     mMVPMatrix.modelView = glm::rotate(mMVPMatrix.modelView, glm::radians(lRotation.z), glm::vec3(0.0f, 0.0f, 1.0f));
 
-    auto lMappedMemory = mLogicalDevice.MapMemory(mUniformBufferResource.memory, 0, sizeof(UniformBufferObject));
+    auto lMappedMemory = mUniformBufferResource.Map();
     std::memcpy(lMappedMemory, &mMVPMatrix, sizeof(UniformBufferObject));
 
     // Note: Since we requested a host coherent memory for the uniform buffer, the write is instantly visible to the GPU.
-    mLogicalDevice.UnmapMemory(mUniformBufferResource.memory);
 }
 
 
@@ -539,16 +538,13 @@ void MultiPipelines::EndOneTimeCommandBuffer(const vkpp::CommandBuffer& aCmdBuff
     const vkpp::SubmitInfo lSubmitInfo{ aCmdBuffer };
 
     // Create fence to ensure that the command buffer has finished executing.
-    constexpr vkpp::FenceCreateInfo lFenceCreateInfo;
-    const auto& lFence = mLogicalDevice.CreateFence(lFenceCreateInfo);
+    const auto lFence = mFencePool.Acquire();
 
     // Submit to the queue.
     mGraphicsQueue.handle.Submit(lSubmitInfo, lFence);
 
     // Wait for the fence to signal that command buffer has finished executing.
-    mLogicalDevice.WaitForFence(lFence);
-
-    mLogicalDevice.DestroyFence(lFence);
+    mFencePool.WaitAndRecycle(lFence);
     mLogicalDevice.FreeCommandBuffer(mCmdPool, aCmdBuffer);
 }
 
@@ -703,8 +699,8 @@ void MultiPipelines::CreateFences(void)
 }
 
 
-Model::Model(const MultiPipelines& aMultiPipelineSample, const vkpp::LogicalDevice& aDevice, const vkpp::PhysicalDeviceMemoryProperties& aPhysicalDeviceMemProperties)
-    : multiPipelineSample(aMultiPipelineSample), device(aDevice), memProperties(aPhysicalDeviceMemProperties), vertices(aDevice, aPhysicalDeviceMemProperties), indices(aDevice, aPhysicalDeviceMemProperties)
+Model::Model(const MultiPipelines& aMultiPipelineSample, vkpp::DeviceAllocator& aAllocator)
+    : multiPipelineSample(aMultiPipelineSample), device(aAllocator.GetLogicalDevice()), allocator(aAllocator), vertices(aAllocator), indices(aAllocator)
 {}
 
 
@@ -789,12 +785,11 @@ void Model::LoadMode(const std::string& aFilename, unsigned int aImporterFlags)
         vkpp::BufferUsageFlagBits::eTransferSrc
     };
 
-    BufferResource lStagingVtxBufferRes{ device, memProperties };
+    BufferResource lStagingVtxBufferRes{ allocator };
     lStagingVtxBufferRes.Reset(lVtxStagingCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
 
-    auto lMappedMem = device.MapMemory(lStagingVtxBufferRes.memory, 0, lVtxBufferSize);
+    auto lMappedMem = lStagingVtxBufferRes.Map();
     std::memcpy(lMappedMem, lVertexBuffer.data(), lVtxBufferSize);
-    device.UnmapMemory(lStagingVtxBufferRes.memory);
 
     // Index Buffer.
     auto lIdxBufferSize = static_cast<uint32_t>(lIndexBuffer.size()) * sizeof(uint32_t);
@@ -804,11 +799,10 @@ void Model::LoadMode(const std::string& aFilename, unsigned int aImporterFlags)
         vkpp::BufferUsageFlagBits::eTransferSrc
     };
 
-    BufferResource lStagingIdxBufferRes{ device, memProperties };
+    BufferResource lStagingIdxBufferRes{ allocator };
     lStagingIdxBufferRes.Reset(lIdxStagingCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
-    lMappedMem = device.MapMemory(lStagingIdxBufferRes.memory, 0, lIdxBufferSize);
+    lMappedMem = lStagingIdxBufferRes.Map();
     std::memcpy(lMappedMem, lIndexBuffer.data(), lIdxBufferSize);
-    device.UnmapMemory(lStagingIdxBufferRes.memory);
 
     // Create device local target buffers.
     // Vertex Buffer.
@@ -97,7 +97,7 @@ struct Model
 
     const MultiPipelines& multiPipelineSample;
     const vkpp::LogicalDevice& device;
-    const vkpp::PhysicalDeviceMemoryProperties& memProperties;
+    vkpp::DeviceAllocator& allocator;
 
     BufferResource vertices;
     BufferResource indices;
@@ -125,7 +125,7 @@ struct Model
     std::vector<ModelPart> modelParts;
     uint32_t vertexCount{ 0 }, indexCount{ 0 };
 
-    Model(const MultiPipelines& aMultiPipelineSample, const vkpp::LogicalDevice& aDevice, const vkpp::PhysicalDeviceMemoryProperties& aPhysicalDeviceMemProperties);
+    Model(const MultiPipelines& aMultiPipelineSample, vkpp::DeviceAllocator& aAllocator);
 
     void LoadMode(const std::string& aFilename, unsigned int aImporterFlags = DefaultImporterFlags);
 };
@@ -10,14 +10,14 @@ namespace vkpp::sample
 OffScreenRenderer::OffScreenRenderer(CWindow& aWindow, const char* apAppName, uint32_t aAppVersion, const char* apEngineName, uint32_t aEngineVersion)
     : ExampleBase(aWindow, apAppName, aAppVersion, apEngineName, aEngineVersion),
       CWindowEvent(aWindow), CMouseMotionEvent(aWindow), CMouseWheelEvent(aWindow),
-      mDepthRes(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mOffscreenFrame(mLogicalDevice, mPhysicalDeviceMemoryProperties, 512, 512, mSwapchain.surfaceFormat.format, vkpp::Format::eD32sFloat),
-      mUBORes(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mPlane(mLogicalDevice, *this, mPhysicalDeviceMemoryProperties),
-      mMesh(mLogicalDevice, *this, mPhysicalDeviceMemoryProperties),
-      mDebugQuadVtxRes(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mDebugQuadIdxRes(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mTextureRes(mLogicalDevice, mPhysicalDeviceMemoryProperties)
+      mDepthRes(*mDeviceAllocator),
+      mOffscreenFrame(*mDeviceAllocator, 512, 512, mSwapchain.surfaceFormat.format, vkpp::Format::eD32sFloat),
+      mUBORes(*mDeviceAllocator),
+      mPlane(*mDeviceAllocator, *this),
+      mMesh(*mDeviceAllocator, *this),
+      mDebugQuadVtxRes(*mDeviceAllocator),
+      mDebugQuadIdxRes(*mDeviceAllocator),
+      mTextureRes(*mDeviceAllocator)
 {
     theApp.RegisterUpdateEvent([this](void)
     {
@@ -71,7 +71,6 @@ OffScreenRenderer::OffScreenRenderer(CWindow& aWindow, const char* apAppName, ui
     BuildOffScreenCmdBuffer();
 
     CreateSemaphores();
-    CreateFences();
 }
 
 
@@ -80,17 +79,11 @@ OffScreenRenderer::~OffScreenRenderer(void)
     mLogicalDevice.Wait();
 
     mLogicalDevice.DestroySemaphore(mOffScreenCompleteSemaphore);
-    mLogicalDevice.DestroySemaphore(mRenderingCompleteSemaphore);
-    mLogicalDevice.DestroySemaphore(mPresentCompleteSemaphore);
-
-    mLogicalDevice.DestroyFences(mWaitFences);
 
     mLogicalDevice.DestroySampler(mTextureSampler);
 
     mTextureRes.Reset();
 
-    mUBORes.Unmap();
-
     mLogicalDevice.DestroyDescriptorPool(mDescriptorPool);
 
     mLogicalDevice.DestroyPipeline(mPipelines.shadedOffscreen);
@@ -600,9 +593,8 @@ void OffScreenRenderer::GenerateDebugQuad(void)
 
     mDebugQuadVtxRes.Reset(lBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
 
-    auto lpMemMappped = mLogicalDevice.MapMemory(mDebugQuadVtxRes.memory);
+    auto lpMemMappped = mDebugQuadVtxRes.Map();
     std::memcpy(lpMemMappped, lVertexData.data(), lVtxDataSize);
-    mLogicalDevice.UnmapMemory(mDebugQuadVtxRes.memory);
 
     // Index buffer
     const std::vector<uint32_t> lIdxData{ 0, 1, 2, 2, 3, 0 };
@@ -614,9 +606,8 @@ void OffScreenRenderer::GenerateDebugQuad(void)
 
     mDebugQuadIdxRes.Reset(lBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
 
-    lpMemMappped = mLogicalDevice.MapMemory(mDebugQuadIdxRes.memory);
+    lpMemMappped = mDebugQuadIdxRes.Map();
     std::memcpy(lpMemMappped, lIdxData.data(), lIdxDataSize);
-    mLogicalDevice.UnmapMemory(mDebugQuadIdxRes.memory);
 }
 
 
@@ -639,12 +630,11 @@ void OffScreenRenderer::LoadTexture(const std::string& aFilename, vkpp::Format a
         vkpp::BufferUsageFlagBits::eTransferSrc             // This buffer is used as a transfer source for the buffer copy.
     };
 
-    BufferResource lStagingBufferRes{ mLogicalDevice, mPhysicalDeviceMemoryProperties };
+    BufferResource lStagingBufferRes{ *mDeviceAllocator };
     lStagingBufferRes.Reset(lStagingBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
 
-    auto lMappedMem = mLogicalDevice.MapMemory(lStagingBufferRes.memory, 0, lTex2D.size());
+    auto lMappedMem = lStagingBufferRes.Map();
     std::memcpy(lMappedMem, lTex2D.data(), lTex2D.size());
-    mLogicalDevice.UnmapMemory(lStagingBufferRes.memory);
 
     // Setup buffer copy regions for each mip-level.
     std::vector<vkpp::BufferImageCopy> lBufferCopyRegions;
@@ -849,21 +839,10 @@ void OffScreenRenderer::CreateSemaphores(void)
 {
     constexpr vkpp::SemaphoreCreateInfo lSemaphoreCreateInfo;
 
-    mPresentCompleteSemaphore = mLogicalDevice.CreateSemaphore(lSemaphoreCreateInfo);
-    mRenderingCompleteSemaphore = mLogicalDevice.CreateSemaphore(lSemaphoreCreateInfo);
     mOffScreenCompleteSemaphore = mLogicalDevice.CreateSemaphore(lSemaphoreCreateInfo);
 }
 
 
-void OffScreenRenderer::CreateFences(void)
-{
-    constexpr vkpp::FenceCreateInfo lFenceCreateInfo{ vkpp::FenceCreateFlagBits::eSignaled };
-
-    for (std::size_t lIndex = 0; lIndex < mDrawCmdBuffers.size(); ++lIndex)
-        mWaitFences.emplace_back(mLogicalDevice.CreateFence(lFenceCreateInfo));
-}
-
-
 void OffScreenRenderer::CopyBuffer(vkpp::Buffer& aDstBuffer, const Buffer& aSrcBuffer, DeviceSize aSize) const
 {
     const auto& lCopyCmd = BeginOneTimeCmdBuffer();
@@ -896,10 +875,8 @@ void OffScreenRenderer::TransitionImageLayout(const vkpp::CommandBuffer& aCmdBuf
 
 void OffScreenRenderer::Update(void)
 {
-    auto lIndex = mLogicalDevice.AcquireNextImage(mSwapchain.handle, mPresentCompleteSemaphore);
-
-    /*mLogicalDevice.WaitForFence(mWaitFences[lIndex]);
-    mLogicalDevice.ResetFence(mWaitFences[lIndex]);*/
+    // Waits for the previous frame only, instead of idling the whole device after presenting.
+    const auto& lFrame = mFrameRing.BeginFrame(mSwapchain.handle);
 
     // The scene renderer command buffer has to wait for the offscreen rendering to be finished before we can use the framebuffer color image for sampling during
     // final rendering. To ensure this, we use a dedicated offscreen synchronization semaphore that will be signaled when offscreen rendering has been finished.
@@ -911,7 +888,7 @@ void OffScreenRenderer::Update(void)
     // Offscreen rendering
     vkpp::SubmitInfo lSubmitInfo
     {
-        1, mPresentCompleteSemaphore.AddressOf(),       // Wait for swap-chain presentation to finish.
+        1, lFrame.acquireSemaphore.AddressOf(),         // Wait for swap-chain presentation to finish.
         &lWaitDstStageMask,
         1, mOffscreenFrame.cmdbuffer.AddressOf(),
         1, mOffScreenCompleteSemaphore.AddressOf()      // Signal ready with offscreen semaphore.
@@ -921,21 +898,12 @@ void OffScreenRenderer::Update(void)
 
     // Scene rendering
     lSubmitInfo.pWaitSemaphores = mOffScreenCompleteSemaphore.AddressOf(); //  mPresentCompleteSemaphore.AddressOf();      // Wait for offscreen semaphore
-    lSubmitInfo.pSignalSemaphores = mRenderingCompleteSemaphore.AddressOf();    // Signal ready with render complete semaphore
-    lSubmitInfo.pCommandBuffers = mDrawCmdBuffers[lIndex].AddressOf();
-
-    mPresentQueue.handle.Submit(lSubmitInfo);
-
-    const vkpp::khr::PresentInfo lPresentInfo
-    {
-        1, mRenderingCompleteSemaphore.AddressOf(),
-        1, mSwapchain.handle.AddressOf(),
-        &lIndex
-    };
-
-    mPresentQueue.handle.Present(lPresentInfo);
+    lSubmitInfo.pSignalSemaphores = lFrame.renderSemaphore.AddressOf();         // Signal ready with render complete semaphore
+    lSubmitInfo.pCommandBuffers = mDrawCmdBuffers[lFrame.imageIndex].AddressOf();
 
-    mLogicalDevice.Wait();
+    // Signals the frame fence.
+    mFrameRing.Submit(mPresentQueue.handle, lSubmitInfo);
+    mFrameRing.Present(mPresentQueue.handle, mSwapchain.handle);
 }
 
 
@@ -963,16 +931,13 @@ void OffScreenRenderer::EndOneTimeCmdBuffer(const vkpp::CommandBuffer& aCmdBuffe
 {
     aCmdBuffer.End();
 
-    constexpr vkpp::FenceCreateInfo lFenceCreateInfo;
-    const auto& lFence = mLogicalDevice.CreateFence(lFenceCreateInfo);
+    const auto lFence = mFencePool.Acquire();
 
     const vkpp::SubmitInfo lSubmitInfo{ aCmdBuffer };
 
     mGraphicsQueue.handle.Submit(lSubmitInfo, lFence);
 
-    mLogicalDevice.WaitForFence(lFence);
-
-    mLogicalDevice.DestroyFence(lFence);
+    mFencePool.WaitAndRecycle(lFence);
     mLogicalDevice.FreeCommandBuffer(mCmdPool, aCmdBuffer);
 }
 
@@ -1051,12 +1016,11 @@ void Model::LoadModel(const std::string& aFilename, float aScale)
         lVtxBufferSize, vkpp::BufferUsageFlagBits::eTransferSrc
     };
 
-    BufferResource lVtxStagingBuffer{ mLogicalDevice, mPhysicalDeviceMemoryProperties };
+    BufferResource lVtxStagingBuffer{ mDeviceAllocator };
     lVtxStagingBuffer.Reset(lVtxStagingBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
 
-    auto lMappedMem = mLogicalDevice.MapMemory(lVtxStagingBuffer.memory, 0, lVtxBufferSize);
+    auto lMappedMem = lVtxStagingBuffer.Map();
     std::memcpy(lMappedMem, lVertexBuffer.data(), lVtxBufferSize);
-    mLogicalDevice.UnmapMemory(lVtxStagingBuffer.memory);
 
     // Index buffer
     const auto lIdxBufferSize = static_cast<uint32_t>(lIndexBuffer.size()) * sizeof(uint32_t);
@@ -1065,12 +1029,11 @@ void Model::LoadModel(const std::string& aFilename, float aScale)
         lIdxBufferSize, vkpp::BufferUsageFlagBits::eTransferSrc
     };
 
-    BufferResource lIdxStagingBuffer{ mLogicalDevice, mPhysicalDeviceMemoryProperties };
+    BufferResource lIdxStagingBuffer{ mDeviceAllocator };
     lIdxStagingBuffer.Reset(lIdxStagingBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
 
-    lMappedMem = mLogicalDevice.MapMemory(lIdxStagingBuffer.memory, 0, lIdxBufferSize);
+    lMappedMem = lIdxStagingBuffer.Map();
     std::memcpy(lMappedMem, lIndexBuffer.data(), lIdxBufferSize);
-    mLogicalDevice.UnmapMemory(lIdxStagingBuffer.memory);
 
     // Create device local target buffers.
     // Vertex buffer
@@ -4,6 +4,7 @@
 
 
 #include <Base/ExampleBase.h>
+#include <Memory/FrameContext.h>
 #include <Window/WindowEvent.h>
 #include <window/MouseEvent.h>
 
@@ -92,11 +93,11 @@ struct UBORes
     void* vsOffscreenMappedMem{ nullptr };
     void* vsDebugQuadMappedMem{ nullptr };
 
-    UBORes(const vkpp::LogicalDevice& aDevice, const vkpp::PhysicalDeviceMemoryProperties& aPhysicalDeviceMemoryProperties)
-        : mDevice(aDevice), vsShaded(aDevice, aPhysicalDeviceMemoryProperties),
-        vsMirror(aDevice, aPhysicalDeviceMemoryProperties),
-        vsOffscreen(aDevice, aPhysicalDeviceMemoryProperties),
-        vsDebugQuad(aDevice, aPhysicalDeviceMemoryProperties)
+    explicit UBORes(vkpp::DeviceAllocator& aAllocator)
+        : mDevice(aAllocator.GetLogicalDevice()), vsShaded(aAllocator),
+        vsMirror(aAllocator),
+        vsOffscreen(aAllocator),
+        vsDebugQuad(aAllocator)
     {}
 
     ~UBORes(void)
@@ -109,18 +110,10 @@ struct UBORes
 
     void Map(void)
     {
-        vsShadedMappedMem = mDevice.MapMemory(vsShaded.memory);
-        vsMirrorMappedMem = mDevice.MapMemory(vsMirror.memory);
-        vsOffscreenMappedMem = mDevice.MapMemory(vsOffscreen.memory);
-        vsDebugQuadMappedMem = mDevice.MapMemory(vsDebugQuad.memory);
-    }
-
-    void Unmap(void) const
-    {
-        mDevice.UnmapMemory(vsDebugQuad.memory);
-        mDevice.UnmapMemory(vsOffscreen.memory);
-        mDevice.UnmapMemory(vsMirror.memory);
-        mDevice.UnmapMemory(vsShaded.memory);
+        vsShadedMappedMem = vsShaded.Map();
+        vsMirrorMappedMem = vsMirror.Map();
+        vsOffscreenMappedMem = vsOffscreen.Map();
+        vsDebugQuadMappedMem = vsDebugQuad.Map();
     }
 };
 
@@ -150,9 +143,8 @@ struct VFrame
     // Semaphore used to synchronize between offscreen and final render pass.
     vkpp::Semaphore semaphore;
 
-    VFrame(const vkpp::LogicalDevice& aDevice, const vkpp::PhysicalDeviceMemoryProperties& aPhysicalDeviceMemoryProperties,
-        uint32_t aWidth, uint32_t aHeight, vkpp::Format aColorFormat, vkpp::Format aDepthFormat)
-        : mDevice(aDevice), color(aDevice, aPhysicalDeviceMemoryProperties), depth(aDevice, aPhysicalDeviceMemoryProperties), width(aWidth), height(aHeight)
+    VFrame(vkpp::DeviceAllocator& aAllocator, uint32_t aWidth, uint32_t aHeight, vkpp::Format aColorFormat, vkpp::Format aDepthFormat)
+        : mDevice(aAllocator.GetLogicalDevice()), color(aAllocator), depth(aAllocator), width(aWidth), height(aHeight)
     {
         // Color attachment
         vkpp::ImageCreateInfo lImageCreateInfo
@@ -303,15 +295,15 @@ class OffScreenRenderer;
 struct Model
 {
     const vkpp::LogicalDevice& mLogicalDevice;
-    const vkpp::PhysicalDeviceMemoryProperties& mPhysicalDeviceMemoryProperties;
+    vkpp::DeviceAllocator& mDeviceAllocator;
     const OffScreenRenderer& mRenderer;
 
     BufferResource mVtxBufferRes, mIdxBufferRes;
     uint32_t mIndexCount{ 0 };
 
-    Model(const vkpp::LogicalDevice& aDeivce, const OffScreenRenderer& aRenderer, const vkpp::PhysicalDeviceMemoryProperties& aPhysicalDeviceMemoryProperties)
-        : mLogicalDevice(aDeivce), mPhysicalDeviceMemoryProperties(aPhysicalDeviceMemoryProperties), mRenderer(aRenderer),
-          mVtxBufferRes(aDeivce, aPhysicalDeviceMemoryProperties), mIdxBufferRes(aDeivce, aPhysicalDeviceMemoryProperties)
+    Model(vkpp::DeviceAllocator& aAllocator, const OffScreenRenderer& aRenderer)
+        : mLogicalDevice(aAllocator.GetLogicalDevice()), mDeviceAllocator(aAllocator), mRenderer(aRenderer),
+          mVtxBufferRes(aAllocator), mIdxBufferRes(aAllocator)
     {}
 
     ~Model(void)
@@ -392,10 +384,10 @@ private:
     ImageResource mTextureRes;
     vkpp::Sampler mTextureSampler;
 
-    vkpp::Semaphore mRenderingCompleteSemaphore;
-    vkpp::Semaphore mPresentCompleteSemaphore;
     vkpp::Semaphore mOffScreenCompleteSemaphore;
-    std::vector<vkpp::Fence> mWaitFences;
+
+    // The offscreen framebuffer and command buffers are shared by all frames and recorded once, so only one frame is kept in flight.
+    vkpp::FrameContextRing mFrameRing{ mLogicalDevice, mGraphicsQueue.familyIndex, 1 };
 
     void CreateCmdPool(void);
     void AllocateCmdBuffers(void);
@@ -424,7 +416,6 @@ private:
     void BuildOffScreenCmdBuffer(void);
 
     void CreateSemaphores(void);
-    void CreateFences(void);
 
     void Update(void);
 
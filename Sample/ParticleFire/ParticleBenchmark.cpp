@@ -0,0 +1,174 @@
+#include "ParticleFire.h"
+#include "ParticleBenchmark.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <algorithm>
+
+
+
+namespace vkpp::sample
+{
+
+
+
+namespace
+{
+
+
+
+// The array-of-structures update ParticleFire shipped with, kept as the reference: one switch per particle and rand() for every random number.
+class ReferenceParticles
+{
+private:
+    const ParticleEmitter mEmitter;
+    std::vector<ParticleVtxData> mParticles;
+
+    static float Rnd(float aRange)
+    {
+        return aRange * (rand() / float(RAND_MAX));
+    }
+
+    void InitParticle(ParticleVtxData& aParticle) const
+    {
+        aParticle.vel = { 0.f, mEmitter.minVel.y + Rnd(mEmitter.maxVel.y - mEmitter.minVel.y), 0.f, 0.f };
+        aParticle.inAlpha = Rnd(0.75f);
+        aParticle.inSize = 1.0f + Rnd(0.5f);
+        aParticle.inColor = glm::vec4{ 1.f };
+        aParticle.inType = ParticleSystem::PARTICLE_TYPE_FLAME;
+        aParticle.inRotation = Rnd(2.f * float(M_PI));
+        aParticle.rotationSpeed = Rnd(2.f) - Rnd(2.f);
+
+        // Get Random sphere point
+        auto lTheta = Rnd(2.f * float(M_PI));
+        auto lPhi = Rnd(float(M_PI)) - float(M_PI) / 2.f;
+        auto lRadius = Rnd(mEmitter.radius);
+
+        aParticle.inPos.x = lRadius * std::cos(lTheta) * std::cos(lPhi);
+        aParticle.inPos.y = lRadius * std::sin(lPhi);
+        aParticle.inPos.z = lRadius * std::sin(lTheta) * std::cos(lPhi);
+
+        aParticle.inPos += glm::vec4(mEmitter.position, 0.f);
+    }
+
+    void TransitionParticle(ParticleVtxData& aParticle) const
+    {
+        switch (aParticle.inType)
+        {
+        case ParticleSystem::PARTICLE_TYPE_FLAME:
+            // Flame particles have a chane of turning into smoke
+            if (Rnd(1.0f) < 0.05f)
+            {
+                aParticle.inAlpha = 0.f;
+                aParticle.inColor = glm::vec4{ 0.25f + Rnd(0.25f) };
+                aParticle.inPos.x *= 0.5f;
+                aParticle.inPos.z *= 0.5f;
+                aParticle.vel = { Rnd(1.f) - Rnd(1.f), mEmitter.minVel.y * 2 + Rnd(mEmitter.maxVel.y - mEmitter.minVel.y), Rnd(1.f) - Rnd(1.f), 0.f };
+                aParticle.inSize = 1.f + Rnd(0.5f);
+                aParticle.rotationSpeed = Rnd(1.f) - Rnd(1.f);
+                aParticle.inType = ParticleSystem::PARTICLE_TYPE_SMOKE;
+            }
+            else
+            {
+                InitParticle(aParticle);
+            }
+            break;
+
+        case ParticleSystem::PARTICLE_TYPE_SMOKE:
+            // Re-spawn at end of life.
+            InitParticle(aParticle);
+            break;
+        }
+    }
+
+public:
+    ReferenceParticles(uint32_t aCount, const ParticleEmitter& aEmitter)
+        : mEmitter(aEmitter), mParticles(aCount)
+    {
+        for (auto& lParticle : mParticles)
+        {
+            InitParticle(lParticle);
+            lParticle.inAlpha = 1.0f - float(std::abs(lParticle.inPos.y) / (mEmitter.radius * 2.f));
+        }
+    }
+
+    void Update(float aTimer)
+    {
+        for (auto& lParticle : mParticles)
+        {
+            switch (lParticle.inType)
+            {
+            case ParticleSystem::PARTICLE_TYPE_FLAME:
+                lParticle.inPos.y -= lParticle.vel.y * aTimer * 3.5f;
+                lParticle.inAlpha += aTimer * 0.25f;
+                lParticle.inSize -= aTimer * 0.5f;
+                break;
+
+            case ParticleSystem::PARTICLE_TYPE_SMOKE:
+                lParticle.inPos -= lParticle.vel * aTimer * 1.f;
+                lParticle.inAlpha += aTimer * 1.25f;
+                lParticle.inSize += aTimer * 0.125f;
+                lParticle.inColor -= aTimer * 0.05f;
+                break;
+            }
+
+            lParticle.inRotation += aTimer * lParticle.rotationSpeed;
+
+            // Transition particle state
+            if (lParticle.inAlpha > 2.f)
+                TransitionParticle(lParticle);
+        }
+    }
+
+    void Write(ParticleVtxData* apVertices) const
+    {
+        std::memcpy(apVertices, mParticles.data(), mParticles.size() * sizeof(ParticleVtxData));
+    }
+};
+
+
+template <typename P>
+double MeasureParticlesPerMillisecond(P& aParticles, ParticleVtxData* apVertices, uint32_t aParticleCount, uint32_t aFrameCount)
+{
+    const auto lStart = std::chrono::steady_clock::now();
+
+    for (uint32_t lFrame = 0; lFrame < aFrameCount; ++lFrame)
+    {
+        aParticles.Update(ParticleSystem::PARTICLE_TIMER);
+        aParticles.Write(apVertices);
+    }
+
+    const std::chrono::duration<double, std::milli> lElapsed = std::chrono::steady_clock::now() - lStart;
+
+    return double(aParticleCount) * aFrameCount / std::max(lElapsed.count(), 1e-3);
+}
+
+
+}
+
+
+
+void RunParticleBenchmark(uint32_t aParticleCount, uint32_t aFrameCount)
+{
+    const ParticleEmitter lEmitter;
+
+    // Stands in for the mapped vertex buffer.
+    std::vector<ParticleVtxData> lVertices(aParticleCount);
+
+    srand(1);
+    ReferenceParticles lReferenceParticles{ aParticleCount, lEmitter };
+    const auto lReference = MeasureParticlesPerMillisecond(lReferenceParticles, lVertices.data(), aParticleCount, aFrameCount);
+
+    ParticleSystem lParticleSystem{ aParticleCount, lEmitter, 1 };
+    const auto lSoA = MeasureParticlesPerMillisecond(lParticleSystem, lVertices.data(), aParticleCount, aFrameCount);
+
+    std::cout << aParticleCount << " particles, " << aFrameCount << " frames:" << std::endl
+        << "\tArray of structures:\t" << lReference << " particles/ms" << std::endl
+        << "\tStructure of arrays:\t" << lSoA << " particles/ms (" << lSoA / lReference << "x)" << std::endl;
+}
+
+
+
+}                   // End of namespace vkpp::sample.
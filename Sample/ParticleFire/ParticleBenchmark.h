@@ -0,0 +1,25 @@
+#ifndef __VKPP_SAMPLE_PARTICLE_BENCHMARK_H__
+#define __VKPP_SAMPLE_PARTICLE_BENCHMARK_H__
+
+
+
+#include <cstdint>
+
+
+
+namespace vkpp::sample
+{
+
+
+
+// Times aFrameCount updates of aParticleCount particles, including the copy into a vertex buffer, with the original
+// array-of-structures loop and with ParticleSystem, and prints the particles per millisecond of both.
+void RunParticleBenchmark(uint32_t aParticleCount, uint32_t aFrameCount);
+
+
+
+}                   // End of namespace vkpp::sample.
+
+
+
+#endif              // __VKPP_SAMPLE_PARTICLE_BENCHMARK_H__
@@ -2,8 +2,12 @@
 
 #include <chrono>
 #include <cmath>
+#include <fstream>
+#include <iostream>
 #include <algorithm>
 
+#include <System/Exception.h>
+
 
 
 namespace vkpp::sample
@@ -11,24 +15,38 @@ namespace vkpp::sample
 
 
 
-ParticleFire::ParticleFire(CWindow & aWindow, const char * apAppName, uint32_t aAppVersion, const char * apEngineName, uint32_t aEngineVersion)
+ParticleFire::ParticleFire(CWindow & aWindow, const char * apAppName, uint32_t aAppVersion, bool aSimulateOnGPU, const char * apEngineName, uint32_t aEngineVersion)
     : ExampleBase{aWindow, apAppName, aAppVersion, apEngineName, aEngineVersion},
       CWindowEvent{aWindow}, CMouseMotionEvent{aWindow}, CMouseWheelEvent{aWindow},
-      mDepthRes{ mLogicalDevice, mPhysicalDeviceMemoryProperties },
-      mSmokeTexRes{ mLogicalDevice, mPhysicalDeviceMemoryProperties },
-      mFireTexRes{ mLogicalDevice, mPhysicalDeviceMemoryProperties },
-      mColorMapTexRes{ mLogicalDevice, mPhysicalDeviceMemoryProperties },
-      mNormapMapTexRes{ mLogicalDevice, mPhysicalDeviceMemoryProperties },
-      mUboEnv{ mLogicalDevice, mPhysicalDeviceMemoryProperties },
-      mUboVS{ mLogicalDevice, mPhysicalDeviceMemoryProperties },
-      mVtxBufferRes{ mLogicalDevice, mPhysicalDeviceMemoryProperties },
-      mIdxBufferRes{ mLogicalDevice, mPhysicalDeviceMemoryProperties },
-      mParticleBufferRes{ mLogicalDevice, mPhysicalDeviceMemoryProperties }
+      mDepthRes{ *mDeviceAllocator },
+      mSmokeTexRes{ *mDeviceAllocator },
+      mFireTexRes{ *mDeviceAllocator },
+      mColorMapTexRes{ *mDeviceAllocator },
+      mNormapMapTexRes{ *mDeviceAllocator },
+      mUboEnv{ *mDeviceAllocator },
+      mUboVS{ *mDeviceAllocator },
+      mVtxBufferRes{ *mDeviceAllocator },
+      mIdxBufferRes{ *mDeviceAllocator },
+      mParticleBufferRes{ *mDeviceAllocator }
 {
+    // The compute shader has to be compiled with Shader/gen.bat; a missing one is a setup error rather than a reason to quietly simulate on the CPU.
+    if (aSimulateOnGPU && !std::ifstream{ "Shader/SPV/particle.comp.spv" }.good())
+    {
+        std::cerr << "Shader/SPV/particle.comp.spv is missing: compile it with Shader/gen.bat, or run with --cpu to simulate on the CPU." << std::endl;
+        throw CException{ "Shader/SPV/particle.comp.spv is missing." };
+    }
+
+    mSimulateOnGPU = aSimulateOnGPU;
+    mParticleCount = mSimulateOnGPU ? GPU_PARTICLE_COUNT : PARTICLE_COUNT;
+
     theApp.RegisterUpdateEvent([this](void)
     {
         UpdateUniformBuffers();
-        UpdateParticles();
+
+        // The GPU simulation is recorded into the draw command buffers.
+        if (!mSimulateOnGPU)
+            UpdateParticles();
+
         Update();
     });
 
@@ -58,9 +76,15 @@ ParticleFire::ParticleFire(CWindow & aWindow, const char * apAppName, uint32_t a
     CreatePipelineLayout();
     CreatePipelines();
 
-    CreateDescriptorPool();
+    if (mSimulateOnGPU)
+        CreateSimulationPipeline();
+
     AllocateDescriptorSets();
 
+    // Every texture and mesh upload below is recorded into one command buffer and submitted together on the transfer queue.
+    mUploadContext = std::make_unique<vkpp::UploadContext>(*mDeviceAllocator, mTransferQueue.handle, mTransferQueue.familyIndex,
+        vkpp::UploadContext::DefaultStagingSize, mGraphicsQueue.familyIndex);
+
     // Particles
     LoadTexture("Texture/particle_fire.ktx", vkpp::Format::eRGBA8uNorm, mTexFire, mFireTexRes);
     LoadTexture("Texture/particle_smoke.ktx", vkpp::Format::eRGBA8uNorm, mTexSmoke, mSmokeTexRes);
@@ -75,7 +99,31 @@ ParticleFire::ParticleFire(CWindow & aWindow, const char * apAppName, uint32_t a
     UpdateDescriptorSets();
 
     LoadModel("Model/fireplace.obj");
-    CreateParticles();
+
+    AcquireUploads();
+    mUploadContext.reset();
+
+    if (mSimulateOnGPU)
+        CreateGPUParticles();
+    else
+        CreateParticles();
+
+    // The draw command buffers are submitted to the present queue.
+    const auto& lQueueFamilyProperties = mPhysicalDevice.GetQueueFamilyProperties();
+    mGPUProfiler = std::make_unique<vkpp::GPUProfiler>(mLogicalDevice, mPhysicalDeviceProperties.limits.timestampPeriod,
+        lQueueFamilyProperties[mPresentQueue.familyIndex].timestampValidBits, static_cast<uint32_t>(mSwapchain.buffers.size()));
+    mSubmittedImages.resize(mSwapchain.buffers.size(), false);
+
+    vkpp::QueryPipelineStatisticFlags lStatistics;
+
+    if (mEnabledFeatures.pipelineStatisticsQuery)
+        lStatistics = vkpp::QueryPipelineStatisticFlagBits::eVertexShaderInvocations | vkpp::QueryPipelineStatisticFlagBits::eFragmentShaderInvocations
+                    | vkpp::QueryPipelineStatisticFlagBits::eComputeShaderInvocations;
+
+    // Occlusion queries are core; without occlusionQueryPrecise they only tell whether any sample passed.
+    mStatisticsProfiler = std::make_unique<vkpp::PipelineStatisticsProfiler>(mLogicalDevice, lStatistics, vkpp::OcclusionQuery::Enable,
+        static_cast<uint32_t>(mSwapchain.buffers.size()),
+        mEnabledFeatures.occlusionQueryPrecise ? vkpp::QueryControlFlagBits::ePrecise : vkpp::QueryControlFlags{});
 
     BuildCmdBuffers();
 
@@ -88,6 +136,24 @@ ParticleFire::~ParticleFire(void)
 {
     mLogicalDevice.Wait();
 
+    for (const auto& lPass : mGPUProfiler->GetPasses())
+        std::cout << "GPU " << lPass.name << ":\t" << lPass.averageMilliseconds << " ms" << std::endl;
+
+    for (const auto& lBatch : mStatisticsProfiler->GetBatches())
+    {
+        std::cout << "Batch " << lBatch.name << ":\t" << lBatch.samplesPassed << " samples passed";
+
+        if (mEnabledFeatures.pipelineStatisticsQuery)
+            std::cout << ", " << mStatisticsProfiler->GetCounter(lBatch, vkpp::QueryPipelineStatisticFlagBits::eVertexShaderInvocations) << " vertex, "
+                      << mStatisticsProfiler->GetCounter(lBatch, vkpp::QueryPipelineStatisticFlagBits::eFragmentShaderInvocations) << " fragment, "
+                      << mStatisticsProfiler->GetCounter(lBatch, vkpp::QueryPipelineStatisticFlagBits::eComputeShaderInvocations) << " compute invocations";
+
+        std::cout << std::endl;
+    }
+
+    mStatisticsProfiler.reset();
+    mGPUProfiler.reset();
+
     mLogicalDevice.DestroySemaphore(mRenderingCompleteSemaphore);
     mLogicalDevice.DestroySemaphore(mPresentCompleteSemaphore);
 
@@ -97,9 +163,6 @@ ParticleFire::~ParticleFire(void)
     mIdxBufferRes.Reset();
     mVtxBufferRes.Reset();
 
-    mUboEnv.Unmap();
-    mUboVS.Unmap();
-
     mUboEnv.Reset();
     mUboVS.Reset();
 
@@ -110,11 +173,15 @@ ParticleFire::~ParticleFire(void)
     mFireTexRes.Reset();
     mSmokeTexRes.Reset();
 
-    mLogicalDevice.DestroyDescriptorPool(mDescriptorPool);
+    mDescriptorSetCache.Reset();
+    mDescriptorAllocator.Clear();
 
+    mLogicalDevice.DestroyPipeline(mPipelines.simulation);
     mLogicalDevice.DestroyPipeline(mPipelines.particle);
     mLogicalDevice.DestroyPipeline(mPipelines.normalmap);
 
+    mLogicalDevice.DestroyPipelineLayout(mComputePipelineLayout);
+    mLogicalDevice.DestroyDescriptorSetLayout(mComputeSetLayout);
     mLogicalDevice.DestroyPipelineLayout(mPipelineLayout);
     mLogicalDevice.DestroyDescriptorSetLayout(mSetLayout);
     mLogicalDevice.DestroyFramebuffers(mFramebuffers);
@@ -271,6 +338,7 @@ void ParticleFire::CreateSetLayouts(void)
     };
 
     mSetLayout = mLogicalDevice.CreateDescriptorSetLayout(lSetLayoutBindings);
+    mDescriptorAllocator.RegisterSetLayout(mSetLayout, lSetLayoutBindings);
 }
 
 
@@ -389,28 +457,46 @@ void ParticleFire::CreatePipelines(void)
 }
 
 
-void ParticleFire::CreateDescriptorPool(void)
+void ParticleFire::CreateSimulationPipeline(void)
 {
-    // Example uses one UBO and two image samplers.
-    constexpr std::array<vkpp::DescriptorPoolSize, 2> lPoolSizes
-    { {
-        { vkpp::DescriptorType::eUniformBuffer, 2 },
-        { vkpp::DescriptorType::eCombinedImageSampler, 4 }
-    } };
+    // Binding 0: Compute shader particle storage buffer
+    constexpr vkpp::DescriptorSetLayoutBinding lSetLayoutBinding
+    {
+        0,
+        vkpp::DescriptorType::eStorageBuffer,
+        vkpp::ShaderStageFlagBits::eCompute
+    };
 
-    mDescriptorPool = mLogicalDevice.CreateDescriptorPool({ lPoolSizes, 2 });
-}
+    mComputeSetLayout = mLogicalDevice.CreateDescriptorSetLayout(lSetLayoutBinding);
+    mDescriptorAllocator.RegisterSetLayout(mComputeSetLayout, lSetLayoutBinding);
+
+    constexpr vkpp::PushConstantRange lPushConstantRange
+    {
+        vkpp::ShaderStageFlagBits::eCompute,
+        0, sizeof(ParticleSimulation)
+    };
 
+    mComputePipelineLayout = mLogicalDevice.CreatePipelineLayout({ mComputeSetLayout, lPushConstantRange });
 
-void ParticleFire::AllocateDescriptorSets(void)
-{
-    const vkpp::DescriptorSetAllocateInfo lSetAllocateInfo
+    const auto& lComputeShaderModule = mLogicalDevice.CreateShaderModule("Shader/SPV/particle.comp.spv");
+
+    const vkpp::PipelineShaderStageCreateInfo lShaderStageCreateInfo
     {
-        mDescriptorPool, mSetLayout
+        vkpp::ShaderStageFlagBits::eCompute,
+        lComputeShaderModule
     };
 
-    mDescriptorSets.normalmap = mLogicalDevice.AllocateDescriptorSet(lSetAllocateInfo);
-    mDescriptorSets.particle = mLogicalDevice.AllocateDescriptorSet(lSetAllocateInfo);
+    mPipelines.simulation = mLogicalDevice.CreateComputePipeline({ lShaderStageCreateInfo, mComputePipelineLayout });
+
+    mLogicalDevice.DestroyShaderModule(lComputeShaderModule);
+}
+
+
+void ParticleFire::AllocateDescriptorSets(void)
+{
+    // The environment and particle sets come from the cache, see UpdateDescriptorSets.
+    if (mSimulateOnGPU)
+        mDescriptorSets.simulation = mDescriptorAllocator.Allocate(mComputeSetLayout);
 }
 
 
@@ -423,20 +509,6 @@ void ParticleFire::LoadTexture(const std::string& aFilename, vkpp::Format aTexFo
     aTexture.height = static_cast<uint32_t>(lTex2D[0].extent().y);
     aTexture.mipLevels = static_cast<uint32_t>(lTex2D.levels());
 
-    // Create a host-visible staging buffer that contains the raw image data.
-    const vkpp::BufferCreateInfo lStagingBufferCreateInfo
-    {
-        lTex2D.size(),
-        vkpp::BufferUsageFlagBits::eTransferSrc
-    };
-
-    BufferResource lStagingBuffer{ mLogicalDevice, mPhysicalDeviceMemoryProperties };
-    lStagingBuffer.Reset(lStagingBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
-
-    auto lpMappedMem = lStagingBuffer.Map();
-    std::memcpy(lpMappedMem, lTex2D.data(), lTex2D.size());
-    lStagingBuffer.Unmap();
-
     // Setup buffer copy regions for each mip-level.
     std::vector<vkpp::BufferImageCopy> lBufferCopyRegions;
     uint32_t lOffset{ 0 };
@@ -493,10 +565,6 @@ void ParticleFire::LoadTexture(const std::string& aFilename, vkpp::Format aTexFo
 
     aTexRes.Reset(lImageCreateInfo, lImageViewCreateInfo, vkpp::MemoryPropertyFlagBits::eDeviceLocal);
 
-    const auto& lCopyCmd = BeginOneTimeCmdBuffer();
-
-    // Image barrier for optimal image.
-
     // The sub-resource range describes the regions of the image which will be transitioned.
     const vkpp::ImageSubresourceRange lImageSubRange
     {
@@ -507,89 +575,8 @@ void ParticleFire::LoadTexture(const std::string& aFilename, vkpp::Format aTexFo
         1                                               // layerCount: The 2D texture only has one layer.
     };
 
-    // Optimal image will be used as the destination for the copy, so it must be transfered from the initial undefined image layout to the transfer destination layout.
-    TransitionImageLayout<vkpp::ImageLayout::eUndefined, vkpp::ImageLayout::eTransferDstOptimal>
-        (
-            lCopyCmd, aTexRes.image,
-            lImageSubRange,
-            vkpp::DefaultFlags,                         // srcAccessMask = 0: Only valid as initial layout, memory contents are not preserved.
-                                                        //                    Can be accessed directly, no source dependency required.
-            vkpp::AccessFlagBits::eTransferWrite        // dstAccessMask: Transfer destination (copy, blit).
-                                                        //                Make sure any write operation to the image has been finished.
-            );
-
-    // Copy all mip-levels from staging buffer.
-    lCopyCmd.Copy(aTexRes.image, vkpp::ImageLayout::eTransferDstOptimal, lStagingBuffer.buffer, lBufferCopyRegions);
-
-    // Transfer texture image layout to shader read after all mip-levels have been copied.
-    TransitionImageLayout<vkpp::ImageLayout::eTransferDstOptimal, vkpp::ImageLayout::eShaderReadOnlyOptimal>
-        (
-            lCopyCmd, aTexRes.image,
-            lImageSubRange,
-            vkpp::AccessFlagBits::eTransferWrite,       // srcAccessMask: Old layout is transfer destination.
-                                                        //                Make sure any write operation to the destination image has been finished.
-            vkpp::AccessFlagBits::eShaderRead           // dstAccessMask: Shader read, like sampler, input attachment.
-            );
-
-    EndOneTimeCmdBuffer(lCopyCmd);
-
-    lStagingBuffer.Reset();
-}
-
-
-template <vkpp::ImageLayout OldLayout, vkpp::ImageLayout NewLayout>
-void ParticleFire::TransitionImageLayout(const vkpp::CommandBuffer& aCmdBuffer, const vkpp::Image& aImage, const vkpp::ImageSubresourceRange& aImageSubRange, const vkpp::AccessFlags& aSrcAccessMask, const vkpp::AccessFlags& aDstAccessMask)
-{
-    // Create an image barrier object.
-    const vkpp::ImageMemoryBarrier lImageBarrier
-    {
-        aSrcAccessMask, aDstAccessMask,
-        OldLayout, NewLayout,
-        aImage,
-        aImageSubRange
-    };
-
-    // Put barrier inside setup command buffer.
-    // Put barrier on top of pipeline.
-    aCmdBuffer.PipelineBarrier(vkpp::PipelineStageFlagBits::eTopOfPipe, vkpp::PipelineStageFlagBits::eTopOfPipe, vkpp::DependencyFlagBits::eByRegion, { lImageBarrier });
-}
-
-
-vkpp::CommandBuffer ParticleFire::BeginOneTimeCmdBuffer(void) const
-{
-    const vkpp::CommandBufferAllocateInfo lCmdBufferAllocateInfo
-    {
-        mCmdPool, 1
-    };
-
-    auto lCmdBuffer = mLogicalDevice.AllocateCommandBuffer(lCmdBufferAllocateInfo);
-
-    constexpr vkpp::CommandBufferBeginInfo lCmdBufferBeginInfo
-    {
-        vkpp::CommandBufferUsageFlagBits::eOneTimeSubmit
-    };
-
-    lCmdBuffer.Begin(lCmdBufferBeginInfo);
-
-    return lCmdBuffer;
-}
-
-
-void ParticleFire::EndOneTimeCmdBuffer(const vkpp::CommandBuffer& aCmdBuffer) const
-{
-    aCmdBuffer.End();
-
-    constexpr vkpp::FenceCreateInfo lFenceCreateInfo;
-    const auto& lFence = mLogicalDevice.CreateFence(lFenceCreateInfo);
-
-    const vkpp::SubmitInfo lSubmitInfo{ aCmdBuffer };
-
-    mGraphicsQueue.handle.Submit(lSubmitInfo, lFence);
-
-    mLogicalDevice.WaitForFence(lFence);
-
-    mLogicalDevice.DestroyFence(lFence);
-    mLogicalDevice.FreeCommandBuffer(mCmdPool, aCmdBuffer);
+    // Copy all mip-levels through the shared staging ring; the image goes from undefined to transfer destination and then to shader read.
+    mUploadContext->Upload(aTexRes.image, lTex2D.data(), lTex2D.size(), lBufferCopyRegions, lImageSubRange);
 }
 
 
@@ -619,6 +606,8 @@ void ParticleFire::CreateSampler(void)
 
 void ParticleFire::UpdateDescriptorSets(void)
 {
+    // The cache allocates and writes each set on its first request; the draw command buffers are prebuilt and keep using them, so it is never aged.
+
     // Image descriptor for the particle texture.
     {
         const vkpp::DescriptorImageInfo lTexDescriptorSmoke{ mTextureSampler, mSmokeTexRes.view, mTexSmoke.layout };
@@ -631,26 +620,25 @@ void ParticleFire::UpdateDescriptorSets(void)
         { {
             // Binding 0: Vertex shader uniform buffer
             {
-                mDescriptorSets.particle, 0,
+                nullptr, 0,
                 vkpp::DescriptorType::eUniformBuffer,
                 lVSUbo
             },
             // Binding 1: Smoke texture
             {
-                mDescriptorSets.particle, 1,
+                nullptr, 1,
                 vkpp::DescriptorType::eCombinedImageSampler,
                 lTexDescriptorSmoke
             },
             // Binding 2: Fire texture
             {
-                mDescriptorSets.particle, 2,
+                nullptr, 2,
                 vkpp::DescriptorType::eCombinedImageSampler,
-
                 lTexDescriptorFire
             }
         } };
 
-        mLogicalDevice.UpdateDescriptorSets(lWriteDescriptorSetInfos);
+        mDescriptorSets.particle = mDescriptorSetCache.GetDescriptorSet(mSetLayout, lWriteDescriptorSetInfos);
     }
 
     // Image descriptor for the color map texture.
@@ -663,25 +651,25 @@ void ParticleFire::UpdateDescriptorSets(void)
         { {
             // Binding 0: Vertex shader uniform buffer
             {
-                mDescriptorSets.normalmap, 0,
+                nullptr, 0,
                 vkpp::DescriptorType::eUniformBuffer,
                 lEnvUbo
             },
             // Binding 1: Smoke texture
             {
-                mDescriptorSets.normalmap, 1,
+                nullptr, 1,
                 vkpp::DescriptorType::eCombinedImageSampler,
                 lTexDescriptorColorMap
             },
             // Binding 2: Fire texture
             {
-                mDescriptorSets.normalmap, 2,
+                nullptr, 2,
                 vkpp::DescriptorType::eCombinedImageSampler,
                 lTexDescriptorNormalMap
             }
         } };
 
-        mLogicalDevice.UpdateDescriptorSets(lWriteDescriptorSetInfos);
+        mDescriptorSets.normalmap = mDescriptorSetCache.GetDescriptorSet(mSetLayout, lWriteDescriptorSetInfos);
     }
 }
 
@@ -762,35 +750,9 @@ void ParticleFire::LoadModel(const std::string& aFilename)
     }
 
     // Static mesh should always be device local.
-    // Use staging buffer to move vertex and index buffers to device local memory.
-
-    // Vertex buffer
+    // Use the upload context to move vertex and index buffers to device local memory.
     const auto lVtxBufferSize = static_cast<uint32_t>(lVertexBuffer.size()) * sizeof(float);
-    const vkpp::BufferCreateInfo lVtxStagingBufferCreateInfo
-    {
-        lVtxBufferSize, vkpp::BufferUsageFlagBits::eTransferSrc
-    };
-
-    BufferResource lVtxStagingBuffer{ mLogicalDevice, mPhysicalDeviceMemoryProperties };
-    lVtxStagingBuffer.Reset(lVtxStagingBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
-
-    auto lMappedMem = mLogicalDevice.MapMemory(lVtxStagingBuffer.memory, 0, lVtxBufferSize);
-    std::memcpy(lMappedMem, lVertexBuffer.data(), lVtxBufferSize);
-    mLogicalDevice.UnmapMemory(lVtxStagingBuffer.memory);
-
-    // Index buffer
     const auto lIdxBufferSize = static_cast<uint32_t>(lIndexBuffer.size()) * sizeof(uint32_t);
-    const vkpp::BufferCreateInfo lIdxStagingBufferCreateInfo
-    {
-        lIdxBufferSize, vkpp::BufferUsageFlagBits::eTransferSrc
-    };
-
-    BufferResource lIdxStagingBuffer{ mLogicalDevice, mPhysicalDeviceMemoryProperties };
-    lIdxStagingBuffer.Reset(lIdxStagingBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
-
-    lMappedMem = mLogicalDevice.MapMemory(lIdxStagingBuffer.memory, 0, lIdxBufferSize);
-    std::memcpy(lMappedMem, lIndexBuffer.data(), lIdxBufferSize);
-    mLogicalDevice.UnmapMemory(lIdxStagingBuffer.memory);
 
     // Create device local target buffers.
     // Vertex buffer
@@ -809,20 +771,48 @@ void ParticleFire::LoadModel(const std::string& aFilename)
 
     mIdxBufferRes.Reset(lIdxBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eDeviceLocal);
 
-    CopyBuffer(mVtxBufferRes.buffer, lVtxStagingBuffer.buffer, lVtxBufferSize);
-    CopyBuffer(mIdxBufferRes.buffer, lIdxStagingBuffer.buffer, lIdxBufferSize);
+    mUploadContext->Upload(mVtxBufferRes.buffer, lVertexBuffer, 0, vkpp::AccessFlagBits::eVertexAttributeRead, vkpp::PipelineStageFlagBits::eVertexInput);
+    mUploadContext->Upload(mIdxBufferRes.buffer, lIndexBuffer, 0, vkpp::AccessFlagBits::eIndexRead, vkpp::PipelineStageFlagBits::eVertexInput);
 }
 
 
-void ParticleFire::CopyBuffer(vkpp::Buffer& aDstBuffer, const Buffer& aSrcBuffer, DeviceSize aSize) const
+// Take ownership of the uploaded resources on the graphics queue once the transfer queue has released them.
+void ParticleFire::AcquireUploads(void)
 {
-    const auto& lCopyCmd = BeginOneTimeCmdBuffer();
+    if (mTransferQueue.familyIndex == mGraphicsQueue.familyIndex)
+    {
+        mUploadContext->WaitIdle();
+        return;
+    }
+
+    auto lAcquire = mUploadContext->TakeAcquire();
 
-    const vkpp::BufferCopy lBufferCopy{ aSize };
+    const vkpp::CommandBufferAllocateInfo lCmdBufferAllocateInfo
+    {
+        mCmdPool, 1
+    };
 
-    lCopyCmd.Copy(aDstBuffer, aSrcBuffer, lBufferCopy);
+    const auto& lCmdBuffer = mLogicalDevice.AllocateCommandBuffer(lCmdBufferAllocateInfo);
 
-    EndOneTimeCmdBuffer(lCopyCmd);
+    constexpr vkpp::CommandBufferBeginInfo lCmdBufferBeginInfo
+    {
+        vkpp::CommandBufferUsageFlagBits::eOneTimeSubmit
+    };
+
+    lCmdBuffer.Begin(lCmdBufferBeginInfo);
+    lAcquire.Record(lCmdBuffer);
+    lCmdBuffer.End();
+
+    vkpp::SubmitInfo lSubmitInfo{ lCmdBuffer };
+    lSubmitInfo.SetWaitSemaphores(vkpp::SizeOf<uint32_t>(lAcquire.semaphores), lAcquire.semaphores.data(), lAcquire.waitDstStageMasks.data());
+
+    const auto lFence = mFencePool.Acquire();
+
+    mGraphicsQueue.handle.Submit(lSubmitInfo, lFence);
+    mFencePool.WaitAndRecycle(lFence);
+    mLogicalDevice.FreeCommandBuffer(mCmdPool, lCmdBuffer);
+
+    mUploadContext->Recycle(lAcquire);
 }
 
 
@@ -885,7 +875,7 @@ void ParticleFire::BuildCmdBuffers(void)
         { 1.0f, 0.0f }
     };
 
-    for (std::size_t lIndex = 0; lIndex < mDrawCmdBuffers.size(); ++lIndex)
+    for (uint32_t lIndex = 0; lIndex < mDrawCmdBuffers.size(); ++lIndex)
     {
         const vkpp::RenderPassBeginInfo lRenderPassBeginInfo
         {
@@ -902,6 +892,17 @@ void ParticleFire::BuildCmdBuffers(void)
 
         lDrawCmdBuffer.Begin(lCmdBufferBeginInfo);
 
+        mGPUProfiler->BeginFrame(lDrawCmdBuffer, lIndex);
+        mStatisticsProfiler->BeginFrame(lDrawCmdBuffer, lIndex);
+
+        // Simulate outside of the render pass, the draw below then reads the particles straight from the storage buffer.
+        if (mSimulateOnGPU)
+        {
+            const vkpp::GPUProfiler::Scope lProfileScope{ *mGPUProfiler, lDrawCmdBuffer, lIndex, "Simulation" };
+            const vkpp::PipelineStatisticsProfiler::Scope lStatisticsScope{ *mStatisticsProfiler, lDrawCmdBuffer, lIndex, "Simulation" };
+            RecordSimulation(lDrawCmdBuffer, 0);
+        }
+
         lDrawCmdBuffer.BeginRenderPass(lRenderPassBeginInfo);
 
         const vkpp::Viewport lViewport
@@ -921,17 +922,27 @@ void ParticleFire::BuildCmdBuffers(void)
         lDrawCmdBuffer.SetScissor(lScissor);
 
         // Environment
-        lDrawCmdBuffer.BindGraphicsPipeline(mPipelines.normalmap);
-        lDrawCmdBuffer.BindGraphicsDescriptorSet(mPipelineLayout, 0, mDescriptorSets.normalmap);
-        lDrawCmdBuffer.BindVertexBuffer(mVtxBufferRes.buffer);
-        lDrawCmdBuffer.BindIndexBuffer(mIdxBufferRes.buffer);
-        lDrawCmdBuffer.DrawIndexed(mIndexCount);
+        {
+            const vkpp::GPUProfiler::Scope lProfileScope{ *mGPUProfiler, lDrawCmdBuffer, lIndex, "Environment" };
+            const vkpp::PipelineStatisticsProfiler::Scope lStatisticsScope{ *mStatisticsProfiler, lDrawCmdBuffer, lIndex, "Environment" };
+
+            lDrawCmdBuffer.BindGraphicsPipeline(mPipelines.normalmap);
+            lDrawCmdBuffer.BindGraphicsDescriptorSet(mPipelineLayout, 0, mDescriptorSets.normalmap);
+            lDrawCmdBuffer.BindVertexBuffer(mVtxBufferRes.buffer);
+            lDrawCmdBuffer.BindIndexBuffer(mIdxBufferRes.buffer);
+            lDrawCmdBuffer.DrawIndexed(mIndexCount);
+        }
 
         // Particle system (no index buffer)
-        lDrawCmdBuffer.BindGraphicsPipeline(mPipelines.particle);
-        lDrawCmdBuffer.BindGraphicsDescriptorSet(mPipelineLayout, 0, mDescriptorSets.particle);
-        lDrawCmdBuffer.BindVertexBuffer(mParticleBufferRes.buffer);
-        lDrawCmdBuffer.Draw(PARTICLE_COUNT);
+        {
+            const vkpp::GPUProfiler::Scope lProfileScope{ *mGPUProfiler, lDrawCmdBuffer, lIndex, "Particles" };
+            const vkpp::PipelineStatisticsProfiler::Scope lStatisticsScope{ *mStatisticsProfiler, lDrawCmdBuffer, lIndex, "Particles" };
+
+            lDrawCmdBuffer.BindGraphicsPipeline(mPipelines.particle);
+            lDrawCmdBuffer.BindGraphicsDescriptorSet(mPipelineLayout, 0, mDescriptorSets.particle);
+            lDrawCmdBuffer.BindVertexBuffer(mParticleBufferRes.buffer);
+            lDrawCmdBuffer.Draw(mParticleCount);
+        }
 
         lDrawCmdBuffer.EndRenderPass();
 
@@ -965,6 +976,13 @@ void ParticleFire::Update(void)
     mLogicalDevice.WaitForFence(mWaitFences[lIndex]);
     mLogicalDevice.ResetFence(mWaitFences[lIndex]);
 
+    // The previous submission of this image's command buffer is complete, so its queries are read without a stall.
+    if (mSubmittedImages[lIndex])
+    {
+        mGPUProfiler->Resolve(lIndex);
+        mStatisticsProfiler->Resolve(lIndex);
+    }
+
     constexpr vkpp::PipelineStageFlags lWaitDstStageMask{ vkpp::PipelineStageFlagBits::eColorAttachmentOutput };
 
     const vkpp::SubmitInfo lSubmitInfo
@@ -976,6 +994,7 @@ void ParticleFire::Update(void)
     };
 
     mPresentQueue.handle.Submit(lSubmitInfo, mWaitFences[lIndex]);
+    mSubmittedImages[lIndex] = true;
 
     const vkpp::khr::PresentInfo lPresentInfo
     {
@@ -988,120 +1007,140 @@ void ParticleFire::Update(void)
 }
 
 
-float Rnd(float aRange)
+void ParticleFire::CreateParticles(void)
 {
-    return aRange * (rand() / float(RAND_MAX));
+    mParticleSystem = std::make_unique<ParticleSystem>(mParticleCount, mEmitter, static_cast<uint32_t>(time(nullptr)));
+
+    const vkpp::BufferCreateInfo lBufferCreateInfo
+    {
+        mParticleCount * sizeof(ParticleVtxData),
+        vkpp::BufferUsageFlagBits::eVertexBuffer
+    };
+
+    mParticleBufferRes.Reset(lBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
+
+    mpParticleMapped = mParticleBufferRes.Map();
+
+    mParticleSystem->Write(static_cast<ParticleVtxData*>(mpParticleMapped));
 }
 
 
-void ParticleFire::InitParticle(ParticleVtxData& aParticle, const glm::vec3& aEmitterPos) const
+void ParticleFire::UpdateParticles(void)
 {
-    aParticle.vel = { 0.f, mMinVel.y + Rnd(mMaxVel.y - mMinVel.y), 0.f, 0.f };
-    aParticle.inAlpha = Rnd(0.75f);
-    aParticle.inSize = 1.0f + Rnd(0.5f);
-    aParticle.inColor = glm::vec4{ 1.f };
-    aParticle.inType = PARTICLE_TYPE_FLAME;
-    aParticle.inRotation = Rnd(2.f * float(M_PI));
-    aParticle.rotationSpeed = Rnd(2.f) - Rnd(2.f);
-
-    // Get Random sphere point
-    auto lTheta = Rnd(2.f * float(M_PI));
-    auto lPhi = Rnd(float(M_PI)) - float(M_PI) / 2.f;
-    auto lRadius = Rnd(FLAME_RADIUS);
-
-    aParticle.inPos.x = lRadius * std::cos(lTheta) * std::cos(lPhi);
-    aParticle.inPos.y = lRadius * std::sin(lPhi);
-    aParticle.inPos.z = lRadius * std::sin(lTheta) * std::cos(lPhi);
-
-    aParticle.inPos += glm::vec4(aEmitterPos, 0.f);
+    mParticleSystem->Update();
+    mParticleSystem->Write(static_cast<ParticleVtxData*>(mpParticleMapped));
 }
 
 
-void ParticleFire::CreateParticles(void)
+ParticleSimulation ParticleFire::GetSimulationConstants(uint32_t aSeed) const
 {
-    srand(unsigned(time(nullptr)));
+    return {
+        glm::vec4{ mEmitter.position, 0.f }, glm::vec4{ mEmitter.minVel, 0.f }, glm::vec4{ mEmitter.maxVel, 0.f },
+        mEmitter.radius, ParticleSystem::PARTICLE_TIMER, mParticleCount, aSeed
+    };
+}
 
-    std::for_each(mParticleBuffer.begin(), mParticleBuffer.end(), [this](auto& aParticle)
-    {
-        InitParticle(aParticle, mEmitterPos);
-        aParticle.inAlpha = 1.0f - float(std::abs(aParticle.inPos.y) / (FLAME_RADIUS * 2.f));
-    });
 
+void ParticleFire::CreateGPUParticles(void)
+{
     const vkpp::BufferCreateInfo lBufferCreateInfo
     {
-        PARTICLE_BUFFER_SIZE,
-        vkpp::BufferUsageFlagBits::eVertexBuffer
+        mParticleCount * sizeof(ParticleVtxData),
+        vkpp::BufferUsageFlagBits::eVertexBuffer | vkpp::BufferUsageFlagBits::eStorageBuffer
     };
 
-    mParticleBufferRes.Reset(lBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
+    // Never touched by the host: the particles are spawned and simulated by particle.comp.
+    mParticleBufferRes.Reset(lBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eDeviceLocal);
 
-    mpParticleMapped = mParticleBufferRes.Map();
+    const vkpp::DescriptorBufferInfo lParticleBufferInfo{ mParticleBufferRes.buffer };
 
-    std::memcpy(mpParticleMapped, mParticleBuffer.data(), PARTICLE_BUFFER_SIZE);
-}
+    if (mDescriptorUpdateTemplateEnabled)
+    {
+        // The set is written from one packed block with a single call instead of from an array of writes.
+        using SimulationDescriptors = vkpp::khr::DescriptorTemplateData<vkpp::khr::DescriptorTemplateBinding<0, vkpp::DescriptorType::eStorageBuffer>>;
 
+        constexpr auto lEntries = SimulationDescriptors::GetEntries();
+        const auto lDescriptorUpdateTemplate = mLogicalDevice.CreateDescriptorUpdateTemplate({ lEntries, mComputeSetLayout });
 
-void ParticleFire::TransitionParticle(ParticleVtxData& aParticle) const
-{
-    switch (aParticle.inType)
+        SimulationDescriptors lDescriptors;
+        lDescriptors.Get<0>() = lParticleBufferInfo;
+
+        mLogicalDevice.UpdateDescriptorSetWithTemplate(mDescriptorSets.simulation, lDescriptorUpdateTemplate, lDescriptors.GetData());
+        mLogicalDevice.DestroyDescriptorUpdateTemplate(lDescriptorUpdateTemplate);
+    }
+    else
     {
-    case PARTICLE_TYPE_FLAME:
-        // Flame particles have a chane of turning into smoke
-        if (Rnd(1.0f) < 0.05f)
-        {
-            aParticle.inAlpha = 0.f;
-            aParticle.inColor = glm::vec4{ 0.25f + Rnd(0.25f) };
-            aParticle.inPos.x *= 0.5f;
-            aParticle.inPos.z *= 0.5f;
-            aParticle.vel = { Rnd(1.f) - Rnd(1.f), mMinVel.y * 2 + Rnd(mMaxVel.y - mMinVel.y), Rnd(1.f) - Rnd(1.f), 0.f };
-            aParticle.inSize = 1.f + Rnd(0.5f);
-            aParticle.rotationSpeed = Rnd(1.f) - Rnd(1.f);
-            aParticle.inType = PARTICLE_TYPE_SMOKE;
-        }
-        else
+        const vkpp::WriteDescriptorSetInfo lWriteDescriptorSetInfo
         {
-            InitParticle(aParticle, mEmitterPos);
-        }
-        break;
+            mDescriptorSets.simulation, 0,
+            vkpp::DescriptorType::eStorageBuffer,
+            lParticleBufferInfo
+        };
 
-    case  PARTICLE_TYPE_SMOKE:
-        // Re-spawn at end of life.
-        InitParticle(aParticle, mEmitterPos);
-        break;
+        mLogicalDevice.UpdateDescriptorSet(lWriteDescriptorSetInfo);
     }
+
+    // Spawn every particle with a one-shot dispatch.
+    const vkpp::CommandBufferAllocateInfo lCmdBufferAllocateInfo
+    {
+        mCmdPool, 1
+    };
+
+    const auto& lCmdBuffer = mLogicalDevice.AllocateCommandBuffer(lCmdBufferAllocateInfo);
+
+    constexpr vkpp::CommandBufferBeginInfo lCmdBufferBeginInfo
+    {
+        vkpp::CommandBufferUsageFlagBits::eOneTimeSubmit
+    };
+
+    // Any non-zero seed spawns the particles; vary it per run like the time seed of the CPU path.
+    const auto lSeed = static_cast<uint32_t>(std::chrono::system_clock::now().time_since_epoch().count()) | 1u;
+
+    lCmdBuffer.Begin(lCmdBufferBeginInfo);
+    RecordSimulation(lCmdBuffer, lSeed);
+    lCmdBuffer.End();
+
+    const vkpp::SubmitInfo lSubmitInfo
+    {
+        lCmdBuffer
+    };
+
+    const auto lFence = mFencePool.Acquire();
+
+    mGraphicsQueue.handle.Submit(lSubmitInfo, lFence);
+    mFencePool.WaitAndRecycle(lFence);
+    mLogicalDevice.FreeCommandBuffer(mCmdPool, lCmdBuffer);
 }
 
 
-void ParticleFire::UpdateParticles(void)
+void ParticleFire::RecordSimulation(const vkpp::CommandBuffer& aCmdBuffer, uint32_t aSeed) const
 {
-    constexpr auto lParticleTimer = 0.0006f;
+    const auto& lSimulation = GetSimulationConstants(aSeed);
 
-    for (auto& lParticle : mParticleBuffer)
+    // The previous frame may still draw from the particles that are about to be overwritten.
+    const vkpp::BufferMemoryBarrier lDrawToSimulation
     {
-        switch (lParticle.inType)
-        {
-        case PARTICLE_TYPE_FLAME:
-            lParticle.inPos.y -= lParticle.vel.y * lParticleTimer * 3.5f;
-            lParticle.inAlpha += lParticleTimer * 0.25f;
-            lParticle.inSize -= lParticleTimer * 0.5f;
-            break;
-
-        case PARTICLE_TYPE_SMOKE:
-            lParticle.inPos -= lParticle.vel * lParticleTimer * 1.f;
-            lParticle.inAlpha += lParticleTimer * 1.25f;
-            lParticle.inSize += lParticleTimer * 0.125f;
-            lParticle.inColor -= lParticleTimer * 0.05f;
-            break;
-        }
+        vkpp::AccessFlagBits::eVertexAttributeRead, vkpp::AccessFlagBits::eShaderRead | vkpp::AccessFlagBits::eShaderWrite,
+        VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED,
+        mParticleBufferRes.buffer, 0, VK_WHOLE_SIZE
+    };
 
-        lParticle.inRotation += lParticleTimer * lParticle.rotationSpeed;
+    aCmdBuffer.PipelineBarrier(vkpp::PipelineStageFlagBits::eVertexInput, vkpp::PipelineStageFlagBits::eComputeShader, vkpp::DefaultFlags, lDrawToSimulation);
 
-        // Transition particle state
-        if (lParticle.inAlpha > 2.f)
-            TransitionParticle(lParticle);
-    }
+    aCmdBuffer.BindComputePipeline(mPipelines.simulation);
+    aCmdBuffer.BindComputeDescriptorSet(mComputePipelineLayout, 0, mDescriptorSets.simulation);
+    aCmdBuffer.PushConstants(mComputePipelineLayout, vkpp::ShaderStageFlagBits::eCompute, 0, sizeof(ParticleSimulation), &lSimulation);
+    aCmdBuffer.Dispatch((mParticleCount + PARTICLE_WORKGROUP_SIZE - 1) / PARTICLE_WORKGROUP_SIZE);
+
+    // Make the simulated particles visible to the vertex input of the particle draw.
+    const vkpp::BufferMemoryBarrier lSimulationToDraw
+    {
+        vkpp::AccessFlagBits::eShaderWrite, vkpp::AccessFlagBits::eVertexAttributeRead,
+        VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED,
+        mParticleBufferRes.buffer, 0, VK_WHOLE_SIZE
+    };
 
-    std::memcpy(mpParticleMapped, mParticleBuffer.data(), PARTICLE_BUFFER_SIZE);
+    aCmdBuffer.PipelineBarrier(vkpp::PipelineStageFlagBits::eComputeShader, vkpp::PipelineStageFlagBits::eVertexInput, vkpp::DefaultFlags, lSimulationToDraw);
 }
 
 
@@ -3,7 +3,15 @@
 
 
 
+#include <memory>
+
 #include <Base/ExampleBase.h>
+#include <Memory/DeviceAllocator.h>
+#include <Memory/UploadContext.h>
+#include <Type/DescriptorAllocator.h>
+#include <Type/DescriptorSetCache.h>
+#include <Type/GPUProfiler.h>
+#include <Type/PipelineStatistics.h>
 #include <Window/WindowEvent.h>
 #include <window/MouseEvent.h>
 
@@ -19,6 +27,8 @@
 
 #include <gli/gli.hpp>
 
+#include "ParticleSystem.h"
+
 
 
 namespace vkpp::sample
@@ -26,7 +36,8 @@ namespace vkpp::sample
 
 
 
-struct ParticleVtxData
+// Also the element of the particle storage buffer; aligned so that sizeof matches the std430 array stride in particle.comp.
+struct alignas(16) ParticleVtxData
 {
     glm::vec4 inPos;
     glm::vec4 inColor;
@@ -38,6 +49,7 @@ struct ParticleVtxData
     // Attributes not used in shader
     glm::vec4 vel;
     float rotationSpeed{ 0.f };
+    uint32_t rngState{ 0 };             // GPU simulation only.
 
     constexpr static vkpp::VertexInputBindingDescription GetBindingDescription(void)
     {
@@ -92,6 +104,8 @@ struct ParticleVtxData
     }
 };
 
+static_assert(sizeof(ParticleVtxData) == 80);
+
 
 
 struct NormalMapVtxData
@@ -172,15 +186,30 @@ struct UboVS
 
 
 
+// Push constants of particle.comp.
+struct ParticleSimulation
+{
+    glm::vec4 emitterPos;
+    glm::vec4 minVel;
+    glm::vec4 maxVel;
+    float flameRadius;
+    float timer;
+    uint32_t particleCount;
+    uint32_t seed;                      // Non-zero (re)spawns every particle.
+};
+
+
+
 class ParticleFire : public ExampleBase, private CWindowEvent, private CMouseMotionEvent, private CMouseWheelEvent
 {
 private:
     constexpr static float MINIMUM_ZOOM_LEVEL = 0.05f;
     constexpr static auto PARTICLE_COUNT = 512;
+    constexpr static uint32_t GPU_PARTICLE_COUNT = 256 * 1024;      // Bound by fill rate rather than by the simulation.
+    constexpr static uint32_t PARTICLE_WORKGROUP_SIZE = 256;        // Must match local_size_x of particle.comp.
     constexpr static auto PARTICLE_SIZE = 10.f;
-    constexpr static auto FLAME_RADIUS = 8.f;
-    constexpr static int32_t PARTICLE_TYPE_FLAME = 0;
-    constexpr static int32_t PARTICLE_TYPE_SMOKE = 1;
+
+    std::unique_ptr<vkpp::UploadContext> mUploadContext;
 
     vkpp::CommandPool mCmdPool;
     std::vector<vkpp::CommandBuffer> mDrawCmdBuffers;
@@ -190,19 +219,35 @@ private:
     std::vector<vkpp::Framebuffer> mFramebuffers;
     vkpp::DescriptorSetLayout mSetLayout;
     vkpp::PipelineLayout mPipelineLayout;
+    vkpp::DescriptorSetLayout mComputeSetLayout;
+    vkpp::PipelineLayout mComputePipelineLayout;
 
     struct 
     {
         vkpp::Pipeline particle;
         vkpp::Pipeline normalmap;
+        vkpp::Pipeline simulation;
     } mPipelines;
 
-    vkpp::DescriptorPool mDescriptorPool;
+    // Example uses one UBO and two image samplers per set, plus the particle storage buffer of the GPU simulation.
+    vkpp::DescriptorAllocator mDescriptorAllocator
+    {
+        mLogicalDevice,
+        {
+            { vkpp::DescriptorType::eUniformBuffer, 1.f },
+            { vkpp::DescriptorType::eCombinedImageSampler, 2.f },
+            { vkpp::DescriptorType::eStorageBuffer, .5f }
+        },
+        4
+    };
+
+    vkpp::DescriptorSetCache mDescriptorSetCache{ mLogicalDevice, mDescriptorAllocator };
 
     struct
     {
         vkpp::DescriptorSet particle;
         vkpp::DescriptorSet normalmap;
+        vkpp::DescriptorSet simulation;
     } mDescriptorSets;
 
     struct Texture
@@ -231,14 +276,21 @@ private:
     BufferResource mIdxBufferRes;
     uint32_t mIndexCount{ 0 };
 
-    const glm::vec3 mEmitterPos{ 0.f, -FLAME_RADIUS + 2.f, 0.f };
-    const glm::vec3 mMinVel{ -3.f, 0.5f, -3.f };
-    const glm::vec3 mMaxVel{ 3.f, 7.f, 3.f };
+    const ParticleEmitter mEmitter;
+
+    // The GPU simulation keeps the particles in a device-local storage buffer that the draw reads directly as vertex buffer.
+    // The CPU simulation is kept as the reference and writes into a host-visible copy every frame.
+    bool mSimulateOnGPU{ false };
+    uint32_t mParticleCount{ PARTICLE_COUNT };
 
     BufferResource mParticleBufferRes;
     void* mpParticleMapped{ nullptr };
-    std::array<ParticleVtxData, PARTICLE_COUNT> mParticleBuffer;
-    constexpr static std::size_t PARTICLE_BUFFER_SIZE = PARTICLE_COUNT * sizeof(ParticleVtxData);
+    std::unique_ptr<ParticleSystem> mParticleSystem;
+
+    // One frame slice per swapchain image; resolved after the image's fence has signaled.
+    std::unique_ptr<vkpp::GPUProfiler> mGPUProfiler;
+    std::unique_ptr<vkpp::PipelineStatisticsProfiler> mStatisticsProfiler;
+    std::vector<bool> mSubmittedImages;             // The wait fences start signaled, before anything was profiled.
 
     float mCurrentZoomLevel{ -100.f };
     glm::vec3 mCurrentRotation{ -15.f, 45.f, 0.0f };
@@ -255,8 +307,8 @@ private:
     void CreateSetLayouts(void);
     void CreatePipelineLayout(void);
     void CreatePipelines(void);
+    void CreateSimulationPipeline(void);
 
-    void CreateDescriptorPool(void);
     void AllocateDescriptorSets(void);
 
     void LoadTexture(const std::string& aFilename, vkpp::Format aTexFormat, Texture& aTexture, ImageResource& aTexRes) const;
@@ -274,22 +326,17 @@ private:
     void Update(void);
 
     void LoadModel(const std::string& aFilename);
-    void CopyBuffer(vkpp::Buffer& aDstBuffer, const Buffer& aSrcBuffer, DeviceSize aSize) const;
+    void AcquireUploads(void);
 
-    void InitParticle(ParticleVtxData& aParticle, const glm::vec3& aEmitterPos) const;
     void CreateParticles(void);
-    void TransitionParticle(ParticleVtxData& aParticle) const;
     void UpdateParticles(void);
 
-    template <vkpp::ImageLayout OldLayout, vkpp::ImageLayout NewLayout>
-    static void TransitionImageLayout(const vkpp::CommandBuffer& aCmdBuffer, const vkpp::Image& aImage, const vkpp::ImageSubresourceRange& aImageSubRange,
-        const vkpp::AccessFlags& aSrcAccessMask, const vkpp::AccessFlags& aDstAccessMask);
-
-    vkpp::CommandBuffer BeginOneTimeCmdBuffer(void) const;
-    void EndOneTimeCmdBuffer(const vkpp::CommandBuffer& aCmdBuffer) const;
+    ParticleSimulation GetSimulationConstants(uint32_t aSeed) const;
+    void CreateGPUParticles(void);
+    void RecordSimulation(const vkpp::CommandBuffer& aCmdBuffer, uint32_t aSeed) const;
 
 public:
-    ParticleFire(CWindow& aWindow, const char* apAppName, uint32_t aAppVersion, const char* apEngineName = nullptr, uint32_t aEngineVersion = 0);
+    ParticleFire(CWindow& aWindow, const char* apAppName, uint32_t aAppVersion, bool aSimulateOnGPU = true, const char* apEngineName = nullptr, uint32_t aEngineVersion = 0);
     virtual ~ParticleFire(void);
 };
 
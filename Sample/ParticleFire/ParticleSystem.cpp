@@ -0,0 +1,214 @@
+#include "ParticleFire.h"
+
+#include <cmath>
+#include <cassert>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#endif
+
+
+
+namespace vkpp::sample
+{
+
+
+
+namespace
+{
+
+
+
+// The few lane operations the update needs, so that one loop serves every instruction set.
+#if defined(__AVX__)
+
+using Lanes = __m256;
+constexpr uint32_t LANE_COUNT = 8;
+
+inline Lanes Load(const float* apData) { return _mm256_loadu_ps(apData); }
+inline void Store(float* apData, Lanes aValue) { _mm256_storeu_ps(apData, aValue); }
+inline Lanes Broadcast(float aValue) { return _mm256_set1_ps(aValue); }
+inline Lanes Add(Lanes aLhs, Lanes aRhs) { return _mm256_add_ps(aLhs, aRhs); }
+inline Lanes Sub(Lanes aLhs, Lanes aRhs) { return _mm256_sub_ps(aLhs, aRhs); }
+inline Lanes Mul(Lanes aLhs, Lanes aRhs) { return _mm256_mul_ps(aLhs, aRhs); }
+inline int GreaterMask(Lanes aLhs, Lanes aRhs) { return _mm256_movemask_ps(_mm256_cmp_ps(aLhs, aRhs, _CMP_GT_OQ)); }
+
+#elif defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+
+using Lanes = __m128;
+constexpr uint32_t LANE_COUNT = 4;
+
+inline Lanes Load(const float* apData) { return _mm_loadu_ps(apData); }
+inline void Store(float* apData, Lanes aValue) { _mm_storeu_ps(apData, aValue); }
+inline Lanes Broadcast(float aValue) { return _mm_set1_ps(aValue); }
+inline Lanes Add(Lanes aLhs, Lanes aRhs) { return _mm_add_ps(aLhs, aRhs); }
+inline Lanes Sub(Lanes aLhs, Lanes aRhs) { return _mm_sub_ps(aLhs, aRhs); }
+inline Lanes Mul(Lanes aLhs, Lanes aRhs) { return _mm_mul_ps(aLhs, aRhs); }
+inline int GreaterMask(Lanes aLhs, Lanes aRhs) { return _mm_movemask_ps(_mm_cmpgt_ps(aLhs, aRhs)); }
+
+#else
+
+using Lanes = float;
+constexpr uint32_t LANE_COUNT = 1;
+
+inline Lanes Load(const float* apData) { return *apData; }
+inline void Store(float* apData, Lanes aValue) { *apData = aValue; }
+inline Lanes Broadcast(float aValue) { return aValue; }
+inline Lanes Add(Lanes aLhs, Lanes aRhs) { return aLhs + aRhs; }
+inline Lanes Sub(Lanes aLhs, Lanes aRhs) { return aLhs - aRhs; }
+inline Lanes Mul(Lanes aLhs, Lanes aRhs) { return aLhs * aRhs; }
+inline int GreaterMask(Lanes aLhs, Lanes aRhs) { return aLhs > aRhs ? 1 : 0; }
+
+#endif
+
+
+
+}
+
+
+
+ParticleSystem::ParticleSystem(uint32_t aCount, const ParticleEmitter& aEmitter, uint32_t aSeed)
+    : mEmitter(aEmitter), mCount(aCount)
+{
+    const auto lPaddedCount = (aCount + LANE_COUNT - 1) / LANE_COUNT * LANE_COUNT;
+
+    for (auto lpAttribute : { &mPosX, &mPosY, &mPosZ, &mVelX, &mVelY, &mVelZ, &mColor, &mAlpha, &mSize, &mRotation, &mRotationSpeed, &mSmoke })
+        lpAttribute->resize(lPaddedCount, 0.f);
+
+    mRngState.resize(lPaddedCount);
+
+    for (uint32_t lIndex = 0; lIndex < mCount; ++lIndex)
+    {
+        // Xorshift never leaves a zero state, so keep every seed odd.
+        mRngState[lIndex] = (aSeed ^ (lIndex * 2654435769u)) | 1u;
+
+        InitParticle(lIndex);
+        mAlpha[lIndex] = 1.0f - std::abs(mPosY[lIndex]) / (mEmitter.radius * 2.f);
+    }
+}
+
+
+float ParticleSystem::Rnd(uint32_t aIndex, float aRange)
+{
+    auto lState = mRngState[aIndex];
+
+    lState ^= lState << 13;
+    lState ^= lState >> 17;
+    lState ^= lState << 5;
+
+    mRngState[aIndex] = lState;
+
+    // The top 24 bits fill the mantissa exactly.
+    return aRange * (static_cast<float>(lState >> 8) * (1.f / 16777216.f));
+}
+
+
+void ParticleSystem::InitParticle(uint32_t aIndex)
+{
+    mVelX[aIndex] = 0.f;
+    mVelY[aIndex] = mEmitter.minVel.y + Rnd(aIndex, mEmitter.maxVel.y - mEmitter.minVel.y);
+    mVelZ[aIndex] = 0.f;
+    mAlpha[aIndex] = Rnd(aIndex, 0.75f);
+    mSize[aIndex] = 1.0f + Rnd(aIndex, 0.5f);
+    mColor[aIndex] = 1.f;
+    mSmoke[aIndex] = 0.f;
+    mRotation[aIndex] = Rnd(aIndex, 2.f * float(M_PI));
+    mRotationSpeed[aIndex] = Rnd(aIndex, 2.f) - Rnd(aIndex, 2.f);
+
+    // Get Random sphere point
+    const auto lTheta = Rnd(aIndex, 2.f * float(M_PI));
+    const auto lPhi = Rnd(aIndex, float(M_PI)) - float(M_PI) / 2.f;
+    const auto lRadius = Rnd(aIndex, mEmitter.radius);
+
+    mPosX[aIndex] = mEmitter.position.x + lRadius * std::cos(lTheta) * std::cos(lPhi);
+    mPosY[aIndex] = mEmitter.position.y + lRadius * std::sin(lPhi);
+    mPosZ[aIndex] = mEmitter.position.z + lRadius * std::sin(lTheta) * std::cos(lPhi);
+}
+
+
+void ParticleSystem::TransitionParticle(uint32_t aIndex)
+{
+    // Flame particles have a chance of turning into smoke, everything else re-spawns at end of life.
+    if (mSmoke[aIndex] == 0.f && Rnd(aIndex, 1.0f) < 0.05f)
+    {
+        mAlpha[aIndex] = 0.f;
+        mColor[aIndex] = 0.25f + Rnd(aIndex, 0.25f);
+        mPosX[aIndex] *= 0.5f;
+        mPosZ[aIndex] *= 0.5f;
+        mVelX[aIndex] = Rnd(aIndex, 1.f) - Rnd(aIndex, 1.f);
+        mVelY[aIndex] = mEmitter.minVel.y * 2 + Rnd(aIndex, mEmitter.maxVel.y - mEmitter.minVel.y);
+        mVelZ[aIndex] = Rnd(aIndex, 1.f) - Rnd(aIndex, 1.f);
+        mSize[aIndex] = 1.f + Rnd(aIndex, 0.5f);
+        mRotationSpeed[aIndex] = Rnd(aIndex, 1.f) - Rnd(aIndex, 1.f);
+        mSmoke[aIndex] = 1.f;
+    }
+    else
+    {
+        InitParticle(aIndex);
+    }
+}
+
+
+void ParticleSystem::Update(float aTimer)
+{
+    // Flame only rises, 3.5 times as fast as smoke, and fades in while shrinking; smoke drifts along its velocity, grows and darkens.
+    const auto lTimer = Broadcast(aTimer);
+    const auto lFlameRise = Broadcast(aTimer * 3.5f);
+    const auto lSmokeRise = Broadcast(aTimer * 2.5f);
+    const auto lFlameFade = Broadcast(aTimer * 0.25f);
+    const auto lFlameShrink = Broadcast(aTimer * 0.5f);
+    const auto lSmokeGrowth = Broadcast(aTimer * 0.625f);
+    const auto lSmokeDarken = Broadcast(aTimer * 0.05f);
+    const auto lEndOfLife = Broadcast(2.f);
+
+    for (uint32_t lIndex = 0; lIndex < mCount; lIndex += LANE_COUNT)
+    {
+        const auto lSmoke = Load(mSmoke.data() + lIndex);
+        const auto lSmokeStep = Mul(lSmoke, lTimer);
+
+        Store(mPosX.data() + lIndex, Sub(Load(mPosX.data() + lIndex), Mul(Load(mVelX.data() + lIndex), lSmokeStep)));
+        Store(mPosY.data() + lIndex, Sub(Load(mPosY.data() + lIndex), Mul(Load(mVelY.data() + lIndex), Sub(lFlameRise, Mul(lSmoke, lSmokeRise)))));
+        Store(mPosZ.data() + lIndex, Sub(Load(mPosZ.data() + lIndex), Mul(Load(mVelZ.data() + lIndex), lSmokeStep)));
+
+        const auto lAlpha = Add(Load(mAlpha.data() + lIndex), Add(lFlameFade, lSmokeStep));
+        Store(mAlpha.data() + lIndex, lAlpha);
+
+        Store(mSize.data() + lIndex, Add(Load(mSize.data() + lIndex), Sub(Mul(lSmoke, lSmokeGrowth), lFlameShrink)));
+        Store(mColor.data() + lIndex, Sub(Load(mColor.data() + lIndex), Mul(lSmoke, lSmokeDarken)));
+        Store(mRotation.data() + lIndex, Add(Load(mRotation.data() + lIndex), Mul(lTimer, Load(mRotationSpeed.data() + lIndex))));
+
+        // Transitions are rare, so only those lanes leave the SIMD path.
+        auto lTransitionMask = GreaterMask(lAlpha, lEndOfLife);
+
+        for (auto lParticle = lIndex; lTransitionMask != 0 && lParticle < mCount; ++lParticle, lTransitionMask >>= 1)
+        {
+            if (lTransitionMask & 1)
+                TransitionParticle(lParticle);
+        }
+    }
+}
+
+
+void ParticleSystem::Write(ParticleVtxData* apVertices) const
+{
+    assert(apVertices != nullptr);
+
+    // The destination is usually write-combined mapped memory, so every vertex is written front to back and never read.
+    for (uint32_t lIndex = 0; lIndex < mCount; ++lIndex)
+    {
+        auto& lVertex = apVertices[lIndex];
+
+        lVertex.inPos = glm::vec4{ mPosX[lIndex], mPosY[lIndex], mPosZ[lIndex], 0.f };
+        lVertex.inColor = glm::vec4{ mColor[lIndex] };
+        lVertex.inAlpha = mAlpha[lIndex];
+        lVertex.inSize = mSize[lIndex];
+        lVertex.inRotation = mRotation[lIndex];
+        lVertex.inType = mSmoke[lIndex] != 0.f ? PARTICLE_TYPE_SMOKE : PARTICLE_TYPE_FLAME;
+    }
+}
+
+
+
+}                   // End of namespace vkpp::sample.
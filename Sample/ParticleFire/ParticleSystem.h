@@ -0,0 +1,86 @@
+#ifndef __VKPP_SAMPLE_PARTICLE_SYSTEM_H__
+#define __VKPP_SAMPLE_PARTICLE_SYSTEM_H__
+
+
+
+#include <vector>
+
+#include <glm/glm.hpp>
+
+
+
+namespace vkpp::sample
+{
+
+
+
+struct ParticleVtxData;
+
+
+
+// Where and how fast the particles of the fire spawn; shared by the CPU simulations and particle.comp.
+struct ParticleEmitter
+{
+    constexpr static float FLAME_RADIUS = 8.f;
+
+    glm::vec3 position{ 0.f, -FLAME_RADIUS + 2.f, 0.f };
+    glm::vec3 minVel{ -3.f, 0.5f, -3.f };
+    glm::vec3 maxVel{ 3.f, 7.f, 3.f };
+    float radius{ FLAME_RADIUS };
+};
+
+
+
+// CPU particle simulation keeping every attribute in its own array, so that the update runs over SIMD lanes (AVX, SSE or scalar, chosen at compile time).
+// The vertex layout is only produced when the particles are written into the mapped vertex buffer.
+class ParticleSystem
+{
+public:
+    constexpr static int32_t PARTICLE_TYPE_FLAME = 0;
+    constexpr static int32_t PARTICLE_TYPE_SMOKE = 1;
+    constexpr static float PARTICLE_TIMER = 0.0006f;
+
+private:
+    ParticleEmitter mEmitter;
+    uint32_t mCount{ 0 };
+
+    // Padded to a multiple of the SIMD width; the padding lanes are simulated but never respawned nor written out.
+    std::vector<float> mPosX;
+    std::vector<float> mPosY;
+    std::vector<float> mPosZ;
+    std::vector<float> mVelX;
+    std::vector<float> mVelY;
+    std::vector<float> mVelZ;
+    std::vector<float> mColor;                  // Every channel of inColor holds the same grey level.
+    std::vector<float> mAlpha;
+    std::vector<float> mSize;
+    std::vector<float> mRotation;
+    std::vector<float> mRotationSpeed;
+    std::vector<float> mSmoke;                  // 1 for smoke and 0 for flame, blends both updates without a branch.
+    std::vector<uint32_t> mRngState;            // Xorshift state per particle.
+
+    float Rnd(uint32_t aIndex, float aRange);
+    void InitParticle(uint32_t aIndex);
+    void TransitionParticle(uint32_t aIndex);
+
+public:
+    ParticleSystem(uint32_t aCount, const ParticleEmitter& aEmitter, uint32_t aSeed);
+
+    void Update(float aTimer = PARTICLE_TIMER);
+
+    // Interleave the particles into apVertices, which has to hold GetCount() vertices.
+    void Write(ParticleVtxData* apVertices) const;
+
+    uint32_t GetCount(void) const noexcept
+    {
+        return mCount;
+    }
+};
+
+
+
+}                   // End of namespace vkpp::sample.
+
+
+
+#endif              // __VKPP_SAMPLE_PARTICLE_SYSTEM_H__
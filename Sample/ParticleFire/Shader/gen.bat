@@ -2,6 +2,7 @@ glslangvalidator -V particle.frag -o SPV/particle.frag.spv
 glslangvalidator -V particle.vert -o SPV/particle.vert.spv
 glslangvalidator -V normalmap.frag -o SPV/normalmap.frag.spv
 glslangvalidator -V normalmap.vert -o SPV/normalmap.vert.spv
+glslangvalidator -V particle.comp -o SPV/particle.comp.spv
 
 
 
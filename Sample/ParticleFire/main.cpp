@@ -1,7 +1,10 @@
+#include <cstring>
+
 #include <System/Application.h>
 #include <Window/Window.h>
 
 #include "ParticleFire.h"
+#include "ParticleBenchmark.h"
 
 
 using namespace vkpp::sample;
@@ -10,17 +13,33 @@ using namespace vkpp::sample;
 
 namespace vkpp::sample
 {
-    CApplication& theApp = TheApp::Instance(CApplication::eVideo);
+    // Video is initialized in main, once it is known that a window is needed.
+    CApplication& theApp = TheApp::Instance(CApplication::eEvents);
 }
 
 
 
-int main(int /*argc*/, char* /*argv*/[])
+int main(int argc, char* argv[])
 {
+    // "--benchmark" only times the CPU simulations and needs no window nor device.
+    if (argc > 1 && std::strcmp(argv[1], "--benchmark") == 0)
+    {
+        for (auto lParticleCount : { 512u, 64u * 1024u, 1024u * 1024u })
+            RunParticleBenchmark(lParticleCount, 100);
+
+        return EXIT_SUCCESS;
+    }
+
+    // "--cpu" runs the CPU simulation instead of the compute shader.
+    const auto lSimulateOnGPU = !(argc > 1 && std::strcmp(argv[1], "--cpu") == 0);
+
+    if (!CApplication::InitSubSystem(CApplication::eVideo))
+        throw CInitException();
+
     constexpr auto lAppName = "Particle Fire";
     CWindow lWindow{ lAppName, CWindow::eCentered, CWindow::eCentered, 1024, 768, CWindow::eShown };
 
-    ParticleFire lParticleFire{ lWindow, lAppName, 1 };
+    ParticleFire lParticleFire{ lWindow, lAppName, 1, lSimulateOnGPU };
 
     theApp.Run();
 
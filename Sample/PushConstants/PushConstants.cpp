@@ -12,10 +12,10 @@ namespace vkpp::sample
 PushConstants::PushConstants(CWindow& aWindow, const char* apAppName, uint32_t aAppVersion, const char* apEngineName, uint32_t aEngineVersion)
     : ExampleBase(aWindow, apAppName, aAppVersion, apEngineName, aEngineVersion),
       CWindowEvent(aWindow), CMouseMotionEvent(aWindow), CMouseWheelEvent(aWindow),
-      mDepthRes(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mUBORes(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mVtxBufferRes(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mIdxBufferRes(mLogicalDevice, mPhysicalDeviceMemoryProperties)
+      mDepthRes(*mDeviceAllocator),
+      mUBORes(*mDeviceAllocator),
+      mVtxBufferRes(*mDeviceAllocator),
+      mIdxBufferRes(*mDeviceAllocator)
 {
     theApp.RegisterUpdateEvent([this](void)
     {
@@ -106,7 +106,6 @@ PushConstants::~PushConstants(void)
     mIdxBufferRes.Reset();
     mVtxBufferRes.Reset();
 
-    mLogicalDevice.UnmapMemory(mUBORes.memory);
     mUBORes.Reset();
 
     mLogicalDevice.DestroyDescriptorPool(mDescriptorPool);
@@ -389,7 +388,7 @@ void PushConstants::CreateUniformBuffer(void)
 
     mUBORes.Reset(lBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
 
-    mpMatrixUBOMapped = mLogicalDevice.MapMemory(mUBORes.memory, 0, sizeof(UBOVS));
+    mpMatrixUBOMapped = mUBORes.Map();
 }
 
 
@@ -498,12 +497,11 @@ void PushConstants::LoadModel(const std::string& aFilename)
         lVtxBufferSize, vkpp::BufferUsageFlagBits::eTransferSrc
     };
 
-    BufferResource lVtxStagingBuffer{ mLogicalDevice, mPhysicalDeviceMemoryProperties };
+    BufferResource lVtxStagingBuffer{ *mDeviceAllocator };
     lVtxStagingBuffer.Reset(lVtxStagingBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
 
-    auto lMappedMem = mLogicalDevice.MapMemory(lVtxStagingBuffer.memory, 0, lVtxBufferSize);
+    auto lMappedMem = lVtxStagingBuffer.Map();
     std::memcpy(lMappedMem, lVertexBuffer.data(), lVtxBufferSize);
-    mLogicalDevice.UnmapMemory(lVtxStagingBuffer.memory);
 
     // Index buffer
     const auto lIdxBufferSize = static_cast<uint32_t>(lIndexBuffer.size()) * sizeof(uint32_t);
@@ -512,12 +510,11 @@ void PushConstants::LoadModel(const std::string& aFilename)
         lIdxBufferSize, vkpp::BufferUsageFlagBits::eTransferSrc
     };
 
-    BufferResource lIdxStagingBuffer{ mLogicalDevice, mPhysicalDeviceMemoryProperties };
+    BufferResource lIdxStagingBuffer{ *mDeviceAllocator };
     lIdxStagingBuffer.Reset(lIdxStagingBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
 
-    lMappedMem = mLogicalDevice.MapMemory(lIdxStagingBuffer.memory, 0, lIdxBufferSize);
+    lMappedMem = lIdxStagingBuffer.Map();
     std::memcpy(lMappedMem, lIndexBuffer.data(), lIdxBufferSize);
-    mLogicalDevice.UnmapMemory(lIdxStagingBuffer.memory);
 
     // Create device local target buffers.
     // Vertex buffer
@@ -577,16 +574,13 @@ void PushConstants::EndOneTimeCmdBuffer(const vkpp::CommandBuffer& aCmdBuffer) c
 {
     aCmdBuffer.End();
 
-    constexpr vkpp::FenceCreateInfo lFenceCreateInfo;
-    const auto& lFence = mLogicalDevice.CreateFence(lFenceCreateInfo);
+    const auto lFence = mFencePool.Acquire();
 
     const vkpp::SubmitInfo lSubmitInfo{ aCmdBuffer };
 
     mGraphicsQueue.handle.Submit(lSubmitInfo, lFence);
 
-    mLogicalDevice.WaitForFence(lFence);
-
-    mLogicalDevice.DestroyFence(lFence);
+    mFencePool.WaitAndRecycle(lFence);
     mLogicalDevice.FreeCommandBuffer(mCmdPool, aCmdBuffer);
 }
 
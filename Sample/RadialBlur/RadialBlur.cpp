@@ -10,12 +10,12 @@ namespace vkpp::sample
 RadialBlur::RadialBlur(CWindow& aWindow, const char* apAppName, uint32_t aAppVersion, const char* apEngineName, uint32_t aEngineVersion)
     : ExampleBase(aWindow, apAppName, aAppVersion, apEngineName, aEngineVersion),
       CWindowEvent(aWindow), CMouseMotionEvent(aWindow), CMouseWheelEvent(aWindow),
-      mDepthRes(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mOffscreenFrame(mLogicalDevice, mPhysicalDeviceMemoryProperties, 512, 512, mSwapchain.surfaceFormat.format, vkpp::Format::eD32sFloat),
-      mUboScene(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mUboBlurParams(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mExample(mLogicalDevice, *this, mPhysicalDeviceMemoryProperties),
-      mTextureRes(mLogicalDevice, mPhysicalDeviceMemoryProperties)
+      mDepthRes(*mDeviceAllocator),
+      mOffscreenFrame(*mDeviceAllocator, 512, 512, mSwapchain.surfaceFormat.format, vkpp::Format::eD32sFloat),
+      mUboScene(*mDeviceAllocator),
+      mUboBlurParams(*mDeviceAllocator),
+      mExample(*mDeviceAllocator, *this),
+      mTextureRes(*mDeviceAllocator)
 {
     theApp.RegisterUpdateEvent([this](void)
     {
@@ -79,9 +79,6 @@ RadialBlur::~RadialBlur(void)
 
     mLogicalDevice.DestroySampler(mTextureSampler);
 
-    mLogicalDevice.UnmapMemory(mUboBlurParams.memory);
-    mLogicalDevice.UnmapMemory(mUboScene.memory);
-
     mUboBlurParams.Reset();
     mUboScene.Reset();
 
@@ -419,9 +416,9 @@ void RadialBlur::CreateUniformBuffers(void)
     lBufferCreateInfo.SetSize(sizeof(UBOBlurParams));
     mUboBlurParams.Reset(lBufferCreateInfo, lMemFlags);
 
-    mpUboSceneMapped = mLogicalDevice.MapMemory(mUboScene.memory);
+    mpUboSceneMapped = mUboScene.Map();
 
-    mpUboBlurParams = mLogicalDevice.MapMemory(mUboBlurParams.memory);
+    mpUboBlurParams = mUboBlurParams.Map();
     std::memcpy(mpUboBlurParams, &mBlurParams, sizeof(UBOBlurParams));
 }
 
@@ -466,12 +463,11 @@ void RadialBlur::LoadTexture(const std::string& aFilename, vkpp::Format aTexForm
         vkpp::BufferUsageFlagBits::eTransferSrc             // This buffer is used as a transfer source for the buffer copy.
     };
 
-    BufferResource lStagingBufferRes{ mLogicalDevice, mPhysicalDeviceMemoryProperties };
+    BufferResource lStagingBufferRes{ *mDeviceAllocator };
     lStagingBufferRes.Reset(lStagingBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
 
-    auto lMappedMem = mLogicalDevice.MapMemory(lStagingBufferRes.memory, 0, lTex2D.size());
+    auto lMappedMem = lStagingBufferRes.Map();
     std::memcpy(lMappedMem, lTex2D.data(), lTex2D.size());
-    mLogicalDevice.UnmapMemory(lStagingBufferRes.memory);
 
     // Setup buffer copy regions for each mip-level.
     std::vector<vkpp::BufferImageCopy> lBufferCopyRegions;
@@ -763,16 +759,13 @@ void RadialBlur::EndOneTimeCmdBuffer(const vkpp::CommandBuffer& aCmdBuffer) cons
 {
     aCmdBuffer.End();
 
-    constexpr vkpp::FenceCreateInfo lFenceCreateInfo;
-    const auto& lFence = mLogicalDevice.CreateFence(lFenceCreateInfo);
+    const auto lFence = mFencePool.Acquire();
 
     const vkpp::SubmitInfo lSubmitInfo{ aCmdBuffer };
 
     mGraphicsQueue.handle.Submit(lSubmitInfo, lFence);
 
-    mLogicalDevice.WaitForFence(lFence);
-
-    mLogicalDevice.DestroyFence(lFence);
+    mFencePool.WaitAndRecycle(lFence);
     mLogicalDevice.FreeCommandBuffer(mCmdPool, aCmdBuffer);
 }
 
@@ -956,12 +949,11 @@ void Model::LoadModel(const std::string& aFilename, float aScale)
         lVtxBufferSize, vkpp::BufferUsageFlagBits::eTransferSrc
     };
 
-    BufferResource lVtxStagingBuffer{ mLogicalDevice, mPhysicalDeviceMemoryProperties };
+    BufferResource lVtxStagingBuffer{ mDeviceAllocator };
     lVtxStagingBuffer.Reset(lVtxStagingBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
 
-    auto lMappedMem = mLogicalDevice.MapMemory(lVtxStagingBuffer.memory, 0, lVtxBufferSize);
+    auto lMappedMem = lVtxStagingBuffer.Map();
     std::memcpy(lMappedMem, lVertexBuffer.data(), lVtxBufferSize);
-    mLogicalDevice.UnmapMemory(lVtxStagingBuffer.memory);
 
     // Index buffer
     const auto lIdxBufferSize = static_cast<uint32_t>(lIndexBuffer.size()) * sizeof(uint32_t);
@@ -970,12 +962,11 @@ void Model::LoadModel(const std::string& aFilename, float aScale)
         lIdxBufferSize, vkpp::BufferUsageFlagBits::eTransferSrc
     };
 
-    BufferResource lIdxStagingBuffer{ mLogicalDevice, mPhysicalDeviceMemoryProperties };
+    BufferResource lIdxStagingBuffer{ mDeviceAllocator };
     lIdxStagingBuffer.Reset(lIdxStagingBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
 
-    lMappedMem = mLogicalDevice.MapMemory(lIdxStagingBuffer.memory, 0, lIdxBufferSize);
+    lMappedMem = lIdxStagingBuffer.Map();
     std::memcpy(lMappedMem, lIndexBuffer.data(), lIdxBufferSize);
-    mLogicalDevice.UnmapMemory(lIdxStagingBuffer.memory);
 
     // Create device local target buffers.
     // Vertex buffer
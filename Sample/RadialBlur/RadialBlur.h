@@ -103,9 +103,8 @@ struct VFrame
     // Semaphore used to synchronize between offscreen and final render pass.
     vkpp::Semaphore semaphore;
 
-    VFrame(const vkpp::LogicalDevice& aDevice, const vkpp::PhysicalDeviceMemoryProperties& aPhysicalDeviceMemoryProperties,
-        uint32_t aWidth, uint32_t aHeight, vkpp::Format aColorFormat, vkpp::Format aDepthFormat)
-        : mDevice(aDevice), color(aDevice, aPhysicalDeviceMemoryProperties), depth(aDevice, aPhysicalDeviceMemoryProperties), width(aWidth), height(aHeight)
+    VFrame(vkpp::DeviceAllocator& aAllocator, uint32_t aWidth, uint32_t aHeight, vkpp::Format aColorFormat, vkpp::Format aDepthFormat)
+        : mDevice(aAllocator.GetLogicalDevice()), color(aAllocator), depth(aAllocator), width(aWidth), height(aHeight)
     {
         // Color attachment
         vkpp::ImageCreateInfo lImageCreateInfo
@@ -255,15 +254,15 @@ class RadialBlur;
 struct Model
 {
     const vkpp::LogicalDevice& mLogicalDevice;
-    const vkpp::PhysicalDeviceMemoryProperties& mPhysicalDeviceMemoryProperties;
+    vkpp::DeviceAllocator& mDeviceAllocator;
     const RadialBlur& mRenderer;
 
     BufferResource mVtxBufferRes, mIdxBufferRes;
     uint32_t mIndexCount{ 0 };
 
-    Model(const vkpp::LogicalDevice& aDeivce, const RadialBlur& aRenderer, const vkpp::PhysicalDeviceMemoryProperties& aPhysicalDeviceMemoryProperties)
-        : mLogicalDevice(aDeivce), mPhysicalDeviceMemoryProperties(aPhysicalDeviceMemoryProperties), mRenderer(aRenderer),
-        mVtxBufferRes(aDeivce, aPhysicalDeviceMemoryProperties), mIdxBufferRes(aDeivce, aPhysicalDeviceMemoryProperties)
+    Model(vkpp::DeviceAllocator& aAllocator, const RadialBlur& aRenderer)
+        : mLogicalDevice(aAllocator.GetLogicalDevice()), mDeviceAllocator(aAllocator), mRenderer(aRenderer),
+        mVtxBufferRes(aAllocator), mIdxBufferRes(aAllocator)
     {}
 
     ~Model(void)
@@ -10,11 +10,11 @@ namespace vkpp::sample
 SpecializationConstants::SpecializationConstants(CWindow& aWindow, const char* apAppName, uint32_t aAppVersion, const char* apEngineName, uint32_t aEngineVersion)
     : ExampleBase(aWindow, apAppName, aAppVersion, apEngineName, aEngineVersion),
       CWindowEvent(aWindow), CMouseMotionEvent(aWindow), CMouseWheelEvent(aWindow),
-      mDepthRes(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mTextureRes(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mUBORes(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mVtxBufferRes(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mIdxBufferRes(mLogicalDevice, mPhysicalDeviceMemoryProperties)
+      mDepthRes(*mDeviceAllocator),
+      mTextureRes(*mDeviceAllocator),
+      mUBORes(*mDeviceAllocator),
+      mVtxBufferRes(*mDeviceAllocator),
+      mIdxBufferRes(*mDeviceAllocator)
 {
     theApp.RegisterUpdateEvent([this](void)
     {
@@ -105,7 +105,6 @@ SpecializationConstants::~SpecializationConstants()
     mIdxBufferRes.Reset();
     mVtxBufferRes.Reset();
 
-    mLogicalDevice.UnmapMemory(mUBORes.memory);
     mUBORes.Reset();
 
     mLogicalDevice.DestroySampler(mTextureSampler);
@@ -276,21 +275,37 @@ void SpecializationConstants::CreateGraphicsPipelines(void)
 
     // Each shader constant of a shader stage corresponds to one map entry.
     constexpr auto& lSpecializationMapEntries = SpecializationData::GetSpecializationMapEntries();
-    const vkpp::SpecializationInfo lSpecializationInfo
-    {
-        lSpecializationMapEntries, mSpecializationData
-    };
+
+    // The variants are compiled concurrently, so each one gets its own copy of the specialization data.
+    // Solid phong shading, phong and textured, textured discard.
+    std::array<SpecializationData, 3> lSpecializationData{ mSpecializationData, mSpecializationData, mSpecializationData };
+
+    for (uint32_t lIdx = 0; lIdx < lSpecializationData.size(); ++lIdx)
+        lSpecializationData[lIdx].lightingModel = lIdx;
+
+    const std::array<vkpp::SpecializationInfo, 3> lSpecializationInfos
+    { {
+        { lSpecializationMapEntries, lSpecializationData[0] },
+        { lSpecializationMapEntries, lSpecializationData[1] },
+        { lSpecializationMapEntries, lSpecializationData[2] }
+    } };
 
     // All pipelines will use the same "uber" shader and specialization constants to chnage branching and parameters of that shader.
     const auto& lVertexShader = CreateShaderModule("Shader/SPV/uber.vert.spv");
     const auto& lFragmentShader = CreateShaderModule("Shader/SPV/uber.frag.spv");
 
-    const std::array<vkpp::PipelineShaderStageCreateInfo, 2> lShaderStageCreateInfos
-    { {
-        { vkpp::ShaderStageFlagBits::eVertex, lVertexShader },
-        { vkpp::ShaderStageFlagBits::eFragment, lFragmentShader, lSpecializationInfo }  // Specialization info is assigned as part of the shader stage (module)
-                                                                                        // and must be set after creating the module and before creating the pipeline.
-    } };
+    std::vector<std::array<vkpp::PipelineShaderStageCreateInfo, 2>> lShaderStageCreateInfos;
+    lShaderStageCreateInfos.reserve(lSpecializationInfos.size());
+
+    for (const auto& lSpecializationInfo : lSpecializationInfos)
+    {
+        lShaderStageCreateInfos.push_back
+        ({ {
+            { vkpp::ShaderStageFlagBits::eVertex, lVertexShader },
+            { vkpp::ShaderStageFlagBits::eFragment, lFragmentShader, lSpecializationInfo }  // Specialization info is assigned as part of the shader stage (module)
+                                                                                            // and must be set after creating the module and before creating the pipeline.
+        } });
+    }
 
     constexpr auto lVertexInputBinding = VertexData::GetBindingDescription();
     constexpr auto lVertexAttributes = VertexData::GetAttributeDescriptions();
@@ -334,7 +349,7 @@ void SpecializationConstants::CreateGraphicsPipelines(void)
 
     const vkpp::GraphicsPipelineCreateInfo lGraphicsPipelineCreateInfo
     {
-        2, lShaderStageCreateInfos.data(),
+        2, lShaderStageCreateInfos[0].data(),
         lVertexInputStateCreateInfo.AddressOf(),
         lAssemblyStateCreateInfo.AddressOf(),
         nullptr,
@@ -349,17 +364,20 @@ void SpecializationConstants::CreateGraphicsPipelines(void)
         0
     };
 
-    // Solid phong shading
-    mSpecializationData.lightingModel = 0;
-    mPipelines.phong = mLogicalDevice.CreateGraphicsPipeline(lGraphicsPipelineCreateInfo);
+    std::vector<vkpp::GraphicsPipelineCreateInfo> lGraphicsPipelineCreateInfos(lShaderStageCreateInfos.size(), lGraphicsPipelineCreateInfo);
 
-    // Phong and textured
-    mSpecializationData.lightingModel = 1;
-    mPipelines.toon = mLogicalDevice.CreateGraphicsPipeline(lGraphicsPipelineCreateInfo);
+    for (std::size_t lIdx = 0; lIdx < lGraphicsPipelineCreateInfos.size(); ++lIdx)
+        lGraphicsPipelineCreateInfos[lIdx].SetShaderStages(lShaderStageCreateInfos[lIdx]);
 
-    // Textured discard.
-    mSpecializationData.lightingModel = 2;
-    mPipelines.textured = mLogicalDevice.CreateGraphicsPipeline(lGraphicsPipelineCreateInfo);
+    {
+        // Every variant is compiled on its own worker, into a worker cache merged back into the persisted one.
+        vkpp::PipelineCompiler lPipelineCompiler{ mLogicalDevice, mPipelineCacheStore.GetPipelineCache() };
+        auto lPipelines = lPipelineCompiler.Compile(lGraphicsPipelineCreateInfos);
+
+        mPipelines.phong = lPipelines[0].get();
+        mPipelines.toon = lPipelines[1].get();
+        mPipelines.textured = lPipelines[2].get();
+    }
 
     mLogicalDevice.DestroyShaderModule(lFragmentShader);
     mLogicalDevice.DestroyShaderModule(lVertexShader);
@@ -403,12 +421,11 @@ void SpecializationConstants::LoadTexture(const std::string& aFilename, vkpp::Fo
         vkpp::BufferUsageFlagBits::eTransferSrc             // This buffer is used as a transfer source for the buffer copy.
     };
 
-    BufferResource lStagingBufferRes{ mLogicalDevice, mPhysicalDeviceMemoryProperties };
+    BufferResource lStagingBufferRes{ *mDeviceAllocator };
     lStagingBufferRes.Reset(lStagingBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
 
-    auto lMappedMem = mLogicalDevice.MapMemory(lStagingBufferRes.memory, 0, lTex2D.size());
+    auto lMappedMem = lStagingBufferRes.Map();
     std::memcpy(lMappedMem, lTex2D.data(), lTex2D.size());
-    mLogicalDevice.UnmapMemory(lStagingBufferRes.memory);
 
     // Setup buffer copy regions for each mip-level.
     std::vector<vkpp::BufferImageCopy> lBufferCopyRegions;
@@ -539,7 +556,7 @@ void SpecializationConstants::CreateUniformBuffer(void)
 
     mUBORes.Reset(lBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
 
-    mpMatrixUBOMapped = mLogicalDevice.MapMemory(mUBORes.memory, 0, sizeof(UBOVS));
+    mpMatrixUBOMapped = mUBORes.Map();
 }
 
 
@@ -669,12 +686,11 @@ void SpecializationConstants::LoadModel(const std::string& aFilename)
         lVtxBufferSize, vkpp::BufferUsageFlagBits::eTransferSrc
     };
 
-    BufferResource lVtxStagingBuffer{ mLogicalDevice, mPhysicalDeviceMemoryProperties };
+    BufferResource lVtxStagingBuffer{ *mDeviceAllocator };
     lVtxStagingBuffer.Reset(lVtxStagingBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
 
-    auto lMappedMem = mLogicalDevice.MapMemory(lVtxStagingBuffer.memory, 0, lVtxBufferSize);
+    auto lMappedMem = lVtxStagingBuffer.Map();
     std::memcpy(lMappedMem, lVertexBuffer.data(), lVtxBufferSize);
-    mLogicalDevice.UnmapMemory(lVtxStagingBuffer.memory);
 
     // Index buffer
     const auto lIdxBufferSize = static_cast<uint32_t>(lIndexBuffer.size()) * sizeof(uint32_t);
@@ -683,12 +699,11 @@ void SpecializationConstants::LoadModel(const std::string& aFilename)
         lIdxBufferSize, vkpp::BufferUsageFlagBits::eTransferSrc
     };
 
-    BufferResource lIdxStagingBuffer{ mLogicalDevice, mPhysicalDeviceMemoryProperties };
+    BufferResource lIdxStagingBuffer{ *mDeviceAllocator };
     lIdxStagingBuffer.Reset(lIdxStagingBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
 
-    lMappedMem = mLogicalDevice.MapMemory(lIdxStagingBuffer.memory, 0, lIdxBufferSize);
+    lMappedMem = lIdxStagingBuffer.Map();
     std::memcpy(lMappedMem, lIndexBuffer.data(), lIdxBufferSize);
-    mLogicalDevice.UnmapMemory(lIdxStagingBuffer.memory);
 
     // Create device local target buffers.
     // Vertex buffer
@@ -870,16 +885,13 @@ void SpecializationConstants::EndOneTimeCmdBuffer(const vkpp::CommandBuffer& aCm
 {
     aCmdBuffer.End();
 
-    constexpr vkpp::FenceCreateInfo lFenceCreateInfo;
-    const auto& lFence = mLogicalDevice.CreateFence(lFenceCreateInfo);
+    const auto lFence = mFencePool.Acquire();
 
     const vkpp::SubmitInfo lSubmitInfo{ aCmdBuffer };
 
     mGraphicsQueue.handle.Submit(lSubmitInfo, lFence);
 
-    mLogicalDevice.WaitForFence(lFence);
-
-    mLogicalDevice.DestroyFence(lFence);
+    mFencePool.WaitAndRecycle(lFence);
     mLogicalDevice.FreeCommandBuffer(mCmdPool, aCmdBuffer);
 }
 
@@ -4,6 +4,8 @@
 
 
 #include <Base/ExampleBase.h>
+#include <Type/PipelineCacheStore.h>
+#include <Type/PipelineCompiler.h>
 #include <Window/WindowEvent.h>
 #include <window/MouseEvent.h>
 
@@ -131,6 +133,8 @@ private:
 
     SpecializationData mSpecializationData;
 
+    vkpp::PipelineCacheStore mPipelineCacheStore{ mLogicalDevice, mPhysicalDeviceProperties, "SpecializationConstants.cache" };
+
     struct
     {
         vkpp::Pipeline phong;
@@ -0,0 +1,21 @@
+#version 450
+
+#extension GL_ARB_separate_shader_objects : enable
+#extension GL_ARB_shading_language_420pack : enable
+
+// Bindless variant of background.frag: the texture is picked from the vkpp::BindlessTable set by a push constant handle.
+layout (set = 1, binding = 0) uniform sampler2D textures[64];
+
+layout (push_constant) uniform PushConsts
+{
+	uint texture;
+} pushConsts;
+
+layout (location = 0) in vec2 inUV;
+
+layout (location = 0) out vec4 outFragColor;
+
+void main() 
+{
+	outFragColor = texture(textures[pushConsts.texture], inUV);	
+}
\ No newline at end of file
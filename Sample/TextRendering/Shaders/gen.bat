@@ -4,3 +4,5 @@ glslangvalidator -V mesh.vert -o mesh.SPV/vert.spv
 glslangvalidator -V mesh.frag -o mesh.SPV/frag.spv
 glslangvalidator -V background.vert -o SPV/background.vert.spv
 glslangvalidator -V background.frag -o SPV/background.frag.spv
+glslangvalidator -V background_bindless.frag -o SPV/background_bindless.frag.spv
+glslangvalidator -V mesh_bindless.frag -o SPV/mesh_bindless.frag.spv
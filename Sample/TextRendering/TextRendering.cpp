@@ -1,5 +1,6 @@
 #include "TextRendering.h"
 #include <fstream>
+#include <iostream>
 #include <sstream>
 #include <iomanip>
 
@@ -10,12 +11,12 @@ namespace vkpp::sample
 
 
 
-TextRenderer::TextRenderer(const DeviceQueue& aGraphicsQueue, const LogicalDevice& aLogicalDevice, const vkpp::PhysicalDeviceMemoryProperties& aPhysicalDeviceMemoryProperties, const std::vector<vkpp::Framebuffer>& aFramebuffers,
+TextRenderer::TextRenderer(const DeviceQueue& aGraphicsQueue, const LogicalDevice& aLogicalDevice, vkpp::DeviceAllocator& aDeviceAllocator, vkpp::FencePool& aFencePool, const std::vector<vkpp::Framebuffer>& aFramebuffers,
         const vkpp::Format aColorFormat, const uint32_t aFramebufferWidth, const uint32_t aFramebufferHeight)
-    : mGraphicsQueue(aGraphicsQueue), mLogicalDevice(aLogicalDevice), mPhysicalDeviceMemoryProperties(aPhysicalDeviceMemoryProperties), mFramebuffers(aFramebuffers), mColorFormat(aColorFormat),
+    : mGraphicsQueue(aGraphicsQueue), mLogicalDevice(aLogicalDevice), mDeviceAllocator(aDeviceAllocator), mFencePool(aFencePool), mFramebuffers(aFramebuffers), mColorFormat(aColorFormat),
       mFramebufferWidth(aFramebufferWidth), mFramebufferHeight(aFramebufferHeight),
-      mBufferRes(aLogicalDevice, aPhysicalDeviceMemoryProperties),
-      mImgRes(aLogicalDevice, aPhysicalDeviceMemoryProperties)
+      mBufferRes(aDeviceAllocator),
+      mImgRes(aDeviceAllocator)
 {
     CreateCmdPool();
     AllocateCmdBuffers();
@@ -50,6 +51,7 @@ TextRenderer::~TextRenderer(void)
     mLogicalDevice.DestroySampler(mSampler);
 
     mImgRes.Reset();
+
     mBufferRes.Reset();
 
     mLogicalDevice.DestroyDescriptorPool(mDescriptorPool);
@@ -260,6 +262,9 @@ void TextRenderer::CreateVertexBuffer(void)
     constexpr vkpp::BufferCreateInfo lBufferCreateInfo{ lBufferSize, vkpp::BufferUsageFlagBits::eVertexBuffer };
 
     mBufferRes.Reset(lBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
+
+    // Host coherent, so map once and never flush.
+    mpVertexData = mBufferRes.Map<TextVertexData>();
 }
 
 
@@ -290,7 +295,7 @@ void TextRenderer::CreateFontTexture(void)
     mImgRes.Reset(lImageCreateInfo, lImageViewCreateInfo, vkpp::MemoryPropertyFlagBits::eDeviceLocal);
 
     // Staging
-    BufferResource lStagingBuffer{ mLogicalDevice, mPhysicalDeviceMemoryProperties };
+    BufferResource lStagingBuffer{ mDeviceAllocator };
 
     const vkpp::BufferCreateInfo lBufferCreateInfo{ mImgRes.memSize, vkpp::BufferUsageFlagBits::eTransferSrc };
     lStagingBuffer.Reset(lBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
@@ -301,7 +306,6 @@ void TextRenderer::CreateFontTexture(void)
     STB_FONT_NAME(mSTBFontData, lFont24Pixels, STB_FONT_HEIGHT);
 
     std::memcpy(lpMappedMem, &lFont24Pixels[0][0], STB_FONT_WIDTH * STB_FONT_HEIGHT);
-    lStagingBuffer.Unmap();
 
     // Copy to font texture
     const auto& lCopyCmd = BeginOneTimeCmdBuffer();
@@ -422,30 +426,26 @@ void TextRenderer::EndOneTimeCmdBuffer(const vkpp::CommandBuffer& aCmdBuffer) co
 {
     aCmdBuffer.End();
 
-    constexpr vkpp::FenceCreateInfo lFenceCreateInfo;
-    const auto& lFence = mLogicalDevice.CreateFence(lFenceCreateInfo);
+    const auto lFence = mFencePool.Acquire();
 
     const vkpp::SubmitInfo lSubmitInfo{ aCmdBuffer };
 
     mGraphicsQueue.handle.Submit(lSubmitInfo, lFence);
 
-    mLogicalDevice.WaitForFence(lFence);
-
-    mLogicalDevice.DestroyFence(lFence);
+    mFencePool.WaitAndRecycle(lFence);
     mLogicalDevice.FreeCommandBuffer(mCmdPool, aCmdBuffer);
 }
 
 
 void TextRenderer::BeginTextUpdate(void)
 {
-    mpMapped = mBufferRes.Map<TextVertexData>();
+    mpMapped = mpVertexData;
     mNumLetters = 0;
 }
 
 
 void TextRenderer::EndTextUpdate(void)
 {
-    mBufferRes.Unmap();
     mpMapped = nullptr;
     BuildCmdBuffers();
 }
@@ -622,12 +622,12 @@ SceneRenderer::SceneRenderer(CWindow& aWindow, const char* apAppName, uint32_t a
     : ExampleBase(aWindow, apAppName, aAppVersion, apEngineName, aEngineVersion),
       mTile(apAppName),
       CWindowEvent{aWindow}, CMouseMotionEvent{aWindow}, CMouseWheelEvent{aWindow},
-      mDepthRes(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mUboScene(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mBkTexRes(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mCubeTexRes(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mVtxBufferRes(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mIdxBufferRes(mLogicalDevice, mPhysicalDeviceMemoryProperties)
+      mDepthRes(*mDeviceAllocator),
+      mUboScene(*mDeviceAllocator),
+      mBkTexRes(*mDeviceAllocator),
+      mCubeTexRes(*mDeviceAllocator),
+      mVtxBufferRes(*mDeviceAllocator),
+      mIdxBufferRes(*mDeviceAllocator)
 {
     theApp.RegisterUpdateEvent([this](void)
     {
@@ -679,7 +679,7 @@ SceneRenderer::SceneRenderer(CWindow& aWindow, const char* apAppName, uint32_t a
     CreateSemaphores();
     CreateFences();
 
-    mTextRenderer = std::make_unique<TextRenderer>(mGraphicsQueue, mLogicalDevice, mPhysicalDeviceMemoryProperties, mFramebuffers,
+    mTextRenderer = std::make_unique<TextRenderer>(mGraphicsQueue, mLogicalDevice, *mDeviceAllocator, mFencePool, mFramebuffers,
         mSwapchain.surfaceFormat.format, mSwapchain.extent.width, mSwapchain.extent.height);
 }
 
@@ -701,10 +701,10 @@ SceneRenderer::~SceneRenderer(void)
     mCubeTexRes.Reset();
     mBkTexRes.Reset();
 
-    mUboScene.Unmap();
     mUboScene.Reset();
 
     mLogicalDevice.DestroyDescriptorPool(mDescriptorPool);
+    mBindlessTable.reset();
 
     mLogicalDevice.DestroyPipeline(mPipelines.cube);
     mLogicalDevice.DestroyPipeline(mPipelines.background);
@@ -868,13 +868,41 @@ void SceneRenderer::CreateSetLayouts(void)
 
     auto& lBkSetLayoutBinding = lSetLayoutBindings[1];
     mSetLayouts.background = mLogicalDevice.CreateDescriptorSetLayout(lBkSetLayoutBinding);
+
+    // The bindless shaders are not shipped prebuilt; until Shaders/gen.bat has compiled them, keep one descriptor set per texture.
+    const auto lHasBindlessShaders = std::ifstream{ "Shaders/SPV/background_bindless.frag.spv" }.good()
+        && std::ifstream{ "Shaders/SPV/mesh_bindless.frag.spv" }.good();
+
+    if (mDescriptorIndexingEnabled && !lHasBindlessShaders)
+        std::cerr << "Shaders/SPV/*_bindless.frag.spv are missing: compile them with Shaders/gen.bat to use the bindless table." << std::endl;
+
+    // The scene only samples images; the table still needs one buffer slot.
+    if (mDescriptorIndexingEnabled && lHasBindlessShaders)
+        mBindlessTable = std::make_unique<vkpp::BindlessTable>(mLogicalDevice, BINDLESS_IMAGE_CAPACITY, 1, vkpp::ShaderStageFlagBits::eFragment);
 }
 
 
 void SceneRenderer::CreatePipelineLayout(void)
 {
-    mPipelineLayouts.cube = mLogicalDevice.CreatePipelineLayout(mSetLayouts.cube);
-    mPipelineLayouts.background = mLogicalDevice.CreatePipelineLayout(mSetLayouts.background);
+    if (!mBindlessTable)
+    {
+        mPipelineLayouts.cube = mLogicalDevice.CreatePipelineLayout(mSetLayouts.cube);
+        mPipelineLayouts.background = mLogicalDevice.CreatePipelineLayout(mSetLayouts.background);
+
+        return;
+    }
+
+    // Set 1 is the bindless table and the push constant holds the handle of the texture to sample from it.
+    constexpr vkpp::PushConstantRange lPushConstantRange
+    {
+        vkpp::ShaderStageFlagBits::eFragment, 0, sizeof(vkpp::BindlessTable::Handle)
+    };
+
+    const std::array<vkpp::DescriptorSetLayout, 2> lCubeSetLayouts{ mSetLayouts.cube, mBindlessTable->GetSetLayout() };
+    mPipelineLayouts.cube = mLogicalDevice.CreatePipelineLayout({ lCubeSetLayouts, lPushConstantRange });
+
+    const std::array<vkpp::DescriptorSetLayout, 2> lBkSetLayouts{ mSetLayouts.background, mBindlessTable->GetSetLayout() };
+    mPipelineLayouts.background = mLogicalDevice.CreatePipelineLayout({ lBkSetLayouts, lPushConstantRange });
 }
 
 
@@ -936,7 +964,7 @@ void SceneRenderer::CreateGraphicsPipelines(void)
 
     // Background rendering pipeline
     lVertexShaderModule = CreateShaderModule("Shaders/SPV/background.vert.spv");
-    lFragmentShaderModule = CreateShaderModule("Shaders/SPV/background.frag.spv");
+    lFragmentShaderModule = CreateShaderModule(mBindlessTable ? "Shaders/SPV/background_bindless.frag.spv" : "Shaders/SPV/background.frag.spv");
     mPipelines.background = mLogicalDevice.CreateGraphicsPipeline(lGraphicsPipelineCreateInfo);
 
     mLogicalDevice.DestroyShaderModule(lFragmentShaderModule);
@@ -952,7 +980,7 @@ void SceneRenderer::CreateGraphicsPipelines(void)
     lDepthStencilStateCreateInfo.EnableDepthTest();
     lGraphicsPipelineCreateInfo.SetLayout(mPipelineLayouts.cube);
     lVertexShaderModule = CreateShaderModule("Shaders/SPV/mesh.vert.spv");
-    lFragmentShaderModule = CreateShaderModule("Shaders/SPV/mesh.frag.spv");
+    lFragmentShaderModule = CreateShaderModule(mBindlessTable ? "Shaders/SPV/mesh_bindless.frag.spv" : "Shaders/SPV/mesh.frag.spv");
     mPipelines.cube = mLogicalDevice.CreateGraphicsPipeline(lGraphicsPipelineCreateInfo);
 
     mLogicalDevice.DestroyShaderModule(lFragmentShaderModule);
@@ -1035,12 +1063,11 @@ void SceneRenderer::LoadTexture(const std::string& aFilename, vkpp::Format aTexF
         vkpp::BufferUsageFlagBits::eTransferSrc
     };
 
-    BufferResource lStagingBuffer{ mLogicalDevice, mPhysicalDeviceMemoryProperties };
+    BufferResource lStagingBuffer{ *mDeviceAllocator };
     lStagingBuffer.Reset(lStagingBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
 
     auto lpMappedMem = lStagingBuffer.Map();
     std::memcpy(lpMappedMem, lTex2D.data(), lTex2D.size());
-    lStagingBuffer.Unmap();
 
     // Setup buffer copy regions for each mip-level.
     std::vector<vkpp::BufferImageCopy> lBufferCopyRegions;
@@ -1198,6 +1225,12 @@ void SceneRenderer::UpdateDescriptorSets(void)
     };
 
     mLogicalDevice.UpdateDescriptorSet(lBkWriteDescriptorSetInfo);
+
+    if (mBindlessTable)
+    {
+        mTextureHandles.background = mBindlessTable->AddImage(lBkTexSampler);
+        mTextureHandles.cube = mBindlessTable->AddImage(lCubeTexSampler);
+    }
 }
 
 
@@ -1272,12 +1305,11 @@ void SceneRenderer::LoadModel(const std::string& aFilename)
         lVtxBufferSize, vkpp::BufferUsageFlagBits::eTransferSrc
     };
 
-    BufferResource lVtxStagingBuffer{ mLogicalDevice, mPhysicalDeviceMemoryProperties };
+    BufferResource lVtxStagingBuffer{ *mDeviceAllocator };
     lVtxStagingBuffer.Reset(lVtxStagingBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
 
-    auto lMappedMem = mLogicalDevice.MapMemory(lVtxStagingBuffer.memory, 0, lVtxBufferSize);
+    auto lMappedMem = lVtxStagingBuffer.Map();
     std::memcpy(lMappedMem, lVertexBuffer.data(), lVtxBufferSize);
-    mLogicalDevice.UnmapMemory(lVtxStagingBuffer.memory);
 
     // Index buffer
     const auto lIdxBufferSize = static_cast<uint32_t>(lIndexBuffer.size()) * sizeof(uint32_t);
@@ -1286,12 +1318,11 @@ void SceneRenderer::LoadModel(const std::string& aFilename)
         lIdxBufferSize, vkpp::BufferUsageFlagBits::eTransferSrc
     };
 
-    BufferResource lIdxStagingBuffer{ mLogicalDevice, mPhysicalDeviceMemoryProperties };
+    BufferResource lIdxStagingBuffer{ *mDeviceAllocator };
     lIdxStagingBuffer.Reset(lIdxStagingBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
 
-    lMappedMem = mLogicalDevice.MapMemory(lIdxStagingBuffer.memory, 0, lIdxBufferSize);
+    lMappedMem = lIdxStagingBuffer.Map();
     std::memcpy(lMappedMem, lIndexBuffer.data(), lIdxBufferSize);
-    mLogicalDevice.UnmapMemory(lIdxStagingBuffer.memory);
 
     // Create device local target buffers.
     // Vertex buffer
@@ -1327,6 +1358,17 @@ void SceneRenderer::CopyBuffer(vkpp::Buffer& aDstBuffer, const Buffer& aSrcBuffe
 }
 
 
+void SceneRenderer::BindBindlessTexture(const vkpp::CommandBuffer& aCmdBuffer, const vkpp::PipelineLayout& aPipelineLayout, const vkpp::BindlessTable::Handle& aHandle) const
+{
+    if (!mBindlessTable)
+        return;
+
+    // The two pipeline layouts differ at set 0, so the table and the handle are bound again for each of them.
+    aCmdBuffer.BindGraphicsDescriptorSet(aPipelineLayout, 1, mBindlessTable->GetDescriptorSet());
+    aCmdBuffer.PushConstants(aPipelineLayout, vkpp::ShaderStageFlagBits::eFragment, 0, sizeof(aHandle), &aHandle);
+}
+
+
 void SceneRenderer::BuildCmdBuffers(void)
 {
     constexpr vkpp::CommandBufferBeginInfo lCmdBufferBeginInfo;
@@ -1375,6 +1417,7 @@ void SceneRenderer::BuildCmdBuffers(void)
         // Background
         lDrawCmdBuffer.BindGraphicsPipeline(mPipelines.background);
         lDrawCmdBuffer.BindGraphicsDescriptorSet(mPipelineLayouts.background, 0, mDescriptorSets.background);
+        BindBindlessTexture(lDrawCmdBuffer, mPipelineLayouts.background, mTextureHandles.background);
         lDrawCmdBuffer.Draw(4);
 
         // Cube
@@ -1382,6 +1425,7 @@ void SceneRenderer::BuildCmdBuffers(void)
         lDrawCmdBuffer.BindIndexBuffer(mIdxBufferRes.buffer);
         lDrawCmdBuffer.BindGraphicsPipeline(mPipelines.cube);
         lDrawCmdBuffer.BindGraphicsDescriptorSet(mPipelineLayouts.cube, 0, mDescriptorSets.cube);
+        BindBindlessTexture(lDrawCmdBuffer, mPipelineLayouts.cube, mTextureHandles.cube);
         lDrawCmdBuffer.DrawIndexed(mIndexCount);
 
         lDrawCmdBuffer.EndRenderPass();
@@ -1433,16 +1477,13 @@ void SceneRenderer::EndOneTimeCmdBuffer(const vkpp::CommandBuffer& aCmdBuffer) c
 {
     aCmdBuffer.End();
 
-    constexpr vkpp::FenceCreateInfo lFenceCreateInfo;
-    const auto& lFence = mLogicalDevice.CreateFence(lFenceCreateInfo);
+    const auto lFence = mFencePool.Acquire();
 
     const vkpp::SubmitInfo lSubmitInfo{ aCmdBuffer };
 
     mGraphicsQueue.handle.Submit(lSubmitInfo, lFence);
 
-    mLogicalDevice.WaitForFence(lFence);
-
-    mLogicalDevice.DestroyFence(lFence);
+    mFencePool.WaitAndRecycle(lFence);
     mLogicalDevice.FreeCommandBuffer(mCmdPool, aCmdBuffer);
 }
 
@@ -5,6 +5,7 @@
 
 #include <memory>
 #include <Base/ExampleBase.h>
+#include <Type/BindlessTable.h>
 #include <Window/WindowEvent.h>
 #include <Window/MouseEvent.h>
 
@@ -83,7 +84,8 @@ private:
 
     const DeviceQueue& mGraphicsQueue;
     const vkpp::LogicalDevice& mLogicalDevice;
-    const vkpp::PhysicalDeviceMemoryProperties& mPhysicalDeviceMemoryProperties;
+    vkpp::DeviceAllocator& mDeviceAllocator;
+    vkpp::FencePool& mFencePool;
     const std::vector<vkpp::Framebuffer>& mFramebuffers;
     const vkpp::Format mColorFormat;
     const uint32_t mFramebufferWidth, mFramebufferHeight;
@@ -103,7 +105,8 @@ private:
     ImageResource mImgRes;
     vkpp::Sampler mSampler;
 
-    // Pointer to mapped vertex buffer.
+    // The vertex buffer stays mapped for the renderer's lifetime; mpMapped is the write cursor into it.
+    TextVertexData* mpVertexData{ nullptr };
     TextVertexData* mpMapped{ nullptr };
 
     stb_fontchar mSTBFontData[STB_NUM_CHARS];
@@ -145,7 +148,7 @@ private:
 
 public:
     // TextRenderer(CWindow& aWindow, const char* apAppName, uint32_t aAppVersion, const char* apEngineName = nullptr, uint32_t aEngineVersion = 0);
-    TextRenderer(const DeviceQueue& aGraphicsQueue, const LogicalDevice& aLogicalDevice, const vkpp::PhysicalDeviceMemoryProperties& aPhysicalDeviceMemoryProperties, const std::vector<vkpp::Framebuffer>& aFramebuffers,
+    TextRenderer(const DeviceQueue& aGraphicsQueue, const LogicalDevice& aLogicalDevice, vkpp::DeviceAllocator& aDeviceAllocator, vkpp::FencePool& aFencePool, const std::vector<vkpp::Framebuffer>& aFramebuffers,
         const vkpp::Format aColorFormat, const uint32_t aFramebufferWidth, const uint32_t aFramebufferHeight);
     virtual ~TextRenderer(void);
 
@@ -212,6 +215,7 @@ class SceneRenderer : public ExampleBase, private CWindowEvent, private CMouseMo
 {
 private:
     constexpr static float MINIMUM_ZOOM_LEVEL = 0.05f;
+    constexpr static uint32_t BINDLESS_IMAGE_CAPACITY = 64;     // Size of the textures array in the *_bindless.frag shaders.
 
     const std::string mTile;
 
@@ -270,6 +274,15 @@ private:
 
     vkpp::Sampler mTextureSampler;
 
+    // Only created when the device enables descriptor indexing; the pipelines then read the textures from it at set 1.
+    std::unique_ptr<vkpp::BindlessTable> mBindlessTable;
+
+    struct
+    {
+        vkpp::BindlessTable::Handle background{ vkpp::BindlessTable::InvalidHandle };
+        vkpp::BindlessTable::Handle cube{ vkpp::BindlessTable::InvalidHandle };
+    } mTextureHandles;
+
     BufferResource mVtxBufferRes;
     BufferResource mIdxBufferRes;
     uint32_t mIndexCount{ 0 };
@@ -301,6 +314,7 @@ private:
     void LoadModel(const std::string& aFilename);
     void CopyBuffer(vkpp::Buffer& aDstBuffer, const Buffer& aSrcBuffer, DeviceSize aSize) const;
 
+    void BindBindlessTexture(const vkpp::CommandBuffer& aCmdBuffer, const vkpp::PipelineLayout& aPipelineLayout, const vkpp::BindlessTable::Handle& aHandle) const;
     void BuildCmdBuffers(void);
 
     void CreateSemaphores(void);
@@ -10,11 +10,11 @@ namespace vkpp::sample
 TexturedArray::TexturedArray(CWindow& aWindow, const char* apAppName, uint32_t aAppVersion, const char* apEngingName, uint32_t aEngineVersion)
     : ExampleBase(aWindow, apAppName, aAppVersion, apEngingName, aEngineVersion),
       CWindowEvent(aWindow), CMouseMotionEvent(aWindow), CMouseWheelEvent(aWindow),
-      mDepthRes(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mTextureRes(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mVertexBufferRes(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mIndexBufferRes(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mUBORes(mLogicalDevice, mPhysicalDeviceMemoryProperties)
+      mDepthRes(*mDeviceAllocator),
+      mTextureRes(*mDeviceAllocator),
+      mVertexBufferRes(*mDeviceAllocator),
+      mIndexBufferRes(*mDeviceAllocator),
+      mUBORes(*mDeviceAllocator)
 {
     theApp.RegisterUpdateEvent([this](void)
     {
@@ -105,8 +105,6 @@ TexturedArray::~TexturedArray(void)
 
     mLogicalDevice.DestroyFences(mWaitFences);
 
-    mLogicalDevice.UnmapMemory(mUBORes.memory);
-
     mUBORes.Reset();
 
     mIndexBufferRes.Reset();
@@ -429,12 +427,11 @@ void TexturedArray::LoadTexture(const std::string& aFilename, vkpp::Format aForm
         lTex2DArray.size(), vkpp::BufferUsageFlagBits::eTransferSrc
     };
 
-    BufferResource lStagingBufferRes{ mLogicalDevice, mPhysicalDeviceMemoryProperties };
+    BufferResource lStagingBufferRes{ *mDeviceAllocator };
     lStagingBufferRes.Reset(lStagingBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
 
-    auto lMappedMem = mLogicalDevice.MapMemory(lStagingBufferRes.memory, 0, lTex2DArray.size());
+    auto lMappedMem = lStagingBufferRes.Map();
     std::memcpy(lMappedMem, lTex2DArray.data(), lTex2DArray.size());
-    mLogicalDevice.UnmapMemory(lStagingBufferRes.memory);
 
     // Setup buffer copy regions for array layers.
     std::vector<vkpp::BufferImageCopy> lBufferCopyRegions;
@@ -566,9 +563,8 @@ void TexturedArray::CreateVertexBuffer(void)
 
     mVertexBufferRes.Reset(lBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
 
-    auto lMappedMem = mLogicalDevice.MapMemory(mVertexBufferRes.memory, 0, lVertexDataSize);
+    auto lMappedMem = mVertexBufferRes.Map();
     std::memcpy(lMappedMem, lVertices, lVertexDataSize);
-    mLogicalDevice.UnmapMemory(mVertexBufferRes.memory);
 }
 
 
@@ -586,9 +582,8 @@ void TexturedArray::CreateIndexBuffer(void)
 
     mIndexBufferRes.Reset(lBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
 
-    auto lMappedMem = mLogicalDevice.MapMemory(mIndexBufferRes.memory, 0, lIndexDataSize);
+    auto lMappedMem = mIndexBufferRes.Map();
     std::memcpy(lMappedMem, lIndices, lIndexDataSize);
-    mLogicalDevice.UnmapMemory(mIndexBufferRes.memory);
 }
 
 
@@ -623,12 +618,11 @@ void TexturedArray::CreateUniformBuffer(void)
     mUBORes.Reset(lBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
 
     // Update instanced part of the uniform buffer.
-    auto lpMappedMem = mLogicalDevice.MapMemory(mUBORes.memory, lMatrixeDataSize, lInstanceDataSize);
+    auto lpMappedMem = mUBORes.Map(lMatrixeDataSize);
     std::memcpy(lpMappedMem, mUniformBufferObject.instances.data(), lInstanceDataSize);
-    mLogicalDevice.UnmapMemory(mUBORes.memory);
 
     // Map persistent
-    mpMatrixUBOMapped = mLogicalDevice.MapMemory(mUBORes.memory, 0, lMatrixeDataSize);
+    mpMatrixUBOMapped = mUBORes.Map();
 }
 
 
@@ -825,16 +819,13 @@ void TexturedArray::EndOneTimeCmdBuffer(const vkpp::CommandBuffer& aCmdBuffer) c
 {
     aCmdBuffer.End();
 
-    constexpr vkpp::FenceCreateInfo lFenceCreateInfo;
-    const auto& lFence = mLogicalDevice.CreateFence(lFenceCreateInfo);
+    const auto lFence = mFencePool.Acquire();
 
     const vkpp::SubmitInfo lSubmitInfo{ aCmdBuffer };
 
     mGraphicsQueue.handle.Submit(lSubmitInfo, lFence);
 
-    mLogicalDevice.WaitForFence(lFence);
-
-    mLogicalDevice.DestroyFence(lFence);
+    mFencePool.WaitAndRecycle(lFence);
     mLogicalDevice.FreeCommandBuffer(mCmdPool, aCmdBuffer);
 }
 
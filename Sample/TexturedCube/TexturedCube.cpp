@@ -12,14 +12,14 @@ TexturedCube::TexturedCube(CWindow& aWindow, const char* apAppName, uint32_t aAp
       CWindowEvent(aWindow),
       CMouseWheelEvent(aWindow),
       CMouseMotionEvent(aWindow),
-      mDepthRes(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mTextureResource(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mSkyModel(*this, mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mSphereModel(*this, mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mTeapotModel(*this, mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mTorusKnotModel(*this, mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mObjectUBORes(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mSkyboxUBORes(mLogicalDevice, mPhysicalDeviceMemoryProperties)
+      mDepthRes(*mDeviceAllocator),
+      mTextureResource(*mDeviceAllocator),
+      mSkyModel(*this, *mDeviceAllocator),
+      mSphereModel(*this, *mDeviceAllocator),
+      mTeapotModel(*this, *mDeviceAllocator),
+      mTorusKnotModel(*this, *mDeviceAllocator),
+      mObjectUBORes(*mDeviceAllocator),
+      mSkyboxUBORes(*mDeviceAllocator)
 {
     theApp.RegisterUpdateEvent([this](void)
     {
@@ -111,8 +111,6 @@ TexturedCube::~TexturedCube(void)
 
     mLogicalDevice.DestroyFences(mWaitFences);
 
-    UnmapUniformBuffers();
-
     mSkyboxUBORes.Reset();
     mObjectUBORes.Reset();
 
@@ -458,12 +456,11 @@ void TexturedCube::LoadTexture(const std::string& aFilename, vkpp::Format aForma
         vkpp::BufferUsageFlagBits::eTransferSrc
     };
 
-    BufferResource lStagingBuffer{ mLogicalDevice, mPhysicalDeviceMemoryProperties };
+    BufferResource lStagingBuffer{ *mDeviceAllocator };
     lStagingBuffer.Reset(lStagingBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
 
-    auto lMappedMem = mLogicalDevice.MapMemory(lStagingBuffer.memory, 0, lTexCube.size());
+    auto lMappedMem = lStagingBuffer.Map();
     std::memcpy(lMappedMem, lTexCube.data(), lTexCube.size());
-    mLogicalDevice.UnmapMemory(lStagingBuffer.memory);
 
     // Setup buffer copy regions for each face including all of its mip-levels.
     std::vector<vkpp::BufferImageCopy> lBufferCopyRegions;
@@ -641,15 +638,8 @@ void TexturedCube::UpdateUniformBuffers(void)
 
 void TexturedCube::MapUniformBuffers(void)
 {
-    mpObjectUBOMapped = mLogicalDevice.MapMemory(mObjectUBORes.memory, 0, sizeof(UniformBufferObject));
-    mpSkyboxUBOMapped = mLogicalDevice.MapMemory(mSkyboxUBORes.memory, 0, sizeof(UniformBufferObject));
-}
-
-
-void TexturedCube::UnmapUniformBuffers(void) const
-{
-    mLogicalDevice.UnmapMemory(mSkyboxUBORes.memory);
-    mLogicalDevice.UnmapMemory(mObjectUBORes.memory);
+    mpObjectUBOMapped = mObjectUBORes.Map();
+    mpSkyboxUBOMapped = mSkyboxUBORes.Map();
 }
 
 
@@ -863,16 +853,13 @@ void TexturedCube::EndOneTimeCommandBuffer(const vkpp::CommandBuffer& aCmdBuffer
 {
     aCmdBuffer.End();
 
-    constexpr vkpp::FenceCreateInfo lFenceCreateInfo;
-    const auto& lFence = mLogicalDevice.CreateFence(lFenceCreateInfo);
+    const auto lFence = mFencePool.Acquire();
 
     const vkpp::SubmitInfo lSubmitInfo{ aCmdBuffer };
 
     mGraphicsQueue.handle.Submit(lSubmitInfo, lFence);
 
-    mLogicalDevice.WaitForFence(lFence);
-
-    mLogicalDevice.DestroyFence(lFence);
+    mFencePool.WaitAndRecycle(lFence);
     mLogicalDevice.FreeCommandBuffer(mCmdPool, aCmdBuffer);
 }
 
@@ -909,8 +896,8 @@ void TexturedCube::CopyBuffer(vkpp::Buffer& aDstBuffer, const Buffer& aSrcBuffer
 }
 
 
-Model::Model(const TexturedCube& aTexturedCubeSample, const vkpp::LogicalDevice& aDevice, const vkpp::PhysicalDeviceMemoryProperties& aPhysicalDeviceMemProperties)
-    : texturedCubeSample(aTexturedCubeSample), device(aDevice), memProperties(aPhysicalDeviceMemProperties), vertices(aDevice, aPhysicalDeviceMemProperties), indices(aDevice, aPhysicalDeviceMemProperties)
+Model::Model(const TexturedCube& aTexturedCubeSample, vkpp::DeviceAllocator& aAllocator)
+    : texturedCubeSample(aTexturedCubeSample), device(aAllocator.GetLogicalDevice()), allocator(aAllocator), vertices(aAllocator), indices(aAllocator)
 {}
 
 
@@ -995,12 +982,11 @@ void Model::LoadMode(const std::string& aFilename, const glm::vec3& aScale, unsi
         vkpp::BufferUsageFlagBits::eTransferSrc
     };
 
-    BufferResource lStagingVtxBufferRes{ device, memProperties };
+    BufferResource lStagingVtxBufferRes{ allocator };
     lStagingVtxBufferRes.Reset(lVtxStagingCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
 
-    auto lMappedMem = device.MapMemory(lStagingVtxBufferRes.memory, 0, lVtxBufferSize);
+    auto lMappedMem = lStagingVtxBufferRes.Map();
     std::memcpy(lMappedMem, lVertexBuffer.data(), lVtxBufferSize);
-    device.UnmapMemory(lStagingVtxBufferRes.memory);
 
     // Index Buffer.
     auto lIdxBufferSize = static_cast<uint32_t>(lIndexBuffer.size()) * sizeof(uint32_t);
@@ -1010,11 +996,10 @@ void Model::LoadMode(const std::string& aFilename, const glm::vec3& aScale, unsi
         vkpp::BufferUsageFlagBits::eTransferSrc
     };
 
-    BufferResource lStagingIdxBufferRes{ device, memProperties };
+    BufferResource lStagingIdxBufferRes{ allocator };
     lStagingIdxBufferRes.Reset(lIdxStagingCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
-    lMappedMem = device.MapMemory(lStagingIdxBufferRes.memory, 0, lIdxBufferSize);
+    lMappedMem = lStagingIdxBufferRes.Map();
     std::memcpy(lMappedMem, lIndexBuffer.data(), lIdxBufferSize);
-    device.UnmapMemory(lStagingIdxBufferRes.memory);
 
     // Create device local target buffers.
     // Vertex Buffer.
@@ -89,7 +89,7 @@ struct Model
 
     const TexturedCube& texturedCubeSample;
     const vkpp::LogicalDevice& device;
-    const vkpp::PhysicalDeviceMemoryProperties& memProperties;
+    vkpp::DeviceAllocator& allocator;
 
     BufferResource vertices;
     BufferResource indices;
@@ -117,7 +117,7 @@ struct Model
     std::vector<ModelPart> modelParts;
     uint32_t vertexCount{ 0 }, indexCount{ 0 };
 
-    Model(const TexturedCube& aTexturedCubeSample, const vkpp::LogicalDevice& aDevice, const vkpp::PhysicalDeviceMemoryProperties& aPhysicalDeviceMemProperties);
+    Model(const TexturedCube& aTexturedCubeSample, vkpp::DeviceAllocator& aAllocator);
 
     void LoadMode(const std::string& aFilename, const glm::vec3& aScale,  unsigned int aImporterFlags = DefaultImporterFlags);
 };
@@ -203,7 +203,6 @@ private:
     void CreateUniformBuffers(void);
     void UpdateUniformBuffers(void);
     void MapUniformBuffers(void);
-    void UnmapUniformBuffers(void) const;
     void UpdateDescriptorSets(void);
 
     void BuildCommandBuffers(void);
@@ -12,11 +12,11 @@ TexturedPlate::TexturedPlate(CWindow& aWindow, const char* apApplicationName, ui
       CWindowEvent(aWindow),
       CMouseWheelEvent(aWindow),
       CMouseMotionEvent(aWindow),
-      mDepthResource(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mTextureResource(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mVertexBufferRes(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mIndexBufferRes(mLogicalDevice, mPhysicalDeviceMemoryProperties),
-      mUniformBufferRes(mLogicalDevice, mPhysicalDeviceMemoryProperties)
+      mDepthResource(*mDeviceAllocator),
+      mTextureResource(*mDeviceAllocator),
+      mVertexBufferRes(*mDeviceAllocator),
+      mIndexBufferRes(*mDeviceAllocator),
+      mUniformBufferRes(*mDeviceAllocator)
 {
     theApp.RegisterUpdateEvent([this](void)
     {
@@ -444,12 +444,11 @@ void TexturedPlate::LoadTexture(const std::string& aFilename, vkpp::Format aTexF
         vkpp::BufferUsageFlagBits::eTransferSrc             // This buffer is used as a transfer source for the buffer copy.
     };
 
-    BufferResource lStagingBufferRes{ mLogicalDevice, mPhysicalDeviceMemoryProperties };
+    BufferResource lStagingBufferRes{ *mDeviceAllocator };
     lStagingBufferRes.Reset(lStagingBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
 
-    auto lMappedMem = mLogicalDevice.MapMemory(lStagingBufferRes.memory, 0, lTex2D.size());
+    auto lMappedMem = lStagingBufferRes.Map();
     std::memcpy(lMappedMem, lTex2D.data(), lTex2D.size());
-    mLogicalDevice.UnmapMemory(lStagingBufferRes.memory);
 
     // Setup buffer copy regions for each mip-level.
     std::vector<vkpp::BufferImageCopy> lBufferCopyRegions;
@@ -638,9 +637,8 @@ void TexturedPlate::CreateVertexBuffer(void)
 
     mVertexBufferRes.Reset(lBufferCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
 
-    auto lMappedMem = mLogicalDevice.MapMemory(mVertexBufferRes.memory, 0, lVertexDataSize);
+    auto lMappedMem = mVertexBufferRes.Map();
     std::memcpy(lMappedMem, lVertices.data(), lVertexDataSize);
-    mLogicalDevice.UnmapMemory(mVertexBufferRes.memory);
 }
 
 
@@ -663,9 +661,8 @@ void TexturedPlate::CreateIndexBuffer(void)
 
     mIndexBufferRes.Reset(lIndexCreateInfo, vkpp::MemoryPropertyFlagBits::eHostVisible | vkpp::MemoryPropertyFlagBits::eHostCoherent);
 
-    auto lMappedMem = mLogicalDevice.MapMemory(mIndexBufferRes.memory, 0, lIndexDataSize);
+    auto lMappedMem = mIndexBufferRes.Map();
     std::memcpy(lMappedMem, lIndices.data(), lIndexDataSize);
-    mLogicalDevice.UnmapMemory(mIndexBufferRes.memory);
 }
 
 
@@ -698,9 +695,8 @@ void TexturedPlate::UpdateUniformBuffer(void)
 
     mMVPMatrix.viewPos = glm::vec4(0.0f, 0.0f, -mCurrentZoomLevel, 0.0f);
 
-    auto lMappedMem = mLogicalDevice.MapMemory(mUniformBufferRes.memory, 0, sizeof(UniformBufferObject));
+    auto lMappedMem = mUniformBufferRes.Map();
     std::memcpy(lMappedMem, &mMVPMatrix, sizeof(UniformBufferObject));
-    mLogicalDevice.UnmapMemory(mUniformBufferRes.memory);
 }
 
 
@@ -724,16 +720,13 @@ void TexturedPlate::EndOneTimeCmdBuffer(const vkpp::CommandBuffer& aCmdBuffer) c
 {
     aCmdBuffer.End();
 
-    constexpr vkpp::FenceCreateInfo lFenceCreateInfo;
-    const auto& lFence = mLogicalDevice.CreateFence(lFenceCreateInfo);
+    const auto lFence = mFencePool.Acquire();
 
     const vkpp::SubmitInfo lSubmitInfo{ aCmdBuffer };
 
     mGraphicsQueue.handle.Submit(lSubmitInfo, lFence);
 
-    mLogicalDevice.WaitForFence(lFence);
-
-    mLogicalDevice.DestroyFence(lFence);
+    mFencePool.WaitAndRecycle(lFence);
     mLogicalDevice.FreeCommandBuffer(mCmdPool, aCmdBuffer);
 }
 
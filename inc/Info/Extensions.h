@@ -9,6 +9,14 @@
 constexpr const char* KHR_SURFACE_EXT_NAME      = VK_KHR_SURFACE_EXTENSION_NAME;
 constexpr const char* KHR_SWAPCHAIN_EXT_NAME    = VK_KHR_SWAPCHAIN_EXTENSION_NAME;
 
+constexpr const char* KHR_GET_PHYSICAL_DEVICE_PROPERTIES2_EXT_NAME  = VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME;
+
+constexpr const char* KHR_DESCRIPTOR_UPDATE_TEMPLATE_EXT_NAME   = VK_KHR_DESCRIPTOR_UPDATE_TEMPLATE_EXTENSION_NAME;
+constexpr const char* KHR_PUSH_DESCRIPTOR_EXT_NAME              = VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME;
+constexpr const char* KHR_MAINTENANCE3_EXT_NAME                 = VK_KHR_MAINTENANCE3_EXTENSION_NAME;
+constexpr const char* KHR_DRAW_INDIRECT_COUNT_EXT_NAME          = VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME;
+constexpr const char* EXT_DESCRIPTOR_INDEXING_EXT_NAME          = VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME;
+
 #ifdef VK_USE_PLATFORM_WIN32_KHR
 constexpr const char* KHR_OS_SURFACE_EXT_NAME   = VK_KHR_WIN32_SURFACE_EXTENSION_NAME;
 #endif
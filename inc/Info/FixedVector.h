@@ -0,0 +1,136 @@
+#ifndef __VKPP_INFO_FIXED_VECTOR_H__
+#define __VKPP_INFO_FIXED_VECTOR_H__
+
+
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+
+
+
+namespace vkpp
+{
+
+
+
+/**
+ * \class FixedVector
+ *
+ * \brief A vector with inline storage for up to N elements, which never allocates.
+ *
+ * Meant for the results of enumerations whose count is small and bounded in practice (physical devices, queue families, swapchain images...).
+ * All N elements are default constructed up front, so T has to be default constructible and copy assignable.
+ * Like the standard containers, it can be passed wherever vkpp takes a container of T.
+ */
+template <typename T, std::size_t N>
+class FixedVector
+{
+private:
+    std::array<T, N> mElements;
+    std::size_t mSize{ 0 };
+
+public:
+    using value_type = T;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    FixedVector(void) noexcept = default;
+
+    static constexpr std::size_t capacity(void) noexcept
+    {
+        return N;
+    }
+
+    std::size_t size(void) const noexcept
+    {
+        return mSize;
+    }
+
+    bool empty(void) const noexcept
+    {
+        return mSize == 0;
+    }
+
+    T* data(void) noexcept
+    {
+        return mElements.data();
+    }
+
+    const T* data(void) const noexcept
+    {
+        return mElements.data();
+    }
+
+    T& operator[](std::size_t aIndex) noexcept
+    {
+        assert(aIndex < mSize);
+
+        return mElements[aIndex];
+    }
+
+    const T& operator[](std::size_t aIndex) const noexcept
+    {
+        assert(aIndex < mSize);
+
+        return mElements[aIndex];
+    }
+
+    iterator begin(void) noexcept
+    {
+        return data();
+    }
+
+    iterator end(void) noexcept
+    {
+        return data() + mSize;
+    }
+
+    const_iterator begin(void) const noexcept
+    {
+        return data();
+    }
+
+    const_iterator end(void) const noexcept
+    {
+        return data() + mSize;
+    }
+
+    const_iterator cbegin(void) const noexcept
+    {
+        return begin();
+    }
+
+    const_iterator cend(void) const noexcept
+    {
+        return end();
+    }
+
+    // Elements past the previous size keep whatever they were last assigned, e.g. by the enumeration that filled them.
+    void resize(std::size_t aSize) noexcept
+    {
+        assert(aSize <= N);
+
+        mSize = aSize;
+    }
+
+    void push_back(const T& aElement) noexcept
+    {
+        assert(mSize < N);
+
+        mElements[mSize++] = aElement;
+    }
+
+    void clear(void) noexcept
+    {
+        mSize = 0;
+    }
+};
+
+
+
+}                   // End of namespace vkpp.
+
+
+
+#endif              // __VKPP_INFO_FIXED_VECTOR_H__
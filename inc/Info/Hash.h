@@ -0,0 +1,142 @@
+#ifndef __VKPP_INFO_HASH_H__
+#define __VKPP_INFO_HASH_H__
+
+
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <unordered_map>
+#include <type_traits>
+
+
+
+namespace vkpp::internal
+{
+
+
+
+// The bytes a Hasher has consumed; equal keys mean equal inputs, whereas equal hashes may collide.
+using HashKey = std::vector<unsigned char>;
+
+
+
+// 64-bit FNV-1a. Stable across runs and platforms with the same struct layouts, unlike std::hash.
+// Given a key, it also appends every byte it hashes to it, so that caches can compare the full input on a hash hit.
+class Hasher
+{
+private:
+    uint64_t mHash{ 14695981039346656037ull };
+    HashKey* mpKey{ nullptr };
+
+public:
+    explicit Hasher(HashKey* apKey = nullptr) noexcept : mpKey(apKey)
+    {}
+
+    Hasher& AddBytes(const void* apData, std::size_t aSize)
+    {
+        const auto lpBytes = static_cast<const unsigned char*>(apData);
+
+        if (mpKey != nullptr)
+            mpKey->insert(mpKey->end(), lpBytes, lpBytes + aSize);
+
+        for (std::size_t lIndex = 0; lIndex < aSize; ++lIndex)
+        {
+            mHash ^= lpBytes[lIndex];
+            mHash *= 1099511628211ull;
+        }
+
+        return *this;
+    }
+
+    // T must not contain padding, or the hash depends on uninitialized bytes.
+    template <typename T>
+    Hasher& Add(const T& aValue)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+
+        return AddBytes(&aValue, sizeof(T));
+    }
+
+    // The count is hashed as well, so that consecutive arrays cannot be confused with each other.
+    template <typename T>
+    Hasher& AddArray(uint32_t aCount, const T* apValues)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+
+        Add(aCount);
+
+        return apValues != nullptr ? AddBytes(apValues, aCount * sizeof(T)) : *this;
+    }
+
+    Hasher& AddString(const char* apString)
+    {
+        return apString != nullptr ? AddArray(static_cast<uint32_t>(std::strlen(apString)), apString) : Add(UINT32_MAX);
+    }
+
+    uint64_t Get(void) const noexcept
+    {
+        return mHash;
+    }
+};
+
+
+
+// Values keyed by a Hasher's hash and key. Colliding hashes share a bucket, and a lookup only hits if the full key matches too.
+template <typename T>
+class HashTable
+{
+private:
+    struct Entry
+    {
+        HashKey key;
+        T       value;
+    };
+
+    std::unordered_multimap<uint64_t, Entry> mEntries;
+
+public:
+    T* Find(uint64_t aHash, const HashKey& aKey)
+    {
+        const auto lRange = mEntries.equal_range(aHash);
+
+        for (auto lIter = lRange.first; lIter != lRange.second; ++lIter)
+        {
+            if (lIter->second.key == aKey)
+                return &lIter->second.value;
+        }
+
+        return nullptr;
+    }
+
+    // aKey must not be in the table yet.
+    T& Insert(uint64_t aHash, const HashKey& aKey, const T& aValue)
+    {
+        return mEntries.emplace(aHash, Entry{ aKey, aValue })->second.value;
+    }
+
+    template <typename F>
+    void ForEach(F&& aFunction) const
+    {
+        for (const auto& lEntry : mEntries)
+            aFunction(lEntry.second.value);
+    }
+
+    void Clear(void) noexcept
+    {
+        mEntries.clear();
+    }
+
+    std::size_t GetSize(void) const noexcept
+    {
+        return mEntries.size();
+    }
+};
+
+
+
+}                   // End of namespace vkpp::internal.
+
+
+
+#endif              // __VKPP_INFO_HASH_H__
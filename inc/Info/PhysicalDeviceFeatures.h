@@ -22,4 +22,89 @@ using PhysicalDeviceLimits      = VkPhysicalDeviceLimits;
 
 
 
+namespace vkpp::khr
+{
+
+
+
+// Queries the core features together with the extension feature structures chained to pNext; requires VK_KHR_get_physical_device_properties2.
+class PhysicalDeviceFeatures2 : public internal::VkTrait<PhysicalDeviceFeatures2, VkPhysicalDeviceFeatures2KHR>
+{
+private:
+    const internal::Structure sType = internal::Structure::ePhysicalDeviceFeatures2;
+
+public:
+    void*                   pNext{ nullptr };
+    PhysicalDeviceFeatures  features{};
+
+    DEFINE_CLASS_MEMBER(PhysicalDeviceFeatures2)
+
+    PhysicalDeviceFeatures2& SetNext(void* apNext) noexcept
+    {
+        pNext = apNext;
+
+        return *this;
+    }
+};
+
+ConsistencyCheck(PhysicalDeviceFeatures2, pNext, features)
+
+
+
+}                   // End of namespace vkpp::khr.
+
+
+
+namespace vkpp::ext
+{
+
+
+
+// Chained to khr::PhysicalDeviceFeatures2 to query the features, or to LogicalDeviceCreateInfo to enable them; requires VK_EXT_descriptor_indexing.
+class PhysicalDeviceDescriptorIndexingFeatures : public internal::VkTrait<PhysicalDeviceDescriptorIndexingFeatures, VkPhysicalDeviceDescriptorIndexingFeaturesEXT>
+{
+private:
+    const internal::Structure sType = internal::Structure::ePhysicalDeviceDescriptorIndexingFeatures;
+
+public:
+    void*   pNext{ nullptr };
+    Bool32  shaderInputAttachmentArrayDynamicIndexing{ VK_FALSE };
+    Bool32  shaderUniformTexelBufferArrayDynamicIndexing{ VK_FALSE };
+    Bool32  shaderStorageTexelBufferArrayDynamicIndexing{ VK_FALSE };
+    Bool32  shaderUniformBufferArrayNonUniformIndexing{ VK_FALSE };
+    Bool32  shaderSampledImageArrayNonUniformIndexing{ VK_FALSE };
+    Bool32  shaderStorageBufferArrayNonUniformIndexing{ VK_FALSE };
+    Bool32  shaderStorageImageArrayNonUniformIndexing{ VK_FALSE };
+    Bool32  shaderInputAttachmentArrayNonUniformIndexing{ VK_FALSE };
+    Bool32  shaderUniformTexelBufferArrayNonUniformIndexing{ VK_FALSE };
+    Bool32  shaderStorageTexelBufferArrayNonUniformIndexing{ VK_FALSE };
+    Bool32  descriptorBindingUniformBufferUpdateAfterBind{ VK_FALSE };
+    Bool32  descriptorBindingSampledImageUpdateAfterBind{ VK_FALSE };
+    Bool32  descriptorBindingStorageImageUpdateAfterBind{ VK_FALSE };
+    Bool32  descriptorBindingStorageBufferUpdateAfterBind{ VK_FALSE };
+    Bool32  descriptorBindingUniformTexelBufferUpdateAfterBind{ VK_FALSE };
+    Bool32  descriptorBindingStorageTexelBufferUpdateAfterBind{ VK_FALSE };
+    Bool32  descriptorBindingUpdateUnusedWhilePending{ VK_FALSE };
+    Bool32  descriptorBindingPartiallyBound{ VK_FALSE };
+    Bool32  descriptorBindingVariableDescriptorCount{ VK_FALSE };
+    Bool32  runtimeDescriptorArray{ VK_FALSE };
+
+    DEFINE_CLASS_MEMBER(PhysicalDeviceDescriptorIndexingFeatures)
+
+    PhysicalDeviceDescriptorIndexingFeatures& SetNext(void* apNext) noexcept
+    {
+        pNext = apNext;
+
+        return *this;
+    }
+};
+
+ConsistencyCheck(PhysicalDeviceDescriptorIndexingFeatures, pNext, shaderInputAttachmentArrayDynamicIndexing, shaderUniformTexelBufferArrayDynamicIndexing, shaderStorageTexelBufferArrayDynamicIndexing, shaderUniformBufferArrayNonUniformIndexing, shaderSampledImageArrayNonUniformIndexing, shaderStorageBufferArrayNonUniformIndexing, shaderStorageImageArrayNonUniformIndexing, shaderInputAttachmentArrayNonUniformIndexing, shaderUniformTexelBufferArrayNonUniformIndexing, shaderStorageTexelBufferArrayNonUniformIndexing, descriptorBindingUniformBufferUpdateAfterBind, descriptorBindingSampledImageUpdateAfterBind, descriptorBindingStorageImageUpdateAfterBind, descriptorBindingStorageBufferUpdateAfterBind, descriptorBindingUniformTexelBufferUpdateAfterBind, descriptorBindingStorageTexelBufferUpdateAfterBind, descriptorBindingUpdateUnusedWhilePending, descriptorBindingPartiallyBound, descriptorBindingVariableDescriptorCount, runtimeDescriptorArray)
+
+
+
+}                   // End of namespace vkpp::ext.
+
+
+
 #endif              // __VKPP_INFO_PHYSICAL_DEVICE_FEATURES_H__
@@ -5,6 +5,10 @@
 
 #include <type_traits>
 #include <memory>
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <cassert>
 #include <vulkan/vulkan.h>
 
 
@@ -25,9 +29,9 @@ struct VkDeleterTrait
     static_assert(std::is_pointer_v<T>);
     static_assert(std::is_pointer_v<U>);
 
-    using DeleterType = std::add_pointer_t<void(T, U, const VkAllocationCallbacks*)>;
+    using DeleterType = std::add_pointer_t<void(U, T, const VkAllocationCallbacks*)>;
 
-    T mpOwner{ nullptr };
+    U mpOwner{ nullptr };
 };
 
 
@@ -52,30 +56,29 @@ private:
     const VkAllocationCallbacks* mpAllocator{ nullptr };
 
 public:
-    template <typename P, typename = std::enable_if_t<std::is_same_v<T, U>>>
+    template <typename P, typename V = U, typename = std::enable_if_t<std::is_same_v<T, V>>>
     DefaultDeleter(P aDeleter, const VkAllocationCallbacks* apAllocator = nullptr) : mDeleter(aDeleter), mpAllocator(apAllocator)
     {
         assert(aDeleter != nullptr);
     }
 
-    template <typename P, typename = std::enable_if_t<!std::is_same_v<T, U>>>
-    DefaultDeleter(T apOwner, P aDeleter, const VkAllocationCallbacks* apAllocator = nullptr) : Base{ apOwner }, mDeleter(aDeleter), mpAllocator(apAllocator)
+    template <typename P, typename V = U, typename = std::enable_if_t<!std::is_same_v<T, V>>>
+    DefaultDeleter(V apOwner, P aDeleter, const VkAllocationCallbacks* apAllocator = nullptr) : Base{ apOwner }, mDeleter(aDeleter), mpAllocator(apAllocator)
     {
         assert(apOwner != nullptr && aDeleter != nullptr);
     }
 
     template <typename P>
-    std::enable_if_t<std::is_same_v<T, U>> operator()(P aPtr) const
+    void operator()(P aPtr) const
     {
-        mDeleter(aPtr, mpAllocator);
-    }
-
-    template <typename P>
-    std::enable_if_t<!std::is_same_v<T, U>> operator()(P aPtr) const
-    {
-        assert(mpOwner != nullptr);
-
-        mDeleter(mpOwner, aPtr, mpAllocator);
+        if constexpr (std::is_same_v<T, U>)
+            mDeleter(aPtr, mpAllocator);
+        else
+        {
+            assert(this->mpOwner != nullptr);
+
+            mDeleter(this->mpOwner, aPtr, mpAllocator);
+        }
     }
 };
 
@@ -99,133 +102,309 @@ using DeviceDeleter = internal::DefaultDeleter<T, VkDevice>;
 
 
 
+template <typename T, typename Deleter>
+class RefCounterPool;
+
+
+
+/**
+ * \class RefCounter
+ *
+ * \brief The control block an AutoPtr shares: the handle, its deleter and an atomic reference count.
+ *
+ * Copies of an AutoPtr may be made and dropped on any thread. The last release runs the deleter on the thread that released it, then
+ * hands the block back to the pool it came from, or deletes it.
+ */
 template <typename T, typename Deleter>
 class RefCounter
 {
 private:
-    using ThisType = RefCounter;
-
     using RefType = T;
-    using Reference = RefType&;
-    using ConstReference = const Reference&;
+    using PoolType = RefCounterPool<T, Deleter>;
 
-    unsigned int mRefCount{ 0 };
+    std::atomic<uint32_t> mRefCount{ 1 };
     T mRef{ nullptr };
     Deleter mDeleter;
+    PoolType* mpPool{ nullptr };
 
 public:
-    RefCounter(void) noexcept = default;
-
     template <typename... Args>
-    explicit RefCounter(T apPtr, Args&&... aArgs) : mRef(apPtr), mDeleter(std::forward<Args>(aArgs)...)
-    {
-        AddRef();
-    }
+    explicit RefCounter(PoolType* apPool, T apPtr, Args&&... aArgs) : mRef(apPtr), mDeleter(std::forward<Args>(aArgs)...), mpPool(apPool)
+    {}
+
+    RefCounter(const RefCounter&) = delete;
+    RefCounter& operator=(const RefCounter&) = delete;
 
     ~RefCounter(void)
     {
-        mDeleter(mRef);
+        if (mRef != nullptr)
+            mDeleter(mRef);
     }
 
-    void AddRef(void)
+    void AddRef(void) noexcept
     {
-        ++mRefCount;
+        // A new reference can only be made from an existing one, so nothing needs ordering here.
+        mRefCount.fetch_add(1, std::memory_order_relaxed);
     }
 
     void ReleaseRef(void)
     {
-        if (--mRefCount == 0)
+        // Acquire-release so that every write made through the other references happens before the deleter runs.
+        if (mRefCount.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            return;
+
+        if (mpPool != nullptr)
+            mpPool->Destroy(this);
+        else
             delete this;
     }
 
-    unsigned int RefCount(void) const
+    uint32_t RefCount(void) const noexcept
     {
-        return mRefCount;
+        return mRefCount.load(std::memory_order_relaxed);
     }
 
-    ConstReference Ref(void) const
+    const RefType& Ref(void) const noexcept
     {
         return mRef;
     }
+};
 
-    Reference Ref(void)
+
+
+/**
+ * \class RefCounterPool
+ *
+ * \brief Hands out RefCounter blocks from chunks allocated up front, so creating an AutoPtr does not hit the heap.
+ *
+ * Blocks are recycled through a free list guarded by a mutex, which is only taken when an AutoPtr is created or its last reference dropped.
+ * The pool must outlive every AutoPtr created from it.
+ */
+template <typename T, typename Deleter>
+class RefCounterPool
+{
+private:
+    using RefCounterType = RefCounter<T, Deleter>;
+
+    union Block
+    {
+        Block* pNext;
+        alignas(RefCounterType) unsigned char storage[sizeof(RefCounterType)];
+    };
+
+    const uint32_t mBlockCountPerChunk;
+
+    std::mutex mMutex;
+    std::vector<std::unique_ptr<Block[]>> mChunks;
+    Block* mpFreeList{ nullptr };
+    uint32_t mUsedCount{ 0 };
+
+    void* AllocateBlock(void)
     {
-        return const_cast<Reference>(
-            static_cast<const ThisType&>(*this).Ref());
+        std::lock_guard<std::mutex> lLock{ mMutex };
+
+        if (mpFreeList == nullptr)
+        {
+            mChunks.emplace_back(std::make_unique<Block[]>(mBlockCountPerChunk));
+
+            auto lpChunk = mChunks.back().get();
+
+            for (uint32_t lIndex = 0; lIndex < mBlockCountPerChunk; ++lIndex)
+                lpChunk[lIndex].pNext = lIndex + 1 < mBlockCountPerChunk ? &lpChunk[lIndex + 1] : nullptr;
+
+            mpFreeList = lpChunk;
+        }
+
+        auto lpBlock = mpFreeList;
+        mpFreeList = lpBlock->pNext;
+        ++mUsedCount;
+
+        return lpBlock->storage;
     }
 
-    operator ConstReference(void) const
+    void FreeBlock(void* apStorage) noexcept
     {
-        return Ref();
+        std::lock_guard<std::mutex> lLock{ mMutex };
+
+        auto lpBlock = reinterpret_cast<Block*>(apStorage);
+        lpBlock->pNext = mpFreeList;
+        mpFreeList = lpBlock;
+        --mUsedCount;
     }
 
-    operator Reference(void)
+public:
+    constexpr static uint32_t DefaultBlockCountPerChunk{ 64 };
+
+    explicit RefCounterPool(uint32_t aBlockCountPerChunk = DefaultBlockCountPerChunk) : mBlockCountPerChunk(aBlockCountPerChunk)
     {
-        return Ref();
+        assert(aBlockCountPerChunk != 0);
     }
 
-    explicit operator bool(void) const
+    RefCounterPool(const RefCounterPool&) = delete;
+    RefCounterPool& operator=(const RefCounterPool&) = delete;
+
+    ~RefCounterPool(void)
     {
-        return mRef != nullptr;
+        assert(mUsedCount == 0);
     }
 
-    RefType operator*(void) const
+    template <typename... Args>
+    RefCounterType* Create(T apPtr, Args&&... aArgs)
     {
-        assert(mRef != nullptr);
+        auto lpStorage = AllocateBlock();
+
+        try
+        {
+            return new (lpStorage) RefCounterType(this, apPtr, std::forward<Args>(aArgs)...);
+        }
+        catch (...)
+        {
+            FreeBlock(lpStorage);
+            throw;
+        }
+    }
 
-        return mRef;
+    void Destroy(RefCounterType* apRefCounter)
+    {
+        apRefCounter->~RefCounterType();
+        FreeBlock(apRefCounter);
+    }
+
+    // Number of blocks held by live AutoPtrs.
+    uint32_t GetUsedCount(void)
+    {
+        std::lock_guard<std::mutex> lLock{ mMutex };
+
+        return mUsedCount;
+    }
+};
+
+
+
+/**
+ * \class DeferredDeleter
+ *
+ * \brief Wraps a deleter so that the last release of an AutoPtr only queues the destruction.
+ *
+ * Queue is anything with a Push taking a callable, which it must run once the GPU is done with every frame recorded so far, and which has to
+ * be safe to call from any thread that may drop the last reference.
+ */
+template <typename Deleter, typename Queue>
+class DeferredDeleter
+{
+private:
+    Queue* mpQueue{ nullptr };
+    Deleter mDeleter;
+
+public:
+    template <typename... Args>
+    DeferredDeleter(Queue& aQueue, Args&&... aArgs) : mpQueue(&aQueue), mDeleter(std::forward<Args>(aArgs)...)
+    {}
+
+    template <typename P>
+    void operator()(P aPtr) const
+    {
+        mpQueue->Push([lDeleter = mDeleter, aPtr](void)
+        {
+            lDeleter(aPtr);
+        });
     }
 };
 
 
 
+/**
+ * \class AutoPtr
+ *
+ * \brief Shared ownership of a Vulkan handle, destroyed by Deleter once the last AutoPtr referencing it goes away.
+ *
+ * Copying bumps an atomic count and moving transfers the reference without touching it, so prefer moves when handing an AutoPtr over.
+ * The control block comes from the heap, or from a RefCounterPool when one is given.
+ */
 template <typename T, typename Deleter = DefaultDeleter<T>>
 class AutoPtr
 {
 private:
-    using ElementType = T;
-    using PointerType = T;
-    using ThisType = AutoPtr;
     using RefCounterType = RefCounter<T, Deleter>;
 
-    RefCounterType* mpRefCount{ nullptr };
+    RefCounterType* mpRefCounter{ nullptr };
 
 public:
+    using PoolType = RefCounterPool<T, Deleter>;
+
     AutoPtr(void) noexcept = default;
 
-    /*explicit AutoPtr(std::nullptr_t) noexcept
-    {}*/
+    AutoPtr(std::nullptr_t) noexcept
+    {}
 
     template <typename... Args>
-    explicit AutoPtr(Args... aArgs) : mpRefCount(new RefCounterType(std::forward<Args>(aArgs)...))
+    explicit AutoPtr(T apPtr, Args&&... aArgs) : mpRefCounter(new RefCounterType(nullptr, apPtr, std::forward<Args>(aArgs)...))
     {}
 
-    AutoPtr(const AutoPtr& aPtr) : mpRefCount(aPtr.mpRefCount)
+    template <typename... Args>
+    AutoPtr(PoolType& aPool, T apPtr, Args&&... aArgs) : mpRefCounter(aPool.Create(apPtr, std::forward<Args>(aArgs)...))
+    {}
+
+    AutoPtr(const AutoPtr& aPtr) noexcept : mpRefCounter(aPtr.mpRefCounter)
+    {
+        if (mpRefCounter != nullptr)
+            mpRefCounter->AddRef();
+    }
+
+    AutoPtr(AutoPtr&& aPtr) noexcept : mpRefCounter(aPtr.mpRefCounter)
     {
-        mpRefCount->AddRef();
+        aPtr.mpRefCounter = nullptr;
     }
 
     ~AutoPtr(void)
     {
-        if (mpRefCount != nullptr)
-            mpRefCount->ReleaseRef();
+        if (mpRefCounter != nullptr)
+            mpRefCounter->ReleaseRef();
     }
 
-    void Swap(AutoPtr& aPtr)
+    AutoPtr& operator=(const AutoPtr& aPtr)
     {
-        std::swap(mpRefCount, aPtr.mpRefCount);
+        AutoPtr(aPtr).Swap(*this);
+
+        return *this;
     }
 
-    AutoPtr& operator=(PointerType apPtr)
+    AutoPtr& operator=(AutoPtr&& aPtr)
     {
-        ThisType(apPtr).Swap(*this);
+        AutoPtr(std::move(aPtr)).Swap(*this);
 
         return *this;
     }
 
-    operator T(void) const
+    void Swap(AutoPtr& aPtr) noexcept
+    {
+        std::swap(mpRefCounter, aPtr.mpRefCounter);
+    }
+
+    // Drop this reference, which destroys the handle if it was the last one.
+    void Reset(void)
+    {
+        AutoPtr().Swap(*this);
+    }
+
+    T Get(void) const noexcept
+    {
+        return mpRefCounter != nullptr ? mpRefCounter->Ref() : nullptr;
+    }
+
+    uint32_t UseCount(void) const noexcept
+    {
+        return mpRefCounter != nullptr ? mpRefCounter->RefCount() : 0;
+    }
+
+    operator T(void) const noexcept
+    {
+        return Get();
+    }
+
+    explicit operator bool(void) const noexcept
     {
-        return *mpRefCount;
+        return mpRefCounter != nullptr;
     }
 };
 
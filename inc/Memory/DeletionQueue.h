@@ -0,0 +1,218 @@
+#ifndef __VKPP_MEMORY_DELETION_QUEUE_H__
+#define __VKPP_MEMORY_DELETION_QUEUE_H__
+
+
+
+#include <deque>
+#include <vector>
+#include <mutex>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+
+#include <Info/Common.h>
+
+#include <Type/LogicalDevice.h>
+#include <Type/Fence.h>
+#include <Type/UniqueHandle.h>
+
+
+
+namespace vkpp
+{
+
+
+
+/**
+ * \class DeletionQueue
+ *
+ * \brief Defers destroying objects until the GPU is done with the frame that last used them, so freeing never waits on the device.
+ *
+ * Deletions recorded during a frame are closed against the fence passed to EndFrame, and all run together once it is signaled.
+ * Like RingBuffer, the fence must not be reset before the frame has been reclaimed, i.e. call Reclaim after waiting for it and before resetting it;
+ * FrameContextRing does so when given a queue. Handles are destroyed through the LogicalDevice member picked by their type, without allocating
+ * once the per-frame lists have grown to their steady size. Push and Destroy may be called from any thread.
+ */
+class DeletionQueue
+{
+private:
+    struct Deletion
+    {
+        void (*pDestroy)(const LogicalDevice&, uint64_t){ nullptr };
+        uint64_t handle{ 0 };
+        std::function<void(void)> function;
+    };
+
+    struct Frame
+    {
+        Fence                   fence;
+        std::vector<Deletion>   deletions;
+    };
+
+    const LogicalDevice& mLogicalDevice;
+
+    std::mutex mMutex;
+    std::vector<Deletion> mDeletions;                   // Recorded since the previous EndFrame.
+    std::deque<Frame> mFrames;
+    std::vector<std::vector<Deletion>> mSpareLists;     // Emptied lists, kept for their capacity.
+
+    template <typename T>
+    static void DestroyHandle(const LogicalDevice& aLogicalDevice, uint64_t aHandle)
+    {
+        typename T::VkType lHandle;
+        std::memcpy(&lHandle, &aHandle, sizeof(lHandle));
+
+        internal::HandleDeleter<T>::Delete(aLogicalDevice, T{ lHandle });
+    }
+
+    void Run(std::vector<Deletion>& aDeletions) const
+    {
+        for (auto& lDeletion : aDeletions)
+        {
+            if (lDeletion.pDestroy != nullptr)
+                lDeletion.pDestroy(mLogicalDevice, lDeletion.handle);
+            else
+                lDeletion.function();
+        }
+
+        aDeletions.clear();
+    }
+
+    // The deletions run outside the lock, so that they may record further deletions.
+    void Retire(std::vector<Deletion>& aDeletions)
+    {
+        Run(aDeletions);
+
+        std::lock_guard<std::mutex> lLock{ mMutex };
+        mSpareLists.emplace_back(std::move(aDeletions));
+    }
+
+public:
+    explicit DeletionQueue(const LogicalDevice& aLogicalDevice) : mLogicalDevice(aLogicalDevice)
+    {}
+
+    DeletionQueue(const DeletionQueue&) = delete;
+    DeletionQueue& operator=(const DeletionQueue&) = delete;
+
+    ~DeletionQueue(void)
+    {
+        Flush();
+    }
+
+    // Destroy aHandle with the default allocator once the frame being recorded has completed.
+    template <typename T>
+    void Destroy(const T& aHandle)
+    {
+        const auto& lHandle = static_cast<const typename T::VkType&>(aHandle);
+
+        // Non-dispatchable handles are pointers or 64-bit integers depending on the platform.
+        static_assert(sizeof(lHandle) <= sizeof(uint64_t));
+
+        if (lHandle == VK_NULL_HANDLE)
+            return;
+
+        Deletion lDeletion;
+        lDeletion.pDestroy = &DestroyHandle<T>;
+        std::memcpy(&lDeletion.handle, &lHandle, sizeof(lHandle));
+
+        std::lock_guard<std::mutex> lLock{ mMutex };
+        mDeletions.emplace_back(std::move(lDeletion));
+    }
+
+    template <typename T>
+    void Destroy(UniqueHandle<T>&& aHandle)
+    {
+        Destroy(aHandle.Release());
+    }
+
+    // Run aFunction once the frame being recorded has completed, e.g. to free a suballocation. Storing it may allocate.
+    template <typename F>
+    void Push(F&& aFunction)
+    {
+        Deletion lDeletion;
+        lDeletion.function = std::forward<F>(aFunction);
+
+        std::lock_guard<std::mutex> lLock{ mMutex };
+        mDeletions.emplace_back(std::move(lDeletion));
+    }
+
+    // Close the frame being recorded against the fence its last submission signals.
+    void EndFrame(const Fence& aFence)
+    {
+        std::lock_guard<std::mutex> lLock{ mMutex };
+
+        if (mDeletions.empty())
+            return;
+
+        Frame lFrame{ aFence, {} };
+
+        if (!mSpareLists.empty())
+        {
+            lFrame.deletions = std::move(mSpareLists.back());
+            mSpareLists.pop_back();
+        }
+
+        lFrame.deletions.swap(mDeletions);
+        mFrames.emplace_back(std::move(lFrame));
+    }
+
+    // Run the deletions of the leading frames whose fences have been signaled.
+    void Reclaim(void)
+    {
+        for (;;)
+        {
+            std::vector<Deletion> lDeletions;
+
+            {
+                std::lock_guard<std::mutex> lLock{ mMutex };
+
+                if (mFrames.empty() || mLogicalDevice.GetFenceStatus(mFrames.front().fence) != VK_SUCCESS)
+                    return;
+
+                lDeletions = std::move(mFrames.front().deletions);
+                mFrames.pop_front();
+            }
+
+            Retire(lDeletions);
+        }
+    }
+
+    // Wait for every closed frame and run everything queued, including the deletions not closed by EndFrame yet.
+    // For shutdown and the like: the fences of the closed frames must still exist, and nothing submitted may still use the open ones.
+    void Flush(void)
+    {
+        std::deque<Frame> lFrames;
+        std::vector<Deletion> lDeletions;
+
+        {
+            std::lock_guard<std::mutex> lLock{ mMutex };
+
+            lFrames.swap(mFrames);
+            lDeletions.swap(mDeletions);
+        }
+
+        for (auto& lFrame : lFrames)
+        {
+            mLogicalDevice.WaitForFence(lFrame.fence);
+            Run(lFrame.deletions);
+        }
+
+        Run(lDeletions);
+    }
+
+    // Number of frames closed but not retired yet.
+    std::size_t GetPendingFrameCount(void)
+    {
+        std::lock_guard<std::mutex> lLock{ mMutex };
+
+        return mFrames.size();
+    }
+};
+
+
+
+}                   // End of namespace vkpp.
+
+
+
+#endif              // __VKPP_MEMORY_DELETION_QUEUE_H__
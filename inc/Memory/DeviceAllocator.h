@@ -0,0 +1,548 @@
+#ifndef __VKPP_MEMORY_DEVICE_ALLOCATOR_H__
+#define __VKPP_MEMORY_DEVICE_ALLOCATOR_H__
+
+
+
+#include <array>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <algorithm>
+#include <stdexcept>
+
+#include <Info/Common.h>
+#include <Info/MemoryRequirements.h>
+#include <Info/PhysicalDeviceFeatures.h>
+
+#include <Type/PhysicalDevice.h>
+#include <Type/LogicalDevice.h>
+#include <Type/Memory.h>
+#include <Type/Buffer.h>
+#include <Type/Image.h>
+
+
+
+namespace vkpp
+{
+
+
+
+// Linear resources (buffers, linear images) and non-linear resources (optimal images) must not share a page of
+// PhysicalDeviceLimits::bufferImageGranularity bytes, so every sub-allocation remembers which kind it holds.
+enum class SubAllocationType
+{
+    eFree,
+    eLinear,
+    eNonLinear
+};
+
+
+
+inline constexpr DeviceSize AlignUp(DeviceSize aValue, DeviceSize aAlignment) noexcept
+{
+    return aAlignment > 1 ? (aValue + aAlignment - 1) / aAlignment * aAlignment : aValue;
+}
+
+
+inline constexpr DeviceSize AlignDown(DeviceSize aValue, DeviceSize aAlignment) noexcept
+{
+    return aAlignment > 1 ? aValue / aAlignment * aAlignment : aValue;
+}
+
+
+
+namespace internal
+{
+
+
+
+/**
+ * \class BlockMetadata
+ *
+ * \brief CPU-side book-keeping of a single device memory block.
+ *
+ * The block is described as an ordered list of contiguous sub-allocations which always covers the whole block;
+ * adjacent free ranges are merged on release. It never touches the device and can be exercised without a GPU.
+ */
+class BlockMetadata
+{
+private:
+    struct SubAllocation
+    {
+        DeviceSize          offset{ 0 };
+        DeviceSize          size{ 0 };
+        SubAllocationType   type{ SubAllocationType::eFree };
+    };
+
+    DeviceSize mSize{ 0 };
+    DeviceSize mFreeSize{ 0 };
+    DeviceSize mBufferImageGranularity{ 1 };
+    uint32_t mAllocationCount{ 0 };
+
+    std::vector<SubAllocation> mSubAllocations;
+
+    static constexpr bool IsConflict(SubAllocationType aLhs, SubAllocationType aRhs) noexcept
+    {
+        return (aLhs == SubAllocationType::eLinear && aRhs == SubAllocationType::eNonLinear)
+            || (aLhs == SubAllocationType::eNonLinear && aRhs == SubAllocationType::eLinear);
+    }
+
+    // bufferImageGranularity is guaranteed to be a power of two.
+    bool IsOnSamePage(DeviceSize aLastByteOfLhs, DeviceSize aFirstByteOfRhs) const noexcept
+    {
+        const auto lPageMask = ~(mBufferImageGranularity - 1);
+
+        return (aLastByteOfLhs & lPageMask) == (aFirstByteOfRhs & lPageMask);
+    }
+
+public:
+    BlockMetadata(DeviceSize aSize, DeviceSize aBufferImageGranularity = 1)
+        : mSize(aSize), mFreeSize(aSize), mBufferImageGranularity(std::max<DeviceSize>(aBufferImageGranularity, 1))
+    {
+        assert(aSize != 0);
+        assert((mBufferImageGranularity & (mBufferImageGranularity - 1)) == 0);
+
+        mSubAllocations.push_back({ 0, aSize, SubAllocationType::eFree });
+    }
+
+    // Aligned first-fit. Returns false if the block has no free range large enough.
+    bool Allocate(DeviceSize aSize, DeviceSize aAlignment, SubAllocationType aType, DeviceSize& aOffset)
+    {
+        assert(aSize != 0 && aType != SubAllocationType::eFree);
+
+        if (aSize > mFreeSize)
+            return false;
+
+        for (std::size_t lIndex = 0; lIndex < mSubAllocations.size(); ++lIndex)
+        {
+            const auto lFree = mSubAllocations[lIndex];
+
+            if (lFree.type != SubAllocationType::eFree || lFree.size < aSize)
+                continue;
+
+            auto lOffset = AlignUp(lFree.offset, aAlignment);
+
+            // Free ranges are always merged, so the previous neighbour is in use.
+            if (mBufferImageGranularity > 1 && lIndex > 0)
+            {
+                const auto& lPrev = mSubAllocations[lIndex - 1];
+
+                if (IsConflict(lPrev.type, aType) && IsOnSamePage(lPrev.offset + lPrev.size - 1, lOffset))
+                    lOffset = AlignUp(lOffset, mBufferImageGranularity);
+            }
+
+            if (lOffset + aSize > lFree.offset + lFree.size)
+                continue;
+
+            if (mBufferImageGranularity > 1 && lIndex + 1 < mSubAllocations.size())
+            {
+                const auto& lNext = mSubAllocations[lIndex + 1];
+
+                if (IsConflict(aType, lNext.type) && IsOnSamePage(lOffset + aSize - 1, lNext.offset))
+                    continue;
+            }
+
+            // Split the free range into [padding][allocation][remainder].
+            const auto lPadding = lOffset - lFree.offset;
+            const auto lRemainder = lFree.size - lPadding - aSize;
+
+            auto lIter = mSubAllocations.begin() + lIndex;
+            *lIter = { lOffset, aSize, aType };
+
+            if (lRemainder != 0)
+                lIter = mSubAllocations.insert(lIter + 1, { lOffset + aSize, lRemainder, SubAllocationType::eFree }) - 1;
+
+            if (lPadding != 0)
+                mSubAllocations.insert(lIter, { lFree.offset, lPadding, SubAllocationType::eFree });
+
+            mFreeSize -= aSize;
+            ++mAllocationCount;
+            aOffset = lOffset;
+
+            return true;
+        }
+
+        return false;
+    }
+
+    void Free(DeviceSize aOffset)
+    {
+        auto lIter = std::lower_bound(mSubAllocations.begin(), mSubAllocations.end(), aOffset, [](const SubAllocation& aSubAllocation, DeviceSize aValue)
+        {
+            return aSubAllocation.offset < aValue;
+        });
+
+        assert(lIter != mSubAllocations.end() && lIter->offset == aOffset && lIter->type != SubAllocationType::eFree);
+
+        mFreeSize += lIter->size;
+        --mAllocationCount;
+        lIter->type = SubAllocationType::eFree;
+
+        // Merge with the next free range.
+        const auto lNext = lIter + 1;
+
+        if (lNext != mSubAllocations.end() && lNext->type == SubAllocationType::eFree)
+        {
+            lIter->size += lNext->size;
+            lIter = mSubAllocations.erase(lNext) - 1;
+        }
+
+        // Merge with the previous free range.
+        if (lIter != mSubAllocations.begin())
+        {
+            const auto lPrev = lIter - 1;
+
+            if (lPrev->type == SubAllocationType::eFree)
+            {
+                lPrev->size += lIter->size;
+                mSubAllocations.erase(lIter);
+            }
+        }
+    }
+
+    DeviceSize GetSize(void) const noexcept
+    {
+        return mSize;
+    }
+
+    DeviceSize GetFreeSize(void) const noexcept
+    {
+        return mFreeSize;
+    }
+
+    uint32_t GetAllocationCount(void) const noexcept
+    {
+        return mAllocationCount;
+    }
+
+    bool IsEmpty(void) const noexcept
+    {
+        return mAllocationCount == 0;
+    }
+
+    std::size_t GetRangeCount(void) const noexcept
+    {
+        return mSubAllocations.size();
+    }
+};
+
+
+
+struct MemoryBlock
+{
+    DeviceMemory memory;
+    void* pMappedData{ nullptr };
+    BlockMetadata metadata;
+
+    MemoryBlock(const DeviceMemory& aMemory, void* apMappedData, DeviceSize aSize, DeviceSize aBufferImageGranularity)
+        : memory(aMemory), pMappedData(apMappedData), metadata(aSize, aBufferImageGranularity)
+    {}
+};
+
+
+
+}                   // End of namespace internal.
+
+
+
+/**
+ * \class MemoryAllocation
+ *
+ * \brief A range of device memory handed out by DeviceAllocator.
+ *
+ * memory and offset can be passed straight to LogicalDevice::BindBufferMemory/BindImageMemory;
+ * pMappedData already points at offset when the memory type is host visible.
+ */
+struct MemoryAllocation
+{
+    DeviceMemory            memory;
+    DeviceSize              offset{ 0 };
+    DeviceSize              size{ 0 };
+    void*                   pMappedData{ nullptr };
+    uint32_t                memoryTypeIndex{ UINT32_MAX };
+    internal::MemoryBlock*  pBlock{ nullptr };               // nullptr for dedicated allocations.
+
+    template <typename T>
+    T* Map(void) const noexcept
+    {
+        assert(pMappedData != nullptr);
+
+        return static_cast<T*>(pMappedData);
+    }
+
+    explicit operator bool(void) const noexcept
+    {
+        return memory != VK_NULL_HANDLE;
+    }
+};
+
+
+
+/**
+ * \class DeviceAllocator
+ *
+ * \brief Sub-allocates buffers and images out of large per memory type blocks.
+ *
+ * Requests larger than half a block get a dedicated vkAllocateMemory. Host visible blocks are mapped once for their whole lifetime.
+ */
+class DeviceAllocator
+{
+private:
+    const LogicalDevice& mLogicalDevice;
+    const PhysicalDeviceMemoryProperties& mMemoryProperties;
+
+    DeviceSize mBlockSize{ 0 };
+    DeviceSize mBufferImageGranularity{ 1 };
+    DeviceSize mNonCoherentAtomSize{ 1 };
+
+    std::array<std::vector<std::unique_ptr<internal::MemoryBlock>>, VK_MAX_MEMORY_TYPES> mBlocks;
+    uint32_t mDeviceMemoryCount{ 0 };
+
+    mutable std::mutex mMutex;
+
+    bool IsHostVisible(uint32_t aMemoryTypeIndex) const
+    {
+        return (mMemoryProperties.memoryTypes[aMemoryTypeIndex].propertyFlags & MemoryPropertyFlagBits::eHostVisible) == MemoryPropertyFlagBits::eHostVisible;
+    }
+
+    DeviceSize GetPreferredBlockSize(uint32_t aMemoryTypeIndex) const
+    {
+        const auto lHeapSize = mMemoryProperties.memoryHeaps[mMemoryProperties.memoryTypes[aMemoryTypeIndex].heapIndex].size;
+
+        // Small heaps (e.g. the 256 MiB device local + host visible heap) shouldn't be swallowed by a single block.
+        return std::min(mBlockSize, std::max<DeviceSize>(lHeapSize / 8, 1));
+    }
+
+    std::pair<DeviceMemory, void*> AllocateDeviceMemory(DeviceSize aSize, uint32_t aMemoryTypeIndex)
+    {
+        const auto& lDeviceMemory = mLogicalDevice.AllocateMemory({ aSize, aMemoryTypeIndex });
+        ++mDeviceMemoryCount;
+
+        void* lpMappedData = IsHostVisible(aMemoryTypeIndex) ? mLogicalDevice.MapMemory(lDeviceMemory) : nullptr;
+
+        return { lDeviceMemory, lpMappedData };
+    }
+
+    void FreeDeviceMemory(const DeviceMemory& aDeviceMemory, void* apMappedData)
+    {
+        if (apMappedData != nullptr)
+            mLogicalDevice.UnmapMemory(aDeviceMemory);
+
+        mLogicalDevice.FreeMemory(aDeviceMemory);
+        --mDeviceMemoryCount;
+    }
+
+public:
+    constexpr static DeviceSize DefaultBlockSize{ 256 * 1024 * 1024 };
+
+    DeviceAllocator(const LogicalDevice& aLogicalDevice, const PhysicalDeviceMemoryProperties& aMemoryProperties, const PhysicalDeviceLimits& aLimits, DeviceSize aBlockSize = DefaultBlockSize)
+        : mLogicalDevice(aLogicalDevice), mMemoryProperties(aMemoryProperties), mBlockSize(aBlockSize),
+          mBufferImageGranularity(std::max<DeviceSize>(aLimits.bufferImageGranularity, 1)),
+          mNonCoherentAtomSize(std::max<DeviceSize>(aLimits.nonCoherentAtomSize, 1))
+    {
+        assert(aBlockSize != 0);
+    }
+
+    DeviceAllocator(const DeviceAllocator&) = delete;
+    DeviceAllocator& operator=(const DeviceAllocator&) = delete;
+
+    ~DeviceAllocator(void)
+    {
+        Reset();
+    }
+
+    // Releases every block. All allocations handed out become invalid.
+    void Reset(void)
+    {
+        std::lock_guard<std::mutex> lLock{ mMutex };
+
+        for (auto& lBlocks : mBlocks)
+        {
+            for (auto& lBlock : lBlocks)
+            {
+                assert(lBlock->metadata.IsEmpty());
+                FreeDeviceMemory(lBlock->memory, lBlock->pMappedData);
+            }
+
+            lBlocks.clear();
+        }
+    }
+
+    // Return the index of the first memory type allowed by aMemoryTypeBits that supports all the requested property flags; throws if there is none.
+    uint32_t GetMemoryTypeIndex(uint32_t aMemoryTypeBits, const MemoryPropertyFlags& aMemoryProperties) const
+    {
+        for (uint32_t lIndex = 0; lIndex < mMemoryProperties.memoryTypeCount; ++lIndex)
+        {
+            if ((aMemoryTypeBits & (1 << lIndex)) && (mMemoryProperties.memoryTypes[lIndex].propertyFlags & aMemoryProperties) == aMemoryProperties)
+                return lIndex;
+        }
+
+        // Indexing the per-type blocks with a sentinel would run past them, so this has to fail in release builds too.
+        throw std::runtime_error{ "No memory type supports the requested memory properties." };
+    }
+
+    bool IsHostCoherent(const MemoryAllocation& aAllocation) const
+    {
+        return (mMemoryProperties.memoryTypes[aAllocation.memoryTypeIndex].propertyFlags & MemoryPropertyFlagBits::eHostCoherent) == MemoryPropertyFlagBits::eHostCoherent;
+    }
+
+    MemoryAllocation Allocate(const MemoryRequirements& aMemoryRequirements, const MemoryPropertyFlags& aMemoryProperties, SubAllocationType aType)
+    {
+        const auto lMemoryTypeIndex = GetMemoryTypeIndex(aMemoryRequirements.memoryTypeBits, aMemoryProperties);
+        assert(lMemoryTypeIndex < VK_MAX_MEMORY_TYPES);
+
+        const auto lBlockSize = GetPreferredBlockSize(lMemoryTypeIndex);
+
+        std::lock_guard<std::mutex> lLock{ mMutex };
+
+        MemoryAllocation lAllocation;
+        lAllocation.size = aMemoryRequirements.size;
+        lAllocation.memoryTypeIndex = lMemoryTypeIndex;
+
+        // Large resources get their own device memory.
+        if (aMemoryRequirements.size > lBlockSize / 2)
+        {
+            std::tie(lAllocation.memory, lAllocation.pMappedData) = AllocateDeviceMemory(aMemoryRequirements.size, lMemoryTypeIndex);
+
+            return lAllocation;
+        }
+
+        auto& lBlocks = mBlocks[lMemoryTypeIndex];
+        DeviceSize lOffset{ 0 };
+
+        auto lIter = std::find_if(lBlocks.begin(), lBlocks.end(), [&](const auto& aBlock)
+        {
+            return aBlock->metadata.Allocate(aMemoryRequirements.size, aMemoryRequirements.alignment, aType, lOffset);
+        });
+
+        if (lIter == lBlocks.end())
+        {
+            const auto& lDeviceMemory = AllocateDeviceMemory(lBlockSize, lMemoryTypeIndex);
+
+            lBlocks.emplace_back(std::make_unique<internal::MemoryBlock>(lDeviceMemory.first, lDeviceMemory.second, lBlockSize, mBufferImageGranularity));
+            lIter = lBlocks.end() - 1;
+
+            const auto lResult = (*lIter)->metadata.Allocate(aMemoryRequirements.size, aMemoryRequirements.alignment, aType, lOffset);
+            assert(lResult);
+        }
+
+        lAllocation.memory = (*lIter)->memory;
+        lAllocation.offset = lOffset;
+        lAllocation.pBlock = lIter->get();
+
+        if ((*lIter)->pMappedData != nullptr)
+            lAllocation.pMappedData = static_cast<char*>((*lIter)->pMappedData) + lOffset;
+
+        return lAllocation;
+    }
+
+    void Free(MemoryAllocation& aAllocation)
+    {
+        if (!aAllocation)
+            return;
+
+        std::lock_guard<std::mutex> lLock{ mMutex };
+
+        if (aAllocation.pBlock == nullptr)
+            FreeDeviceMemory(aAllocation.memory, aAllocation.pMappedData);
+        else
+        {
+            auto& lBlocks = mBlocks[aAllocation.memoryTypeIndex];
+            aAllocation.pBlock->metadata.Free(aAllocation.offset);
+
+            // Keep one empty block around per memory type to avoid allocation churn.
+            if (aAllocation.pBlock->metadata.IsEmpty() && lBlocks.size() > 1)
+            {
+                auto lIter = std::find_if(lBlocks.begin(), lBlocks.end(), [&aAllocation](const auto& aBlock)
+                {
+                    return aBlock.get() == aAllocation.pBlock;
+                });
+
+                assert(lIter != lBlocks.end());
+
+                FreeDeviceMemory((*lIter)->memory, (*lIter)->pMappedData);
+                lBlocks.erase(lIter);
+            }
+        }
+
+        aAllocation = MemoryAllocation{};
+    }
+
+    MemoryAllocation AllocateBufferMemory(const Buffer& aBuffer, const MemoryPropertyFlags& aMemoryProperties)
+    {
+        const auto& lAllocation = Allocate(mLogicalDevice.GetBufferMemoryRequirements(aBuffer), aMemoryProperties, SubAllocationType::eLinear);
+        mLogicalDevice.BindBufferMemory(aBuffer, lAllocation.memory, lAllocation.offset);
+
+        return lAllocation;
+    }
+
+    MemoryAllocation AllocateImageMemory(const Image& aImage, const MemoryPropertyFlags& aMemoryProperties, ImageTiling aTiling = ImageTiling::eOptimal)
+    {
+        const auto lType = aTiling == ImageTiling::eLinear ? SubAllocationType::eLinear : SubAllocationType::eNonLinear;
+
+        const auto& lAllocation = Allocate(mLogicalDevice.GetImageMemoryRequirements(aImage), aMemoryProperties, lType);
+        mLogicalDevice.BindImageMemory(aImage, lAllocation.memory, lAllocation.offset);
+
+        return lAllocation;
+    }
+
+    // Returns a range covering [aOffset, aOffset + aSize) of the allocation, widened to nonCoherentAtomSize.
+    MappedMemoryRange GetMappedMemoryRange(const MemoryAllocation& aAllocation, DeviceSize aOffset = 0, DeviceSize aSize = WholeSize) const
+    {
+        assert(aAllocation && aOffset <= aAllocation.size);
+
+        if (aSize == WholeSize)
+            aSize = aAllocation.size - aOffset;
+
+        const auto lBegin = AlignDown(aAllocation.offset + aOffset, mNonCoherentAtomSize);
+        auto lEnd = AlignUp(aAllocation.offset + aOffset + aSize, mNonCoherentAtomSize);
+
+        // Never run past the end of the device memory object.
+        const auto lMemorySize = aAllocation.pBlock != nullptr ? aAllocation.pBlock->metadata.GetSize() : aAllocation.size;
+        lEnd = std::min(lEnd, lMemorySize);
+
+        return { aAllocation.memory, lBegin, lEnd - lBegin };
+    }
+
+    void Flush(const MemoryAllocation& aAllocation, DeviceSize aOffset = 0, DeviceSize aSize = WholeSize) const
+    {
+        if (!IsHostCoherent(aAllocation))
+            mLogicalDevice.FlushMappedMemoryRange(GetMappedMemoryRange(aAllocation, aOffset, aSize));
+    }
+
+    void Invalidate(const MemoryAllocation& aAllocation, DeviceSize aOffset = 0, DeviceSize aSize = WholeSize) const
+    {
+        if (!IsHostCoherent(aAllocation))
+            mLogicalDevice.InvalidateMappedMemoryRanges({ GetMappedMemoryRange(aAllocation, aOffset, aSize) });
+    }
+
+    DeviceSize GetBufferImageGranularity(void) const noexcept
+    {
+        return mBufferImageGranularity;
+    }
+
+    DeviceSize GetNonCoherentAtomSize(void) const noexcept
+    {
+        return mNonCoherentAtomSize;
+    }
+
+    // Number of live vkAllocateMemory objects, including dedicated allocations.
+    uint32_t GetDeviceMemoryCount(void) const noexcept
+    {
+        return mDeviceMemoryCount;
+    }
+
+    const LogicalDevice& GetLogicalDevice(void) const noexcept
+    {
+        return mLogicalDevice;
+    }
+};
+
+
+
+}                   // End of namespace vkpp.
+
+
+
+#endif              // __VKPP_MEMORY_DEVICE_ALLOCATOR_H__
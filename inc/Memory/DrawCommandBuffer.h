@@ -0,0 +1,166 @@
+#ifndef __VKPP_MEMORY_DRAW_COMMAND_BUFFER_H__
+#define __VKPP_MEMORY_DRAW_COMMAND_BUFFER_H__
+
+
+
+#include <algorithm>
+
+#include <Info/Common.h>
+#include <Info/PhysicalDeviceFeatures.h>
+
+#include <Type/LogicalDevice.h>
+#include <Type/Buffer.h>
+#include <Type/CommandBuffer.h>
+#include <Memory/DeviceAllocator.h>
+
+
+
+namespace vkpp
+{
+
+
+
+/**
+ * \class DrawCommandBuffer
+ *
+ * \brief Packs DrawIndexedIndirectCommand records into a persistently mapped indirect buffer and records them as a few multi-draw commands.
+ *
+ * The buffer holds one region of aMaxDrawCount records per frame in flight. BeginFrame selects and clears the region of a frame, which the
+ * device must be done with, i.e. its fence has been waited on. Objects then differ only by their indirect record, so per-object data has to be
+ * reached through firstInstance (gl_InstanceIndex) or a bindless handle rather than per-draw bindings.
+ */
+class DrawCommandBuffer
+{
+private:
+    DeviceAllocator& mAllocator;
+    const LogicalDevice& mLogicalDevice;
+
+    const uint32_t mMaxDrawCount;
+    const uint32_t mFrameCount;
+
+    Buffer mBuffer;
+    MemoryAllocation mAllocation;
+
+    uint32_t mFrameIndex{ 0 };
+    uint32_t mDrawCount{ 0 };
+    uint32_t mFlushedCount{ 0 };
+
+    DrawIndexedIndirectCommand* GetFrameData(void) const noexcept
+    {
+        return mAllocation.Map<DrawIndexedIndirectCommand>() + static_cast<std::size_t>(mFrameIndex) * mMaxDrawCount;
+    }
+
+public:
+    static constexpr uint32_t Stride = sizeof(DrawIndexedIndirectCommand);
+
+    DrawCommandBuffer(DeviceAllocator& aAllocator, uint32_t aMaxDrawCount, uint32_t aFrameCount = 1,
+        const MemoryPropertyFlags& aMemoryProperties = MemoryPropertyFlagBits::eHostVisible)
+        : mAllocator(aAllocator), mLogicalDevice(aAllocator.GetLogicalDevice()), mMaxDrawCount(aMaxDrawCount), mFrameCount(aFrameCount)
+    {
+        assert(aMaxDrawCount != 0 && aFrameCount != 0);
+
+        mBuffer = mLogicalDevice.CreateBuffer({ static_cast<DeviceSize>(aMaxDrawCount) * aFrameCount * Stride, BufferUsageFlagBits::eIndirectBuffer });
+        mAllocation = mAllocator.AllocateBufferMemory(mBuffer, aMemoryProperties | MemoryPropertyFlagBits::eHostVisible);
+
+        assert(mAllocation.pMappedData != nullptr);
+    }
+
+    DrawCommandBuffer(const DrawCommandBuffer&) = delete;
+    DrawCommandBuffer& operator=(const DrawCommandBuffer&) = delete;
+
+    ~DrawCommandBuffer(void)
+    {
+        mAllocator.Free(mAllocation);
+        mLogicalDevice.DestroyBuffer(mBuffer);
+    }
+
+    void BeginFrame(uint32_t aFrameIndex)
+    {
+        assert(aFrameIndex < mFrameCount);
+
+        mFrameIndex = aFrameIndex;
+        mDrawCount = 0;
+        mFlushedCount = 0;
+    }
+
+    // Returns the index of the record in the frame, e.g. to patch it later with GetCommand.
+    uint32_t Add(const DrawIndexedIndirectCommand& aCommand)
+    {
+        assert(mDrawCount < mMaxDrawCount);
+
+        GetFrameData()[mDrawCount] = aCommand;
+
+        return mDrawCount++;
+    }
+
+    uint32_t Add(uint32_t aIndexCount, uint32_t aInstanceCount = 1, uint32_t aFirstIndex = 0, int32_t aVertexOffset = 0, uint32_t aFirstInstance = 0)
+    {
+        return Add({ aIndexCount, aInstanceCount, aFirstIndex, aVertexOffset, aFirstInstance });
+    }
+
+    DrawIndexedIndirectCommand& GetCommand(uint32_t aIndex) noexcept
+    {
+        assert(aIndex < mDrawCount);
+
+        return GetFrameData()[aIndex];
+    }
+
+    // Make the records added since the previous flush visible to the device; a no-op on coherent memory.
+    void Flush(void)
+    {
+        if (mFlushedCount == mDrawCount)
+            return;
+
+        mAllocator.Flush(mAllocation, GetOffset() + static_cast<DeviceSize>(mFlushedCount) * Stride, static_cast<DeviceSize>(mDrawCount - mFlushedCount) * Stride);
+        mFlushedCount = mDrawCount;
+    }
+
+    // Largest draw count one indirect command may carry on a device created with aEnabledFeatures.
+    static uint32_t GetMaxDrawsPerCommand(const PhysicalDeviceFeatures& aEnabledFeatures, const PhysicalDeviceLimits& aLimits) noexcept
+    {
+        return aEnabledFeatures.multiDrawIndirect ? std::max(aLimits.maxDrawIndirectCount, 1u) : 1;
+    }
+
+    // Record every draw of the frame inside a render pass, with the pipeline, vertex and index buffers already bound.
+    // aMaxDrawsPerCommand comes from GetMaxDrawsPerCommand; the default of one draw per command is valid on every device.
+    // A non-zero firstInstance needs the drawIndirectFirstInstance feature.
+    void Record(const CommandBuffer& aCommandBuffer, uint32_t aMaxDrawsPerCommand = 1) const
+    {
+        assert(aMaxDrawsPerCommand != 0);
+
+        for (uint32_t lFirstDraw = 0; lFirstDraw < mDrawCount; lFirstDraw += aMaxDrawsPerCommand)
+        {
+            aCommandBuffer.DrawIndexedIndirect(mBuffer, GetOffset() + static_cast<DeviceSize>(lFirstDraw) * Stride,
+                std::min(aMaxDrawsPerCommand, mDrawCount - lFirstDraw), Stride);
+        }
+    }
+
+    const Buffer& GetBuffer(void) const noexcept
+    {
+        return mBuffer;
+    }
+
+    // Offset of the current frame's records, e.g. for LogicalDevice::DrawIndexedIndirectCount.
+    DeviceSize GetOffset(void) const noexcept
+    {
+        return static_cast<DeviceSize>(mFrameIndex) * mMaxDrawCount * Stride;
+    }
+
+    uint32_t GetDrawCount(void) const noexcept
+    {
+        return mDrawCount;
+    }
+
+    uint32_t GetMaxDrawCount(void) const noexcept
+    {
+        return mMaxDrawCount;
+    }
+};
+
+
+
+}                   // End of namespace vkpp.
+
+
+
+#endif              // __VKPP_MEMORY_DRAW_COMMAND_BUFFER_H__
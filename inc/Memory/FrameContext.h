@@ -0,0 +1,247 @@
+#ifndef __VKPP_MEMORY_FRAME_CONTEXT_H__
+#define __VKPP_MEMORY_FRAME_CONTEXT_H__
+
+
+
+#include <vector>
+
+#include <Info/Common.h>
+
+#include <Type/LogicalDevice.h>
+#include <Type/CommandPool.h>
+#include <Type/CommandBuffer.h>
+#include <Type/Semaphore.h>
+#include <Type/Fence.h>
+#include <Type/Queue.h>
+#include <Type/Swapchain.h>
+#include <Memory/RingBuffer.h>
+#include <Memory/DeletionQueue.h>
+
+
+
+namespace vkpp
+{
+
+
+
+// Everything one frame in flight owns. Nothing in here may be touched by the CPU until the frame's fence is signaled.
+struct FrameContext
+{
+    CommandPool                 commandPool;
+    std::vector<CommandBuffer>  commandBuffers;                     // Allocated on demand, kept across ResetCommandPool.
+    uint32_t                    commandBufferCount{ 0 };            // Handed out since the frame began.
+
+    Semaphore                   acquireSemaphore;                   // Signaled once the swapchain image is available.
+    Semaphore                   renderSemaphore;                    // Signaled by the frame's last submission, waited on by Present.
+    Fence                       fence;                              // Signaled once every submission of the frame has completed.
+    bool                        fenceSubmitted{ true };             // False from BeginFrame's reset until Submit, when nothing would ever signal the fence.
+
+    uint32_t                    imageIndex{ UINT32_MAX };
+};
+
+
+
+/**
+ * \class FrameContextRing
+ *
+ * \brief Cycles through N frame contexts so the CPU records frame i + 1 while the GPU is still busy with frame i.
+ *
+ * A frame goes through BeginFrame, any number of AllocateCommandBuffer, exactly one Submit signaling the frame fence, then Present.
+ * BeginFrame only blocks on the fence of the frame submitted N frames ago, and recycles that frame's command buffers wholesale with vkResetCommandPool.
+ * An optional transient RingBuffer is closed against the frame fence on Submit and reclaimed on BeginFrame, and so is an optional DeletionQueue.
+ */
+class FrameContextRing
+{
+private:
+    const LogicalDevice& mLogicalDevice;
+
+    std::vector<FrameContext> mFrames;
+    uint32_t mFrameIndex{ 0 };
+    uint64_t mFrameNumber{ 0 };
+
+    RingBuffer* mpTransientBuffer{ nullptr };
+    DeletionQueue* mpDeletionQueue{ nullptr };
+
+    void SubmitFrame(const Queue& aQueue, const SubmitInfo& aSubmitInfo)
+    {
+        auto& lFrame = mFrames[mFrameIndex];
+
+        if (mpTransientBuffer != nullptr)
+            mpTransientBuffer->EndFrame(lFrame.fence);
+
+        if (mpDeletionQueue != nullptr)
+            mpDeletionQueue->EndFrame(lFrame.fence);
+
+        aQueue.Submit(aSubmitInfo, lFrame.fence);
+        lFrame.fenceSubmitted = true;
+    }
+
+public:
+    constexpr static uint32_t DefaultFrameCount{ 2 };
+
+    FrameContextRing(const LogicalDevice& aLogicalDevice, uint32_t aQueueFamilyIndex, uint32_t aFrameCount = DefaultFrameCount, RingBuffer* apTransientBuffer = nullptr,
+        DeletionQueue* apDeletionQueue = nullptr)
+        : mLogicalDevice(aLogicalDevice), mFrames(aFrameCount), mpTransientBuffer(apTransientBuffer), mpDeletionQueue(apDeletionQueue)
+    {
+        assert(aFrameCount != 0);
+
+        const CommandPoolCreateInfo lCommandPoolCreateInfo{ aQueueFamilyIndex, CommandPoolCreateFlagBits::eTransient };
+        constexpr SemaphoreCreateInfo lSemaphoreCreateInfo;
+
+        // Created signaled so that the first BeginFrame of every context does not block.
+        constexpr FenceCreateInfo lFenceCreateInfo{ FenceCreateFlagBits::eSignaled };
+
+        for (auto& lFrame : mFrames)
+        {
+            lFrame.commandPool = mLogicalDevice.CreateCommandPool(lCommandPoolCreateInfo);
+            lFrame.acquireSemaphore = mLogicalDevice.CreateSemaphore(lSemaphoreCreateInfo);
+            lFrame.renderSemaphore = mLogicalDevice.CreateSemaphore(lSemaphoreCreateInfo);
+            lFrame.fence = mLogicalDevice.CreateFence(lFenceCreateInfo);
+        }
+    }
+
+    FrameContextRing(const FrameContextRing&) = delete;
+    FrameContextRing& operator=(const FrameContextRing&) = delete;
+
+    ~FrameContextRing(void)
+    {
+        WaitIdle();
+
+        for (auto& lFrame : mFrames)
+        {
+            // Destroying the pool frees its command buffers.
+            mLogicalDevice.DestroyCommandPool(lFrame.commandPool);
+            mLogicalDevice.DestroySemaphore(lFrame.acquireSemaphore);
+            mLogicalDevice.DestroySemaphore(lFrame.renderSemaphore);
+            mLogicalDevice.DestroyFence(lFrame.fence);
+        }
+    }
+
+    // Wait until the current context is free again, recycle it and acquire the next swapchain image.
+    FrameContext& BeginFrame(const khr::Swapchain& aSwapchain)
+    {
+        auto& lFrame = mFrames[mFrameIndex];
+
+        mLogicalDevice.WaitForFence(lFrame.fence);
+
+        // The ring and the deletion queue must see the fence signaled before it gets reset.
+        if (mpTransientBuffer != nullptr)
+            mpTransientBuffer->Reclaim();
+
+        if (mpDeletionQueue != nullptr)
+            mpDeletionQueue->Reclaim();
+
+        lFrame.imageIndex = mLogicalDevice.AcquireNextImage(aSwapchain, lFrame.acquireSemaphore);
+
+        mLogicalDevice.ResetFence(lFrame.fence);
+        lFrame.fenceSubmitted = false;
+
+        mLogicalDevice.ResetCommandPool(lFrame.commandPool);
+        lFrame.commandBufferCount = 0;
+
+        return lFrame;
+    }
+
+    // A command buffer of the current frame, valid until the context comes around again. It has to be begun by the caller.
+    const CommandBuffer& AllocateCommandBuffer(void)
+    {
+        auto& lFrame = mFrames[mFrameIndex];
+
+        if (lFrame.commandBufferCount == lFrame.commandBuffers.size())
+            lFrame.commandBuffers.emplace_back(mLogicalDevice.AllocateCommandBuffer({ lFrame.commandPool }));
+
+        return lFrame.commandBuffers[lFrame.commandBufferCount++];
+    }
+
+    // Submit the frame's last batch: wait for the swapchain image at aWaitDstStageMask, signal the render semaphore and the frame fence.
+    void Submit(const Queue& aQueue, const CommandBuffer& aCommandBuffer,
+        const PipelineStageFlags& aWaitDstStageMask = PipelineStageFlagBits::eColorAttachmentOutput)
+    {
+        const auto& lFrame = mFrames[mFrameIndex];
+
+        const SubmitInfo lSubmitInfo
+        {
+            1, lFrame.acquireSemaphore.AddressOf(),
+            &aWaitDstStageMask,
+            1, aCommandBuffer.AddressOf(),
+            1, lFrame.renderSemaphore.AddressOf()
+        };
+
+        SubmitFrame(aQueue, lSubmitInfo);
+    }
+
+    // Same as above for frames split into several batches; aSubmitInfo is responsible for the frame semaphores.
+    void Submit(const Queue& aQueue, const SubmitInfo& aSubmitInfo)
+    {
+        SubmitFrame(aQueue, aSubmitInfo);
+    }
+
+    void Present(const Queue& aQueue, const khr::Swapchain& aSwapchain)
+    {
+        const auto& lFrame = mFrames[mFrameIndex];
+
+        const khr::PresentInfo lPresentInfo
+        {
+            1, lFrame.renderSemaphore.AddressOf(),
+            1, aSwapchain.AddressOf(),
+            &lFrame.imageIndex
+        };
+
+        aQueue.Present(lPresentInfo);
+
+        mFrameIndex = (mFrameIndex + 1) % static_cast<uint32_t>(mFrames.size());
+        ++mFrameNumber;
+    }
+
+    // Wait for every frame in flight, e.g. before destroying resources they reference.
+    // May be called between BeginFrame and Submit: the current frame's fence is reset then, and nothing of that frame is in flight yet.
+    void WaitIdle(void) const
+    {
+        for (const auto& lFrame : mFrames)
+        {
+            if (lFrame.fenceSubmitted)
+                mLogicalDevice.WaitForFence(lFrame.fence);
+        }
+
+        if (mpTransientBuffer != nullptr)
+            mpTransientBuffer->Reclaim();
+
+        if (mpDeletionQueue != nullptr)
+            mpDeletionQueue->Reclaim();
+    }
+
+    FrameContext& GetCurrentFrame(void) noexcept
+    {
+        return mFrames[mFrameIndex];
+    }
+
+    const FrameContext& GetCurrentFrame(void) const noexcept
+    {
+        return mFrames[mFrameIndex];
+    }
+
+    uint32_t GetFrameCount(void) const noexcept
+    {
+        return static_cast<uint32_t>(mFrames.size());
+    }
+
+    // Index of the current context, for keeping other per-frame resources in step with the ring.
+    uint32_t GetFrameIndex(void) const noexcept
+    {
+        return mFrameIndex;
+    }
+
+    // Number of frames presented so far.
+    uint64_t GetFrameNumber(void) const noexcept
+    {
+        return mFrameNumber;
+    }
+};
+
+
+
+}                   // End of namespace vkpp.
+
+
+
+#endif              // __VKPP_MEMORY_FRAME_CONTEXT_H__
@@ -0,0 +1,147 @@
+#ifndef __VKPP_MEMORY_PARALLEL_COMMAND_RECORDER_H__
+#define __VKPP_MEMORY_PARALLEL_COMMAND_RECORDER_H__
+
+
+
+#include <vector>
+
+#include <Info/Common.h>
+
+#include <Type/LogicalDevice.h>
+#include <Type/CommandPool.h>
+#include <Type/CommandBuffer.h>
+#include <Memory/ThreadPool.h>
+#include <Memory/FrameContext.h>
+
+
+
+namespace vkpp
+{
+
+
+
+/**
+ * \class ParallelCommandRecorder
+ *
+ * \brief Records the contents of a render pass into secondary command buffers on a ThreadPool.
+ *
+ * Every worker thread owns one CommandPool per frame in flight, so recording never takes a lock and a frame's pools are reset wholesale.
+ * The secondary command buffers are executed in job order, whichever thread recorded them.
+ */
+class ParallelCommandRecorder
+{
+private:
+    struct ThreadContext
+    {
+        CommandPool                 commandPool;
+        std::vector<CommandBuffer>  commandBuffers;
+        uint32_t                    commandBufferCount{ 0 };
+    };
+
+    const LogicalDevice& mLogicalDevice;
+    ThreadPool& mThreadPool;
+
+    std::vector<std::vector<ThreadContext>> mFrames;       // [frame][worker]
+    uint32_t mFrameIndex{ 0 };
+
+    std::vector<CommandBuffer> mSecondaryCommandBuffers;    // [job]
+
+    const CommandBuffer& AllocateCommandBuffer(uint32_t aWorkerIndex)
+    {
+        auto& lThread = mFrames[mFrameIndex][aWorkerIndex];
+
+        if (lThread.commandBufferCount == lThread.commandBuffers.size())
+            lThread.commandBuffers.emplace_back(mLogicalDevice.AllocateCommandBuffer({ lThread.commandPool, CommandBufferLevel::eSecondary }));
+
+        return lThread.commandBuffers[lThread.commandBufferCount++];
+    }
+
+public:
+    ParallelCommandRecorder(const LogicalDevice& aLogicalDevice, ThreadPool& aThreadPool, uint32_t aQueueFamilyIndex,
+        uint32_t aFrameCount = FrameContextRing::DefaultFrameCount)
+        : mLogicalDevice(aLogicalDevice), mThreadPool(aThreadPool), mFrames(aFrameCount)
+    {
+        assert(aFrameCount != 0);
+
+        const CommandPoolCreateInfo lCommandPoolCreateInfo{ aQueueFamilyIndex, CommandPoolCreateFlagBits::eTransient };
+
+        for (auto& lFrame : mFrames)
+        {
+            lFrame.resize(mThreadPool.GetThreadCount());
+
+            for (auto& lThread : lFrame)
+                lThread.commandPool = mLogicalDevice.CreateCommandPool(lCommandPoolCreateInfo);
+        }
+    }
+
+    ParallelCommandRecorder(const ParallelCommandRecorder&) = delete;
+    ParallelCommandRecorder& operator=(const ParallelCommandRecorder&) = delete;
+
+    // The command buffers must no longer be pending execution.
+    ~ParallelCommandRecorder(void)
+    {
+        for (const auto& lFrame : mFrames)
+        {
+            for (const auto& lThread : lFrame)
+                mLogicalDevice.DestroyCommandPool(lThread.commandPool);
+        }
+    }
+
+    // Recycle the pools of aFrameIndex, e.g. FrameContextRing::GetFrameIndex right after BeginFrame waited for that frame's fence.
+    void BeginFrame(uint32_t aFrameIndex)
+    {
+        assert(aFrameIndex < mFrames.size());
+
+        mFrameIndex = aFrameIndex;
+
+        for (auto& lThread : mFrames[mFrameIndex])
+        {
+            mLogicalDevice.ResetCommandPool(lThread.commandPool);
+            lThread.commandBufferCount = 0;
+        }
+    }
+
+    // Record aJobCount secondary command buffers in parallel with aRecordJob(aCommandBuffer, aJobIndex), then execute them in job order
+    // from aPrimaryCommandBuffer. The render pass described by aInheritanceInfo must have been begun with SubpassContents::eSecondaryCommandBuffers.
+    // Secondary command buffers inherit no state: each job binds its own pipeline, buffers and dynamic state.
+    template <typename F>
+    void Record(const CommandBuffer& aPrimaryCommandBuffer, const CommandBufferInheritanceInfo& aInheritanceInfo, uint32_t aJobCount, F&& aRecordJob)
+    {
+        if (aJobCount == 0)
+            return;
+
+        mSecondaryCommandBuffers.resize(aJobCount);
+
+        const CommandBufferBeginInfo lBeginInfo
+        {
+            CommandBufferUsageFlagBits::eOneTimeSubmit | CommandBufferUsageFlagBits::eRenderPassContinue,
+            aInheritanceInfo
+        };
+
+        mThreadPool.Run(aJobCount, [this, &lBeginInfo, &aRecordJob](uint32_t aWorkerIndex, uint32_t aJobIndex)
+        {
+            const auto& lCommandBuffer = AllocateCommandBuffer(aWorkerIndex);
+
+            lCommandBuffer.Begin(lBeginInfo);
+            aRecordJob(lCommandBuffer, aJobIndex);
+            lCommandBuffer.End();
+
+            mSecondaryCommandBuffers[aJobIndex] = lCommandBuffer;
+        });
+
+        aPrimaryCommandBuffer.Execute(mSecondaryCommandBuffers);
+    }
+
+    uint32_t GetThreadCount(void) const noexcept
+    {
+        return mThreadPool.GetThreadCount();
+    }
+};
+
+
+
+}                   // End of namespace vkpp.
+
+
+
+#endif              // __VKPP_MEMORY_PARALLEL_COMMAND_RECORDER_H__
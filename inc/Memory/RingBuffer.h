@@ -0,0 +1,292 @@
+#ifndef __VKPP_MEMORY_RING_BUFFER_H__
+#define __VKPP_MEMORY_RING_BUFFER_H__
+
+
+
+#include <deque>
+#include <cstring>
+#include <algorithm>
+#include <type_traits>
+
+#include <Info/Common.h>
+
+#include <Type/LogicalDevice.h>
+#include <Type/Buffer.h>
+#include <Type/Fence.h>
+#include <Memory/DeviceAllocator.h>
+
+
+
+namespace vkpp
+{
+
+
+
+struct RingAllocation
+{
+    Buffer      buffer;
+    DeviceSize  offset{ 0 };
+    DeviceSize  size{ 0 };
+    void*       pMappedData{ nullptr };
+
+    template <typename T>
+    T* Map(void) const noexcept
+    {
+        assert(pMappedData != nullptr);
+
+        return static_cast<T*>(pMappedData);
+    }
+
+    // Dynamic offsets passed to BindGraphicsDescriptorSet/BindComputeDescriptorSet are 32-bit.
+    uint32_t DynamicOffset(void) const noexcept
+    {
+        assert(offset <= UINT32_MAX);
+
+        return static_cast<uint32_t>(offset);
+    }
+};
+
+
+
+/**
+ * \class RingBuffer
+ *
+ * \brief Linear allocator over one persistently mapped host visible buffer.
+ *
+ * Ranges handed out during a frame are released together once the fence passed to EndFrame is signaled.
+ * The fence must not be reset before the frame has been reclaimed, i.e. call Reclaim (or Allocate) after waiting for it and before resetting it.
+ * For non-coherent memory, Flush issues a single vkFlushMappedMemoryRanges covering everything written since the previous flush.
+ */
+class RingBuffer
+{
+private:
+    struct Frame
+    {
+        Fence       fence;
+        DeviceSize  size{ 0 };
+    };
+
+    DeviceAllocator& mAllocator;
+    const LogicalDevice& mLogicalDevice;
+
+    Buffer mBuffer;
+    MemoryAllocation mAllocation;
+    bool mIsCoherent{ true };
+
+    DeviceSize mSize{ 0 };
+    DeviceSize mAlignment{ 1 };
+
+    DeviceSize mHead{ 0 };                      // Next byte to hand out.
+    DeviceSize mTail{ 0 };                      // First byte still in use by the GPU.
+    DeviceSize mUsedSize{ 0 };                  // Bytes in [mTail, mHead), accounting for wrap-around.
+    DeviceSize mFrameSize{ 0 };                 // Bytes consumed by the frame being recorded.
+
+    DeviceSize mFlushOffset{ 0 };
+    DeviceSize mFlushSize{ 0 };
+
+    std::deque<Frame> mFrames;
+
+    void Retire(void)
+    {
+        const auto& lFrame = mFrames.front();
+
+        mTail = (mTail + lFrame.size) % mSize;
+        mUsedSize -= lFrame.size;
+        mFrames.pop_front();
+
+        // Restart from the beginning once everything has been retired to reduce wrap-around waste.
+        if (mUsedSize == 0 && mFrameSize == 0 && mFlushSize == 0)
+            mHead = mTail = mFlushOffset = 0;
+    }
+
+    // Bytes an allocation at aOffset takes from the ring, including padding and the tail skipped on wrap-around.
+    DeviceSize GetConsumedSize(DeviceSize aSize, DeviceSize aAlignment, DeviceSize& aOffset) const noexcept
+    {
+        aOffset = AlignUp(mHead, std::max(aAlignment, mAlignment));
+
+        // Never split an allocation across the end of the buffer; the skipped bytes belong to this frame.
+        if (aOffset + aSize > mSize)
+        {
+            aOffset = 0;
+            return mSize - mHead + aSize;
+        }
+
+        return aOffset + aSize - mHead;
+    }
+
+public:
+    RingBuffer(DeviceAllocator& aAllocator, DeviceSize aSize, const BufferUsageFlags& aUsage, DeviceSize aAlignment = 1,
+        const MemoryPropertyFlags& aMemoryProperties = MemoryPropertyFlagBits::eHostVisible)
+        : mAllocator(aAllocator), mLogicalDevice(aAllocator.GetLogicalDevice()), mSize(aSize), mAlignment(std::max<DeviceSize>(aAlignment, 1))
+    {
+        assert(aSize != 0);
+
+        mBuffer = mLogicalDevice.CreateBuffer({ aSize, aUsage });
+        mAllocation = mAllocator.AllocateBufferMemory(mBuffer, aMemoryProperties | MemoryPropertyFlagBits::eHostVisible);
+        mIsCoherent = mAllocator.IsHostCoherent(mAllocation);
+
+        assert(mAllocation.pMappedData != nullptr);
+    }
+
+    RingBuffer(const RingBuffer&) = delete;
+    RingBuffer& operator=(const RingBuffer&) = delete;
+
+    ~RingBuffer(void)
+    {
+        mAllocator.Free(mAllocation);
+        mLogicalDevice.DestroyBuffer(mBuffer);
+    }
+
+    // Uniform buffer ranges have to honour PhysicalDeviceLimits::minUniformBufferOffsetAlignment.
+    static DeviceSize GetUniformAlignment(const PhysicalDeviceLimits& aLimits) noexcept
+    {
+        return std::max<DeviceSize>(aLimits.minUniformBufferOffsetAlignment, 1);
+    }
+
+    static DeviceSize GetStorageAlignment(const PhysicalDeviceLimits& aLimits) noexcept
+    {
+        return std::max<DeviceSize>(aLimits.minStorageBufferOffsetAlignment, 1);
+    }
+
+    // Release the leading frames whose fences have been signaled.
+    void Reclaim(void)
+    {
+        while (!mFrames.empty() && mLogicalDevice.GetFenceStatus(mFrames.front().fence) == VK_SUCCESS)
+            Retire();
+    }
+
+    RingAllocation Allocate(DeviceSize aSize)
+    {
+        return Allocate(aSize, mAlignment);
+    }
+
+    RingAllocation Allocate(DeviceSize aSize, DeviceSize aAlignment)
+    {
+        assert(aSize != 0 && aSize <= mSize);
+
+        Reclaim();
+
+        for (;;)
+        {
+            DeviceSize lOffset{ 0 };
+            const auto lConsumed = GetConsumedSize(aSize, aAlignment, lOffset);
+
+            if (lConsumed <= mSize - mUsedSize)
+            {
+                mHead = (lOffset + aSize) % mSize;
+                mUsedSize += lConsumed;
+                mFrameSize += lConsumed;
+                mFlushSize += lConsumed;
+
+                return { mBuffer, lOffset, aSize, static_cast<char*>(mAllocation.pMappedData) + lOffset };
+            }
+
+            // The frame being recorded alone exceeds the ring.
+            assert(!mFrames.empty());
+
+            mLogicalDevice.WaitForFence(mFrames.front().fence);
+            Retire();
+        }
+    }
+
+    // Whether Allocate can succeed once the closed frames are reclaimed, i.e. without waiting on the frame being recorded.
+    bool CanAllocate(DeviceSize aSize, DeviceSize aAlignment) const noexcept
+    {
+        if (mFrameSize == 0)
+            return aSize <= mSize;
+
+        DeviceSize lOffset{ 0 };
+
+        return GetConsumedSize(aSize, aAlignment, lOffset) <= mSize - mFrameSize;
+    }
+
+    template <typename T>
+    RingAllocation Push(const T& aData)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+
+        const auto& lAllocation = Allocate(sizeof(T));
+        std::memcpy(lAllocation.pMappedData, &aData, sizeof(T));
+
+        return lAllocation;
+    }
+
+    // Make everything written since the previous flush visible to the device, in one call.
+    void Flush(void)
+    {
+        if (mFlushSize == 0)
+            return;
+
+        if (!mIsCoherent && mFlushSize >= mSize)
+            mLogicalDevice.FlushMappedMemoryRange(mAllocator.GetMappedMemoryRange(mAllocation));
+        else if (!mIsCoherent)
+        {
+            // The written bytes run from mFlushOffset to the end of the ring, then from its start after a wrap. GetMappedMemoryRange widens each
+            // range to nonCoherentAtomSize and clamps it to the end of the memory object.
+            const auto lSize = std::min(mFlushSize, mSize - mFlushOffset);
+            const auto lWrappedSize = mFlushSize - lSize;
+
+            const auto& lRange = mAllocator.GetMappedMemoryRange(mAllocation, mFlushOffset, lSize);
+
+            if (lWrappedSize == 0)
+                mLogicalDevice.FlushMappedMemoryRange(lRange);
+            else
+            {
+                const auto& lWrappedRange = mAllocator.GetMappedMemoryRange(mAllocation, 0, lWrappedSize);
+
+                // Once widened, the two ranges may meet in the middle; one range over the whole allocation covers both then.
+                if (lWrappedRange.offset + lWrappedRange.size >= lRange.offset)
+                    mLogicalDevice.FlushMappedMemoryRange(mAllocator.GetMappedMemoryRange(mAllocation));
+                else
+                    mLogicalDevice.FlushMappedMemoryRanges({ lRange, lWrappedRange });
+            }
+        }
+
+        mFlushOffset = mHead;
+        mFlushSize = 0;
+    }
+
+    // Close the current frame. Its ranges are recycled once aFence is signaled.
+    void EndFrame(const Fence& aFence)
+    {
+        Flush();
+
+        if (mFrameSize == 0)
+            return;
+
+        mFrames.push_back({ aFence, mFrameSize });
+        mFrameSize = 0;
+    }
+
+    // Whether a frame still waiting to be reclaimed is guarded by aFence, i.e. the fence must not be reset or destroyed yet.
+    bool IsPending(const Fence& aFence) const
+    {
+        return std::any_of(mFrames.cbegin(), mFrames.cend(), [&aFence](const Frame& aFrame)
+        {
+            return aFrame.fence == aFence;
+        });
+    }
+
+    const Buffer& GetBuffer(void) const noexcept
+    {
+        return mBuffer;
+    }
+
+    DeviceSize GetSize(void) const noexcept
+    {
+        return mSize;
+    }
+
+    DeviceSize GetUsedSize(void) const noexcept
+    {
+        return mUsedSize;
+    }
+};
+
+
+
+}                   // End of namespace vkpp.
+
+
+
+#endif              // __VKPP_MEMORY_RING_BUFFER_H__
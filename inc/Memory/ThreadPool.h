@@ -0,0 +1,152 @@
+#ifndef __VKPP_MEMORY_THREAD_POOL_H__
+#define __VKPP_MEMORY_THREAD_POOL_H__
+
+
+
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <algorithm>
+
+#include <Info/Common.h>
+
+
+
+namespace vkpp
+{
+
+
+
+/**
+ * \class ThreadPool
+ *
+ * \brief Fixed set of worker threads running batches of indexed jobs.
+ *
+ * Run hands out job indices [0, aJobCount) to the workers and returns once all of them have completed.
+ * Each job also receives the index of the worker running it, so per-thread state (e.g. a CommandPool) can be kept without locking.
+ */
+class ThreadPool
+{
+private:
+    std::vector<std::thread> mWorkers;
+
+    std::mutex mMutex;
+    std::condition_variable mWakeCondition;
+    std::condition_variable mDoneCondition;
+
+    std::function<void(uint32_t, uint32_t)> mJob;
+    uint32_t mJobCount{ 0 };
+    std::atomic<uint32_t> mNextJob{ 0 };
+
+    uint32_t mBusyWorkerCount{ 0 };
+    uint64_t mBatch{ 0 };
+    bool mIsStopping{ false };
+
+    void WorkerLoop(uint32_t aWorkerIndex)
+    {
+        uint64_t lBatch{ 0 };
+
+        for (;;)
+        {
+            {
+                std::unique_lock<std::mutex> lLock{ mMutex };
+
+                mWakeCondition.wait(lLock, [this, lBatch](void)
+                {
+                    return mIsStopping || mBatch != lBatch;
+                });
+
+                if (mIsStopping)
+                    return;
+
+                lBatch = mBatch;
+            }
+
+            for (auto lJobIndex = mNextJob++; lJobIndex < mJobCount; lJobIndex = mNextJob++)
+                mJob(aWorkerIndex, lJobIndex);
+
+            std::lock_guard<std::mutex> lLock{ mMutex };
+
+            if (--mBusyWorkerCount == 0)
+                mDoneCondition.notify_one();
+        }
+    }
+
+public:
+    // Leave one core to the thread submitting the work.
+    static uint32_t DefaultThreadCount(void) noexcept
+    {
+        return std::max(std::thread::hardware_concurrency(), 2u) - 1;
+    }
+
+    explicit ThreadPool(uint32_t aThreadCount = DefaultThreadCount())
+    {
+        assert(aThreadCount != 0);
+
+        mWorkers.reserve(aThreadCount);
+
+        for (uint32_t lWorkerIndex = 0; lWorkerIndex < aThreadCount; ++lWorkerIndex)
+            mWorkers.emplace_back(&ThreadPool::WorkerLoop, this, lWorkerIndex);
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool(void)
+    {
+        {
+            std::lock_guard<std::mutex> lLock{ mMutex };
+            mIsStopping = true;
+        }
+
+        mWakeCondition.notify_all();
+
+        for (auto& lWorker : mWorkers)
+            lWorker.join();
+    }
+
+    // Call aJob(aWorkerIndex, aJobIndex) for every job index and block until all of them have returned. Not reentrant.
+    template <typename F>
+    void Run(uint32_t aJobCount, F&& aJob)
+    {
+        if (aJobCount == 0)
+            return;
+
+        {
+            std::lock_guard<std::mutex> lLock{ mMutex };
+
+            mJob = std::forward<F>(aJob);
+            mJobCount = aJobCount;
+            mNextJob = 0;
+            mBusyWorkerCount = GetThreadCount();
+            ++mBatch;
+        }
+
+        mWakeCondition.notify_all();
+
+        std::unique_lock<std::mutex> lLock{ mMutex };
+
+        mDoneCondition.wait(lLock, [this](void)
+        {
+            return mBusyWorkerCount == 0;
+        });
+
+        mJob = nullptr;
+    }
+
+    uint32_t GetThreadCount(void) const noexcept
+    {
+        return static_cast<uint32_t>(mWorkers.size());
+    }
+};
+
+
+
+}                   // End of namespace vkpp.
+
+
+
+#endif              // __VKPP_MEMORY_THREAD_POOL_H__
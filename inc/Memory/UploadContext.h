@@ -0,0 +1,410 @@
+#ifndef __VKPP_MEMORY_UPLOAD_CONTEXT_H__
+#define __VKPP_MEMORY_UPLOAD_CONTEXT_H__
+
+
+
+#include <deque>
+#include <vector>
+#include <cstring>
+#include <algorithm>
+
+#include <Info/Common.h>
+
+#include <Type/LogicalDevice.h>
+#include <Type/Queue.h>
+#include <Type/FencePool.h>
+#include <Type/SemaphorePool.h>
+#include <Type/CommandPool.h>
+#include <Type/CommandBuffer.h>
+#include <Type/MemoryBarrier.h>
+#include <Memory/DeviceAllocator.h>
+#include <Memory/RingBuffer.h>
+
+
+
+namespace vkpp
+{
+
+
+
+// Monotonically increasing id of a submitted upload batch; 0 is never handed out.
+using UploadTicket = uint64_t;
+
+
+
+/**
+ * \struct OwnershipAcquire
+ *
+ * \brief Acquire half of the queue family ownership transfers released by an UploadContext.
+ *
+ * Record it into a command buffer of the destination family and wait on its semaphores in that submission.
+ */
+struct OwnershipAcquire
+{
+    std::vector<Semaphore>              semaphores;
+    std::vector<PipelineStageFlags>     waitDstStageMasks;
+    std::vector<BufferMemoryBarrier>    bufferBarriers;
+    std::vector<ImageMemoryBarrier>     imageBarriers;
+    PipelineStageFlags                  dstStageMask;
+
+    bool IsEmpty(void) const noexcept
+    {
+        return semaphores.empty();
+    }
+
+    void Record(const CommandBuffer& aCommandBuffer) const
+    {
+        // The semaphores are waited on at dstStageMask, so the barriers chain with them through the same stages.
+        if (!bufferBarriers.empty())
+            aCommandBuffer.PipelineBarrier(dstStageMask, dstStageMask, DefaultFlags, bufferBarriers);
+
+        if (!imageBarriers.empty())
+            aCommandBuffer.PipelineBarrier(dstStageMask, dstStageMask, DefaultFlags, imageBarriers);
+    }
+};
+
+
+
+/**
+ * \class UploadContext
+ *
+ * \brief Batches host-to-device copies into one command buffer and one submission.
+ *
+ * Source data is staged in a reusable ring instead of a temporary buffer per resource.
+ * Copies are recorded until Submit, which returns a ticket the caller waits on only when it actually needs the data.
+ * Given a destination queue family, e.g. when recording on a dedicated transfer queue, every upload releases ownership to that family
+ * and each batch signals a semaphore; TakeAcquire hands out the matching acquire barriers and semaphores for the consuming submission.
+ * Not thread-safe; use one context per thread.
+ */
+class UploadContext
+{
+private:
+    struct Batch
+    {
+        UploadTicket    ticket{ 0 };
+        CommandBuffer   commandBuffer;
+        Fence           fence;
+    };
+
+    const LogicalDevice& mLogicalDevice;
+    const Queue& mQueue;
+    uint32_t mQueueFamilyIndex{ VK_QUEUE_FAMILY_IGNORED };
+    uint32_t mDstQueueFamilyIndex{ VK_QUEUE_FAMILY_IGNORED };
+
+    CommandPool mCommandPool;
+    RingBuffer mStaging;
+
+    CommandBuffer mCommandBuffer;
+    bool mIsRecording{ false };
+    uint32_t mCopyCount{ 0 };
+
+    UploadTicket mNextTicket{ 1 };
+    UploadTicket mCompletedTicket{ 0 };
+
+    std::deque<Batch> mBatches;
+    std::vector<CommandBuffer> mFreeCommandBuffers;
+    FencePool mFencePool;
+    std::vector<Fence> mRetiredFences;                  // Signaled, but the staging ring may still hold on to them.
+
+    OwnershipAcquire mAcquire;                          // Barriers of the recorded uploads and semaphores of the submitted batches.
+    PipelineStageFlags mBatchDstStageMask;
+    SemaphorePool mSemaphorePool;
+
+    bool IsTransferringOwnership(void) const noexcept
+    {
+        return mDstQueueFamilyIndex != VK_QUEUE_FAMILY_IGNORED;
+    }
+
+    // Finish the leading batches whose fences have been signaled and recycle their command buffers and fences.
+    void Retire(void)
+    {
+        // The staging ring has to let go of a fence before it can be reset.
+        mStaging.Reclaim();
+
+        while (!mBatches.empty() && mLogicalDevice.GetFenceStatus(mBatches.front().fence) == VK_SUCCESS)
+        {
+            const auto& lBatch = mBatches.front();
+
+            mCompletedTicket = lBatch.ticket;
+            mFreeCommandBuffers.push_back(lBatch.commandBuffer);
+            mRetiredFences.push_back(lBatch.fence);
+
+            mBatches.pop_front();
+        }
+
+        const auto lIter = std::partition(mRetiredFences.begin(), mRetiredFences.end(), [this](const Fence& aFence)
+        {
+            return mStaging.IsPending(aFence);
+        });
+
+        for (auto lFence = lIter; lFence != mRetiredFences.end(); ++lFence)
+            mFencePool.Recycle(*lFence);
+
+        mRetiredFences.erase(lIter, mRetiredFences.end());
+    }
+
+    const CommandBuffer& GetCommandBuffer(void)
+    {
+        if (mIsRecording)
+            return mCommandBuffer;
+
+        if (mFreeCommandBuffers.empty())
+            mCommandBuffer = mLogicalDevice.AllocateCommandBuffer({ mCommandPool, 1 });
+        else
+        {
+            mCommandBuffer = mFreeCommandBuffers.back();
+            mFreeCommandBuffers.pop_back();
+        }
+
+        constexpr CommandBufferBeginInfo lCommandBufferBeginInfo{ CommandBufferUsageFlagBits::eOneTimeSubmit };
+        mCommandBuffer.Begin(lCommandBufferBeginInfo);
+        mIsRecording = true;
+
+        return mCommandBuffer;
+    }
+
+    RingAllocation Stage(const void* apData, DeviceSize aSize, DeviceSize aAlignment)
+    {
+        assert(apData != nullptr && aSize != 0);
+        assert(aSize <= mStaging.GetSize());
+
+        // The batch being recorded can't wait on itself; hand it to the queue once the ring has no room left for it.
+        if (mIsRecording && !mStaging.CanAllocate(aSize, aAlignment))
+            Submit();
+
+        const auto& lAllocation = mStaging.Allocate(aSize, aAlignment);
+        std::memcpy(lAllocation.pMappedData, apData, static_cast<std::size_t>(aSize));
+
+        return lAllocation;
+    }
+
+public:
+    constexpr static DeviceSize DefaultStagingSize{ 64 * 1024 * 1024 };
+
+    // Offsets into the staging buffer have to be multiples of 4 and of the texel (or block) size; 16 covers every common format.
+    constexpr static DeviceSize DefaultStagingAlignment{ 16 };
+
+    // aDstQueueFamilyIndex is the family that consumes the uploads if it differs from the one of aQueue.
+    UploadContext(DeviceAllocator& aAllocator, const Queue& aQueue, uint32_t aQueueFamilyIndex, DeviceSize aStagingSize = DefaultStagingSize,
+        uint32_t aDstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED)
+        : mLogicalDevice(aAllocator.GetLogicalDevice()), mQueue(aQueue), mQueueFamilyIndex(aQueueFamilyIndex),
+          mDstQueueFamilyIndex(aDstQueueFamilyIndex != aQueueFamilyIndex ? aDstQueueFamilyIndex : VK_QUEUE_FAMILY_IGNORED),
+          mCommandPool(mLogicalDevice.CreateCommandPool({ aQueueFamilyIndex, CommandPoolCreateFlagBits::eTransient | CommandPoolCreateFlagBits::eResetCommandBuffer })),
+          mStaging(aAllocator, aStagingSize, BufferUsageFlagBits::eTransferSrc, DefaultStagingAlignment),
+          mFencePool(mLogicalDevice), mSemaphorePool(mLogicalDevice)
+    {}
+
+    UploadContext(const UploadContext&) = delete;
+    UploadContext& operator=(const UploadContext&) = delete;
+
+    ~UploadContext(void)
+    {
+        WaitIdle();
+
+        // Semaphores still held by an OwnershipAcquire that was never recycled are the caller's to wait for.
+        assert(mAcquire.IsEmpty());
+
+        mLogicalDevice.DestroyFences(mRetiredFences);
+        mLogicalDevice.DestroyCommandPool(mCommandPool);
+    }
+
+    // aDstAccessMask and aDstStageMask describe the first use of the buffer, which the copy is made visible to.
+    void Upload(const Buffer& aDstBuffer, const void* apData, DeviceSize aSize, DeviceSize aDstOffset = 0,
+        const AccessFlags& aDstAccessMask = AccessFlagBits::eMemoryRead, const PipelineStageFlags& aDstStageMask = PipelineStageFlagBits::eAllCommands)
+    {
+        const auto& lStaging = Stage(apData, aSize, DefaultStagingAlignment);
+        const auto& lCommandBuffer = GetCommandBuffer();
+        auto lDstBuffer = aDstBuffer;
+
+        lCommandBuffer.Copy(lDstBuffer, lStaging.buffer, { lStaging.offset, aDstOffset, aSize });
+
+        if (IsTransferringOwnership())
+        {
+            lCommandBuffer.PipelineBarrier(PipelineStageFlagBits::eTransfer, PipelineStageFlagBits::eBottomOfPipe, DefaultFlags,
+                BufferMemoryBarrier{ AccessFlagBits::eTransferWrite, DefaultFlags, mQueueFamilyIndex, mDstQueueFamilyIndex, aDstBuffer, aDstOffset, aSize });
+
+            mAcquire.bufferBarriers.emplace_back(DefaultFlags, aDstAccessMask, mQueueFamilyIndex, mDstQueueFamilyIndex, aDstBuffer, aDstOffset, aSize);
+            mBatchDstStageMask |= aDstStageMask;
+        }
+        else
+        {
+            lCommandBuffer.PipelineBarrier(PipelineStageFlagBits::eTransfer, aDstStageMask, DefaultFlags,
+                BufferMemoryBarrier{ AccessFlagBits::eTransferWrite, aDstAccessMask, VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED, aDstBuffer, aDstOffset, aSize });
+        }
+
+        ++mCopyCount;
+    }
+
+    template <typename T, typename = std::enable_if_t<std::is_trivially_copyable_v<ValueType<T>>>>
+    void Upload(const Buffer& aDstBuffer, T&& aData, DeviceSize aDstOffset = 0,
+        const AccessFlags& aDstAccessMask = AccessFlagBits::eMemoryRead, const PipelineStageFlags& aDstStageMask = PipelineStageFlagBits::eAllCommands)
+    {
+        Upload(aDstBuffer, DataOf(aData), SizeOf<DeviceSize>(aData) * sizeof(ValueType<T>), aDstOffset, aDstAccessMask, aDstStageMask);
+    }
+
+    // Copies tightly packed texel data into aDstImage. aRegions' bufferOffset are relative to apData.
+    // The image is transitioned from aOldLayout to transfer destination and on to aFinalLayout, which is visible to aDstAccessMask at aDstStageMask.
+    void Upload(const Image& aDstImage, const void* apData, DeviceSize aSize, const std::vector<BufferImageCopy>& aRegions, const ImageSubresourceRange& aSubresourceRange,
+        ImageLayout aFinalLayout = ImageLayout::eShaderReadOnlyOptimal, const AccessFlags& aDstAccessMask = AccessFlagBits::eShaderRead,
+        const PipelineStageFlags& aDstStageMask = PipelineStageFlagBits::eFragmentShader, ImageLayout aOldLayout = ImageLayout::eUndefined,
+        DeviceSize aAlignment = DefaultStagingAlignment)
+    {
+        assert(!aRegions.empty());
+
+        const auto& lStaging = Stage(apData, aSize, aAlignment);
+        const auto& lCommandBuffer = GetCommandBuffer();
+        auto lDstImage = aDstImage;
+
+        std::vector<BufferImageCopy> lRegions{ aRegions };
+
+        for (auto& lRegion : lRegions)
+            lRegion.bufferOffset += lStaging.offset;
+
+        lCommandBuffer.PipelineBarrier(PipelineStageFlagBits::eTopOfPipe, PipelineStageFlagBits::eTransfer, DefaultFlags,
+            ImageMemoryBarrier{ DefaultFlags, AccessFlagBits::eTransferWrite, aOldLayout, ImageLayout::eTransferDstOptimal, aDstImage, aSubresourceRange });
+
+        lCommandBuffer.Copy(lDstImage, ImageLayout::eTransferDstOptimal, lStaging.buffer, lRegions);
+
+        if (IsTransferringOwnership())
+        {
+            // The layout transition is part of the transfer; release and acquire have to spell out the same one.
+            lCommandBuffer.PipelineBarrier(PipelineStageFlagBits::eTransfer, PipelineStageFlagBits::eBottomOfPipe, DefaultFlags,
+                ImageMemoryBarrier{ AccessFlagBits::eTransferWrite, DefaultFlags, ImageLayout::eTransferDstOptimal, aFinalLayout, aDstImage, aSubresourceRange,
+                    mQueueFamilyIndex, mDstQueueFamilyIndex });
+
+            mAcquire.imageBarriers.emplace_back(DefaultFlags, aDstAccessMask, ImageLayout::eTransferDstOptimal, aFinalLayout, aDstImage, aSubresourceRange,
+                mQueueFamilyIndex, mDstQueueFamilyIndex);
+            mBatchDstStageMask |= aDstStageMask;
+        }
+        else
+        {
+            lCommandBuffer.PipelineBarrier(PipelineStageFlagBits::eTransfer, aDstStageMask, DefaultFlags,
+                ImageMemoryBarrier{ AccessFlagBits::eTransferWrite, aDstAccessMask, ImageLayout::eTransferDstOptimal, aFinalLayout, aDstImage, aSubresourceRange });
+        }
+
+        ++mCopyCount;
+    }
+
+    // Records the command buffer given to aRecorder into the current batch, e.g. for mip-map generation right after an upload.
+    template <typename F>
+    void Record(F&& aRecorder)
+    {
+        aRecorder(GetCommandBuffer());
+    }
+
+    // Flush every copy recorded so far with a single submission. Returns the ticket of the batch, or the last one if nothing was pending.
+    UploadTicket Submit(void)
+    {
+        if (!mIsRecording)
+            return mNextTicket - 1;
+
+        mCommandBuffer.End();
+
+        Retire();
+
+        const auto lFence = mFencePool.Acquire();
+
+        // Flush the staged bytes before the queue can read them.
+        mStaging.EndFrame(lFence);
+
+        SubmitInfo lSubmitInfo{ mCommandBuffer };
+
+        if (IsTransferringOwnership())
+        {
+            // A batch holding only Record-ed commands has no first use to wait for.
+            if (!mBatchDstStageMask)
+                mBatchDstStageMask = PipelineStageFlagBits::eTopOfPipe;
+
+            mAcquire.semaphores.push_back(mSemaphorePool.Acquire());
+            mAcquire.waitDstStageMasks.push_back(mBatchDstStageMask);
+            mAcquire.dstStageMask |= mBatchDstStageMask;
+            mBatchDstStageMask = DefaultFlags;
+
+            lSubmitInfo.SetSignalSemaphore(mAcquire.semaphores.back());
+        }
+
+        mQueue.Submit(lSubmitInfo, lFence);
+
+        mBatches.push_back({ mNextTicket, mCommandBuffer, lFence });
+
+        mIsRecording = false;
+        mCopyCount = 0;
+
+        return mNextTicket++;
+    }
+
+    bool IsComplete(UploadTicket aTicket)
+    {
+        if (aTicket > mCompletedTicket)
+            Retire();
+
+        return aTicket <= mCompletedTicket;
+    }
+
+    void Wait(UploadTicket aTicket)
+    {
+        assert(aTicket < mNextTicket);
+
+        if (IsComplete(aTicket))
+            return;
+
+        const auto lIter = std::find_if(mBatches.cbegin(), mBatches.cend(), [aTicket](const Batch& aBatch)
+        {
+            return aBatch.ticket >= aTicket;
+        });
+
+        assert(lIter != mBatches.cend());
+
+        mLogicalDevice.WaitForFence(lIter->fence);
+        Retire();
+    }
+
+    // Submit what is pending and hand out the acquire half of every ownership transfer released so far.
+    // The destination queue must wait on the returned semaphores; pass them back to Recycle once that submission has completed.
+    OwnershipAcquire TakeAcquire(void)
+    {
+        assert(IsTransferringOwnership());
+
+        Submit();
+
+        auto lAcquire = std::move(mAcquire);
+        mAcquire = OwnershipAcquire{};
+
+        return lAcquire;
+    }
+
+    void Recycle(OwnershipAcquire& aAcquire)
+    {
+        for (const auto& lSemaphore : aAcquire.semaphores)
+            mSemaphorePool.Recycle(lSemaphore);
+
+        aAcquire = OwnershipAcquire{};
+    }
+
+    // Submit what is pending and wait for every batch.
+    void WaitIdle(void)
+    {
+        const auto lTicket = Submit();
+
+        if (lTicket != 0)
+            Wait(lTicket);
+    }
+
+    uint32_t GetPendingCopyCount(void) const noexcept
+    {
+        return mCopyCount;
+    }
+
+    UploadTicket GetCompletedTicket(void) const noexcept
+    {
+        return mCompletedTicket;
+    }
+};
+
+
+
+}                   // End of namespace vkpp.
+
+
+
+#endif              // __VKPP_MEMORY_UPLOAD_CONTEXT_H__
@@ -0,0 +1,197 @@
+#ifndef __VKPP_TYPE_BINDLESS_TABLE_H__
+#define __VKPP_TYPE_BINDLESS_TABLE_H__
+
+
+
+#include <array>
+#include <vector>
+
+#include <Info/Common.h>
+
+#include <Type/LogicalDevice.h>
+#include <Type/DescriptorSet.h>
+#include <Type/DescriptorPool.h>
+
+
+
+namespace vkpp
+{
+
+
+
+/**
+ * \class BindlessTable
+ *
+ * \brief One large descriptor set holding every sampled image and storage buffer, addressed by stable integer handles.
+ *
+ * Binding 0 is an array of aImageCapacity combined image samplers and binding 1 an array of aBufferCapacity storage buffers. Both are
+ * partially bound and update-after-bind, so the set is bound once per command buffer and descriptors can be added while it is in use.
+ * Shaders receive handles through push constants and index the arrays with them (nonuniformEXT when the index is not dynamically uniform).
+ * The device needs VK_EXT_descriptor_indexing and VK_KHR_maintenance3 with runtimeDescriptorArray, descriptorBindingPartiallyBound,
+ * descriptorBindingUpdateUnusedWhilePending, descriptorBindingSampledImageUpdateAfterBind and descriptorBindingStorageBufferUpdateAfterBind,
+ * plus the core shaderSampledImageArrayDynamicIndexing for push constant handles; ext::PhysicalDeviceDescriptorIndexingFeatures queries and enables them.
+ * A removed handle is reused by the next add, so only remove it once no submitted work indexes it any more.
+ */
+class BindlessTable
+{
+public:
+    using Handle = uint32_t;
+
+    static constexpr Handle InvalidHandle = UINT32_MAX;
+
+    static constexpr uint32_t ImageBinding = 0;
+    static constexpr uint32_t BufferBinding = 1;
+
+private:
+    struct Slots
+    {
+        uint32_t capacity;
+        uint32_t next{ 0 };
+        std::vector<Handle> freeHandles;
+
+        Handle Acquire(void)
+        {
+            if (!freeHandles.empty())
+            {
+                const auto lHandle = freeHandles.back();
+                freeHandles.pop_back();
+
+                return lHandle;
+            }
+
+            assert(next < capacity);
+
+            return next++;
+        }
+
+        void Release(Handle aHandle)
+        {
+            assert(aHandle < next);
+
+            freeHandles.push_back(aHandle);
+        }
+    };
+
+    const LogicalDevice& mLogicalDevice;
+
+    DescriptorSetLayout mSetLayout;
+    DescriptorPool mDescriptorPool;
+    DescriptorSet mDescriptorSet;
+
+    Slots mImages;
+    Slots mBuffers;
+
+public:
+    BindlessTable(const LogicalDevice& aLogicalDevice, uint32_t aImageCapacity, uint32_t aBufferCapacity, const ShaderStageFlags& aStageFlags = ShaderStageFlagBits::eAll)
+        : mLogicalDevice(aLogicalDevice), mImages{ aImageCapacity }, mBuffers{ aBufferCapacity }
+    {
+        assert(aImageCapacity != 0 && aBufferCapacity != 0);
+
+        const std::array<DescriptorSetLayoutBinding, 2> lSetLayoutBindings
+        {{
+            { ImageBinding, DescriptorType::eCombinedImageSampler, aImageCapacity, aStageFlags },
+            { BufferBinding, DescriptorType::eStorageBuffer, aBufferCapacity, aStageFlags }
+        }};
+
+        constexpr ext::DescriptorBindingFlags lBindingFlags
+        {
+            ext::DescriptorBindingFlagBits::ePartiallyBound | ext::DescriptorBindingFlagBits::eUpdateAfterBind | ext::DescriptorBindingFlagBits::eUpdateUnusedWhilePending
+        };
+
+        const std::array<ext::DescriptorBindingFlags, 2> lSetLayoutBindingFlags{ lBindingFlags, lBindingFlags };
+        const ext::DescriptorSetLayoutBindingFlagsCreateInfo lBindingFlagsCreateInfo{ lSetLayoutBindingFlags };
+
+        mSetLayout = mLogicalDevice.CreateDescriptorSetLayout(
+            DescriptorSetLayoutCreateInfo{ lSetLayoutBindings, DescriptorSetLayoutCreateFlagBits::eUpdateAfterBindPoolEXT }.SetNext(&lBindingFlagsCreateInfo));
+
+        const std::array<DescriptorPoolSize, 2> lPoolSizes
+        {{
+            { DescriptorType::eCombinedImageSampler, aImageCapacity },
+            { DescriptorType::eStorageBuffer, aBufferCapacity }
+        }};
+
+        mDescriptorPool = mLogicalDevice.CreateDescriptorPool({ lPoolSizes, 1, DescriptorPoolCreateFlagBits::eUpdateAfterBindEXT });
+        mDescriptorSet = mLogicalDevice.AllocateDescriptorSet({ mDescriptorPool, mSetLayout });
+    }
+
+    BindlessTable(const BindlessTable&) = delete;
+    BindlessTable& operator=(const BindlessTable&) = delete;
+
+    ~BindlessTable(void)
+    {
+        // Destroying the pool frees the set.
+        mLogicalDevice.DestroyDescriptorPool(mDescriptorPool);
+        mLogicalDevice.DestroyDescriptorSetLayout(mSetLayout);
+    }
+
+    Handle AddImage(const DescriptorImageInfo& aImageInfo)
+    {
+        const auto lHandle = mImages.Acquire();
+
+        UpdateImage(lHandle, aImageInfo);
+
+        return lHandle;
+    }
+
+    void UpdateImage(Handle aHandle, const DescriptorImageInfo& aImageInfo) const
+    {
+        assert(aHandle < mImages.next);
+
+        mLogicalDevice.UpdateDescriptorSet({ mDescriptorSet, ImageBinding, aHandle, 1, DescriptorType::eCombinedImageSampler, aImageInfo.AddressOf() });
+    }
+
+    void RemoveImage(Handle aHandle)
+    {
+        mImages.Release(aHandle);
+    }
+
+    Handle AddBuffer(const DescriptorBufferInfo& aBufferInfo)
+    {
+        const auto lHandle = mBuffers.Acquire();
+
+        UpdateBuffer(lHandle, aBufferInfo);
+
+        return lHandle;
+    }
+
+    void UpdateBuffer(Handle aHandle, const DescriptorBufferInfo& aBufferInfo) const
+    {
+        assert(aHandle < mBuffers.next);
+
+        mLogicalDevice.UpdateDescriptorSet({ mDescriptorSet, BufferBinding, aHandle, 1, DescriptorType::eStorageBuffer, nullptr, aBufferInfo.AddressOf() });
+    }
+
+    void RemoveBuffer(Handle aHandle)
+    {
+        mBuffers.Release(aHandle);
+    }
+
+    // Include in the pipeline layout at the set index the shaders declare the arrays in.
+    const DescriptorSetLayout& GetSetLayout(void) const noexcept
+    {
+        return mSetLayout;
+    }
+
+    const DescriptorSet& GetDescriptorSet(void) const noexcept
+    {
+        return mDescriptorSet;
+    }
+
+    uint32_t GetImageCount(void) const noexcept
+    {
+        return mImages.next - static_cast<uint32_t>(mImages.freeHandles.size());
+    }
+
+    uint32_t GetBufferCount(void) const noexcept
+    {
+        return mBuffers.next - static_cast<uint32_t>(mBuffers.freeHandles.size());
+    }
+};
+
+
+
+}                   // End of namespace vkpp.
+
+
+
+#endif              // __VKPP_TYPE_BINDLESS_TABLE_H__
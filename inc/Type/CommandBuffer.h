@@ -9,9 +9,11 @@
 #include <Info/PipelineStage.h>
 #include <Info/RenderPassBeginInfo.h>
 
+#include <Type/DispatchTable.h>
 #include <Type/RenderPass.h>
 #include <Type/GraphicsPipeline.h>
 #include <Type/MemoryBarrier.h>
+#include <Type/QueryPool.h>
 
 
 
@@ -31,34 +33,6 @@ VKPP_ENUM_BIT_MASK_FLAGS(CommandBufferUsage)
 
 
 
-enum class QueryControlFlagBits
-{
-    ePrecise        = VK_QUERY_CONTROL_PRECISE_BIT
-};
-
-VKPP_ENUM_BIT_MASK_FLAGS(QueryControl)
-
-
-
-enum class QueryPipelineStatisticFlagBits
-{
-    eInputAssemblyVertices                      = VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_VERTICES_BIT,
-    eInputAssemblyPrimitives                    = VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_PRIMITIVES_BIT,
-    eVertexShaderInvocations                    = VK_QUERY_PIPELINE_STATISTIC_VERTEX_SHADER_INVOCATIONS_BIT,
-    eGeometryShaderInvocations                  = VK_QUERY_PIPELINE_STATISTIC_GEOMETRY_SHADER_INVOCATIONS_BIT,
-    eGeometryShaderPrimitives                   = VK_QUERY_PIPELINE_STATISTIC_GEOMETRY_SHADER_PRIMITIVES_BIT,
-    eClippingInvocations                        = VK_QUERY_PIPELINE_STATISTIC_CLIPPING_INVOCATIONS_BIT,
-    eClippingPrimitives                         = VK_QUERY_PIPELINE_STATISTIC_CLIPPING_PRIMITIVES_BIT,
-    eFragmentShaderInvocations                  = VK_QUERY_PIPELINE_STATISTIC_FRAGMENT_SHADER_INVOCATIONS_BIT,
-    eTessellationControlShaderPatches           = VK_QUERY_PIPELINE_STATISTIC_TESSELLATION_CONTROL_SHADER_PATCHES_BIT,
-    eTessellationEvaluationShaderInvocations    = VK_QUERY_PIPELINE_STATISTIC_TESSELLATION_EVALUATION_SHADER_INVOCATIONS_BIT,
-    eComputeShaderInvocations                   = VK_QUERY_PIPELINE_STATISTIC_COMPUTE_SHADER_INVOCATIONS_BIT
-};
-
-VKPP_ENUM_BIT_MASK_FLAGS(QueryPipelineStatistic)
-
-
-
 enum class StencilFaceFlagBits
 {
     eFront              = VK_STENCIL_FACE_FRONT_BIT,
@@ -322,6 +296,43 @@ ConsistencyCheck(BufferImageCopy, bufferOffset, bufferRowLength, bufferImageHeig
 
 
 
+struct DrawIndirectCommand : public internal::VkTrait<DrawIndirectCommand, VkDrawIndirectCommand>
+{
+    uint32_t vertexCount{ 0 };
+    uint32_t instanceCount{ 1 };
+    uint32_t firstVertex{ 0 };
+    uint32_t firstInstance{ 0 };
+
+    DEFINE_CLASS_MEMBER(DrawIndirectCommand)
+
+    constexpr DrawIndirectCommand(uint32_t aVertexCount, uint32_t aInstanceCount = 1, uint32_t aFirstVertex = 0, uint32_t aFirstInstance = 0) noexcept
+        : vertexCount(aVertexCount), instanceCount(aInstanceCount), firstVertex(aFirstVertex), firstInstance(aFirstInstance)
+    {}
+};
+
+ConsistencyCheck(DrawIndirectCommand, vertexCount, instanceCount, firstVertex, firstInstance)
+
+
+
+struct DrawIndexedIndirectCommand : public internal::VkTrait<DrawIndexedIndirectCommand, VkDrawIndexedIndirectCommand>
+{
+    uint32_t indexCount{ 0 };
+    uint32_t instanceCount{ 1 };
+    uint32_t firstIndex{ 0 };
+    int32_t  vertexOffset{ 0 };
+    uint32_t firstInstance{ 0 };
+
+    DEFINE_CLASS_MEMBER(DrawIndexedIndirectCommand)
+
+    constexpr DrawIndexedIndirectCommand(uint32_t aIndexCount, uint32_t aInstanceCount = 1, uint32_t aFirstIndex = 0, int32_t aVertexOffset = 0, uint32_t aFirstInstance = 0) noexcept
+        : indexCount(aIndexCount), instanceCount(aInstanceCount), firstIndex(aFirstIndex), vertexOffset(aVertexOffset), firstInstance(aFirstInstance)
+    {}
+};
+
+ConsistencyCheck(DrawIndexedIndirectCommand, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance)
+
+
+
 class CommandBuffer : public internal::VkTrait<CommandBuffer, VkCommandBuffer>
 {
 private:
@@ -338,24 +349,24 @@ public:
 
     void Begin(const CommandBufferBeginInfo& aCommandBufferBeginInfo) const
     {
-        ThrowIfFailed(vkBeginCommandBuffer(mCommandBuffer, &aCommandBufferBeginInfo));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkBeginCommandBuffer)(mCommandBuffer, &aCommandBufferBeginInfo));
     }
 
     void End(void) const
     {
-        ThrowIfFailed(vkEndCommandBuffer(mCommandBuffer));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkEndCommandBuffer)(mCommandBuffer));
     }
 
     void Execute(const CommandBuffer& aCommandBuffer) const
     {
-        vkCmdExecuteCommands(mCommandBuffer, 1, &aCommandBuffer);
+        VKPP_DEVICE_PROC(vkCmdExecuteCommands)(mCommandBuffer, 1, &aCommandBuffer);
     }
 
     void Execute(uint32_t aCommandBufferCount, const CommandBuffer* apCommandBuffers) const
     {
         assert(aCommandBufferCount != 0 && apCommandBuffers != nullptr);
 
-        vkCmdExecuteCommands(mCommandBuffer, aCommandBufferCount, &apCommandBuffers[0]);
+        VKPP_DEVICE_PROC(vkCmdExecuteCommands)(mCommandBuffer, aCommandBufferCount, &apCommandBuffers[0]);
     }
 
     template <typename T, typename = EnableIfValueType<ValueType<T>, CommandBuffer>>
@@ -375,37 +386,37 @@ public:
 
     void BeginRenderPass(const RenderPassBeginInfo& aRenderPassBeginInfo, SubpassContents aSubpassContents = SubpassContents::eInline) const
     {
-        vkCmdBeginRenderPass(mCommandBuffer, &aRenderPassBeginInfo, static_cast<VkSubpassContents>(aSubpassContents));
+        VKPP_DEVICE_PROC(vkCmdBeginRenderPass)(mCommandBuffer, &aRenderPassBeginInfo, static_cast<VkSubpassContents>(aSubpassContents));
     }
 
     void EndRenderPass(void) const
     {
-        vkCmdEndRenderPass(mCommandBuffer);
+        VKPP_DEVICE_PROC(vkCmdEndRenderPass)(mCommandBuffer);
     }
 
     void NextSubpass(SubpassContents aSubpassContents = SubpassContents::eInline) const
     {
-        vkCmdNextSubpass(mCommandBuffer, static_cast<VkSubpassContents>(aSubpassContents));
+        VKPP_DEVICE_PROC(vkCmdNextSubpass)(mCommandBuffer, static_cast<VkSubpassContents>(aSubpassContents));
     }
 
     void BindGraphicsPipeline(const Pipeline& aPipeline) const
     {
-        vkCmdBindPipeline(mCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, aPipeline); 
+        VKPP_DEVICE_PROC(vkCmdBindPipeline)(mCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, aPipeline); 
     }
 
     void BindComputePipeline(const Pipeline& aPipeline) const
     {
-        vkCmdBindPipeline(mCommandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, aPipeline);
+        VKPP_DEVICE_PROC(vkCmdBindPipeline)(mCommandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, aPipeline);
     }
 
     void BindGraphicsDescriptorSet(const PipelineLayout& aPipelineLayout, uint32_t aFirstSet, const DescriptorSet& aDescriptorSet) const
     {
-        vkCmdBindDescriptorSets(mCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, aPipelineLayout, aFirstSet, 1, &aDescriptorSet, 0, nullptr);
+        VKPP_DEVICE_PROC(vkCmdBindDescriptorSets)(mCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, aPipelineLayout, aFirstSet, 1, &aDescriptorSet, 0, nullptr);
     }
 
     void BindGraphicsDescriptorSet(const PipelineLayout& aPipelineLayout, uint32_t aFirstSet, const DescriptorSet& aDescriptorSet, uint32_t aDynamicOffset) const
     {
-        vkCmdBindDescriptorSets(mCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, aPipelineLayout, aFirstSet, 1, &aDescriptorSet, 1, &aDynamicOffset);
+        VKPP_DEVICE_PROC(vkCmdBindDescriptorSets)(mCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, aPipelineLayout, aFirstSet, 1, &aDescriptorSet, 1, &aDynamicOffset);
     }
 
     void BindGraphicsDescriptorSet(const PipelineLayout& aPipelineLayout, uint32_t aFirstSet, const DescriptorSet& aDescriptorSet,
@@ -413,18 +424,18 @@ public:
     {
         assert(aDynamicOffsetCount != 0 && apDynamicOffsets != nullptr);
 
-        vkCmdBindDescriptorSets(mCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, aPipelineLayout, aFirstSet, 1, &aDescriptorSet,
+        VKPP_DEVICE_PROC(vkCmdBindDescriptorSets)(mCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, aPipelineLayout, aFirstSet, 1, &aDescriptorSet,
             aDynamicOffsetCount, &apDynamicOffsets[0]);
     }
 
     void BindComputeDescriptorSet(const PipelineLayout& aPipelineLayout, uint32_t aFirstSet, const DescriptorSet& aDescriptorSet) const
     {
-        vkCmdBindDescriptorSets(mCommandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, aPipelineLayout, aFirstSet, 1, &aDescriptorSet, 0, nullptr);
+        VKPP_DEVICE_PROC(vkCmdBindDescriptorSets)(mCommandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, aPipelineLayout, aFirstSet, 1, &aDescriptorSet, 0, nullptr);
     }
 
     void BindComputeDescriptorSet(const PipelineLayout& aPipelineLayout, uint32_t aFirstSet, const DescriptorSet& aDescriptorSet, uint32_t aDynamicOffset) const
     {
-        vkCmdBindDescriptorSets(mCommandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, aPipelineLayout, aFirstSet, 1, &aDescriptorSet, 1, &aDynamicOffset);
+        VKPP_DEVICE_PROC(vkCmdBindDescriptorSets)(mCommandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, aPipelineLayout, aFirstSet, 1, &aDescriptorSet, 1, &aDynamicOffset);
     }
 
     void BindComputeDescriptorSet(const PipelineLayout& aPipelineLayout, uint32_t aFirstSet, const DescriptorSet& aDescriptorSet,
@@ -432,7 +443,7 @@ public:
     {
         assert(aDynamicOffsetCount != 0 && apDynamicOffsets != nullptr);
 
-        vkCmdBindDescriptorSets(mCommandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, aPipelineLayout, aFirstSet, 1, &aDescriptorSet,
+        VKPP_DEVICE_PROC(vkCmdBindDescriptorSets)(mCommandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, aPipelineLayout, aFirstSet, 1, &aDescriptorSet,
             aDynamicOffsetCount, &apDynamicOffsets[0]);
     }
 
@@ -442,7 +453,7 @@ public:
         assert(aDescriptorSetCount != 0 && apDescriptorSets != nullptr);
         assert(aDynamicOffsetCount != 0 && apDynamicOffsets != nullptr);
 
-        vkCmdBindDescriptorSets(mCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, aPipelineLayout, aFirstSet, aDescriptorSetCount, &apDescriptorSets[0],
+        VKPP_DEVICE_PROC(vkCmdBindDescriptorSets)(mCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, aPipelineLayout, aFirstSet, aDescriptorSetCount, &apDescriptorSets[0],
             aDynamicOffsetCount, &apDynamicOffsets[0]);
     }
 
@@ -452,7 +463,7 @@ public:
         assert(aDescriptorSetCount != 0 && apDescriptorSets != nullptr);
         assert(aDynamicOffsetCount != 0 && apDynamicOffsets != nullptr);
 
-        vkCmdBindDescriptorSets(mCommandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, aPipelineLayout, aFirstSet, aDescriptorSetCount, &apDescriptorSets[0],
+        VKPP_DEVICE_PROC(vkCmdBindDescriptorSets)(mCommandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, aPipelineLayout, aFirstSet, aDescriptorSetCount, &apDescriptorSets[0],
             aDynamicOffsetCount, &apDynamicOffsets[0]);
     }
 
@@ -460,17 +471,47 @@ public:
     {
         assert(aSize > 0 && apValues != nullptr);
 
-        vkCmdPushConstants(mCommandBuffer, aPipelineLayout, aShaderStageFlags, aOffset, aSize, apValues);
+        VKPP_DEVICE_PROC(vkCmdPushConstants)(mCommandBuffer, aPipelineLayout, aShaderStageFlags, aOffset, aSize, apValues);
     }
 
     void Draw(uint32_t aVertexCount, uint32_t aInstanceCount = 1, uint32_t aFirstVertex = 0, uint32_t aFirstInstance = 0) const
     {
-        vkCmdDraw(mCommandBuffer, aVertexCount, aInstanceCount, aFirstVertex, aFirstInstance);
+        VKPP_DEVICE_PROC(vkCmdDraw)(mCommandBuffer, aVertexCount, aInstanceCount, aFirstVertex, aFirstInstance);
     }
 
     void DrawIndexed(uint32_t aIndexCount, uint32_t aInstanceCount = 1, uint32_t aFirstIndex = 0, uint32_t aVertexOffset = 0, uint32_t aFirstInstance = 0) const
     {
-        vkCmdDrawIndexed(mCommandBuffer, aIndexCount, aInstanceCount, aFirstIndex, aVertexOffset, aFirstInstance);
+        VKPP_DEVICE_PROC(vkCmdDrawIndexed)(mCommandBuffer, aIndexCount, aInstanceCount, aFirstIndex, aVertexOffset, aFirstInstance);
+    }
+
+    // aBuffer holds aDrawCount DrawIndirectCommand records aStride bytes apart from aOffset, which must be a multiple of 4.
+    // A aDrawCount greater than 1 requires the multiDrawIndirect feature and must not exceed PhysicalDeviceLimits::maxDrawIndirectCount.
+    void DrawIndirect(const Buffer& aBuffer, DeviceSize aOffset = 0, uint32_t aDrawCount = 1, uint32_t aStride = sizeof(DrawIndirectCommand)) const
+    {
+        assert(aOffset % 4 == 0 && aStride % 4 == 0 && (aDrawCount <= 1 || aStride >= sizeof(DrawIndirectCommand)));
+
+        VKPP_DEVICE_PROC(vkCmdDrawIndirect)(mCommandBuffer, aBuffer, aOffset, aDrawCount, aStride);
+    }
+
+    // As DrawIndirect, with DrawIndexedIndirectCommand records.
+    void DrawIndexedIndirect(const Buffer& aBuffer, DeviceSize aOffset = 0, uint32_t aDrawCount = 1, uint32_t aStride = sizeof(DrawIndexedIndirectCommand)) const
+    {
+        assert(aOffset % 4 == 0 && aStride % 4 == 0 && (aDrawCount <= 1 || aStride >= sizeof(DrawIndexedIndirectCommand)));
+
+        VKPP_DEVICE_PROC(vkCmdDrawIndexedIndirect)(mCommandBuffer, aBuffer, aOffset, aDrawCount, aStride);
+    }
+
+    void Dispatch(uint32_t aGroupCountX, uint32_t aGroupCountY = 1, uint32_t aGroupCountZ = 1) const
+    {
+        VKPP_DEVICE_PROC(vkCmdDispatch)(mCommandBuffer, aGroupCountX, aGroupCountY, aGroupCountZ);
+    }
+
+    // aBuffer holds a VkDispatchIndirectCommand at aOffset, which must be a multiple of 4.
+    void DispatchIndirect(const Buffer& aBuffer, DeviceSize aOffset = 0) const
+    {
+        assert(aOffset % 4 == 0);
+
+        VKPP_DEVICE_PROC(vkCmdDispatchIndirect)(mCommandBuffer, aBuffer, aOffset);
     }
 
     void PipelineBarrier(const PipelineStageFlags& aSrcStageMask, const PipelineStageFlags& aDstStageMask, const DependencyFlags& aDependencyFlags,
@@ -478,7 +519,7 @@ public:
     {
         assert(!(aMemoryBarriers.empty() || aBufferMemoryBarriers.empty() || aImageMemoryBarriers.empty()));
 
-        vkCmdPipelineBarrier(mCommandBuffer, aSrcStageMask, aDstStageMask, aDependencyFlags,
+        VKPP_DEVICE_PROC(vkCmdPipelineBarrier)(mCommandBuffer, aSrcStageMask, aDstStageMask, aDependencyFlags,
             SizeOf<uint32_t>(aMemoryBarriers), &aMemoryBarriers[0],
             SizeOf<uint32_t>(aBufferMemoryBarriers), &aBufferMemoryBarriers[0],
             SizeOf<uint32_t>(aImageMemoryBarriers), &aImageMemoryBarriers[0]);
@@ -489,7 +530,7 @@ public:
     {
         assert(!aMemoryBarriers.empty());
 
-        vkCmdPipelineBarrier(mCommandBuffer, aSrcStageMask, aDstStageMask, aDependencyFlags,
+        VKPP_DEVICE_PROC(vkCmdPipelineBarrier)(mCommandBuffer, aSrcStageMask, aDstStageMask, aDependencyFlags,
             SizeOf<uint32_t>(aMemoryBarriers), &aMemoryBarriers[0],
             0, nullptr,
             0, nullptr);
@@ -498,7 +539,7 @@ public:
     void PipelineBarrier(const PipelineStageFlags& aSrcStageMask, const PipelineStageFlags& aDstStageMask, const DependencyFlags& aDependencyFlags,
         const MemoryBarrier& aMemoryBarrier) const
     {
-        vkCmdPipelineBarrier(mCommandBuffer, aSrcStageMask, aDstStageMask, aDependencyFlags,
+        VKPP_DEVICE_PROC(vkCmdPipelineBarrier)(mCommandBuffer, aSrcStageMask, aDstStageMask, aDependencyFlags,
             1, &aMemoryBarrier,
             0, nullptr,
             0, nullptr);
@@ -509,7 +550,7 @@ public:
     {
         assert(!aBufferMemoryBarriers.empty());
 
-        vkCmdPipelineBarrier(mCommandBuffer, aSrcStageMask, aDstStageMask, aDependencyFlags,
+        VKPP_DEVICE_PROC(vkCmdPipelineBarrier)(mCommandBuffer, aSrcStageMask, aDstStageMask, aDependencyFlags,
             0, nullptr,
             SizeOf<uint32_t>(aBufferMemoryBarriers), &aBufferMemoryBarriers[0],
             0, nullptr);
@@ -518,7 +559,7 @@ public:
     void PipelineBarrier(const PipelineStageFlags& aSrcStageMask, const PipelineStageFlags& aDstStageMask, const DependencyFlags& aDependencyFlags,
         const BufferMemoryBarrier& aBufferMemoryBarrier) const
     {
-        vkCmdPipelineBarrier(mCommandBuffer, aSrcStageMask, aDstStageMask, aDependencyFlags,
+        VKPP_DEVICE_PROC(vkCmdPipelineBarrier)(mCommandBuffer, aSrcStageMask, aDstStageMask, aDependencyFlags,
             0, nullptr,
             1, &aBufferMemoryBarrier,
             0, nullptr);
@@ -529,7 +570,7 @@ public:
     {
         assert(!aImageMemoryBarriers.empty());
 
-        vkCmdPipelineBarrier(mCommandBuffer, aSrcStageMask, aDstStageMask, aDependencyFlags,
+        VKPP_DEVICE_PROC(vkCmdPipelineBarrier)(mCommandBuffer, aSrcStageMask, aDstStageMask, aDependencyFlags,
             0, nullptr,
             0, nullptr,
             SizeOf<uint32_t>(aImageMemoryBarriers), &aImageMemoryBarriers[0]);
@@ -538,7 +579,7 @@ public:
     void PipelineBarrier(const PipelineStageFlags& aSrcStageMask, const PipelineStageFlags& aDstStageMask, const DependencyFlags& aDependencyFlags,
         const ImageMemoryBarrier& aImageMemoryBarrier) const
     {
-        vkCmdPipelineBarrier(mCommandBuffer, aSrcStageMask, aDstStageMask, aDependencyFlags,
+        VKPP_DEVICE_PROC(vkCmdPipelineBarrier)(mCommandBuffer, aSrcStageMask, aDstStageMask, aDependencyFlags,
             0, nullptr,
             0, nullptr,
             1, &aImageMemoryBarrier);
@@ -546,29 +587,57 @@ public:
 
      void PipelineBarrier(const CommandPipelineBarrier& aCmdPipelineBarrier) const
      {
-         vkCmdPipelineBarrier(mCommandBuffer, aCmdPipelineBarrier.srcStageMask, aCmdPipelineBarrier.dstStageMask, aCmdPipelineBarrier.dependencyFlags,
+         VKPP_DEVICE_PROC(vkCmdPipelineBarrier)(mCommandBuffer, aCmdPipelineBarrier.srcStageMask, aCmdPipelineBarrier.dstStageMask, aCmdPipelineBarrier.dependencyFlags,
              aCmdPipelineBarrier.memoryBarrierCount, reinterpret_cast<const VkMemoryBarrier*>(aCmdPipelineBarrier.pMemoryBarriers),
              aCmdPipelineBarrier.bufferMemoryBarrierCount, reinterpret_cast<const VkBufferMemoryBarrier*>(aCmdPipelineBarrier.pBufferMemoryBarriers),
              aCmdPipelineBarrier.imageMemoryBarrierCount, reinterpret_cast<const VkImageMemoryBarrier*>(aCmdPipelineBarrier.pImageMemoryBarriers));
      }
 
+    // Queries have to be reset, outside of a render pass, before each use.
+    void ResetQueryPool(const QueryPool& aQueryPool, uint32_t aFirstQuery, uint32_t aQueryCount) const
+    {
+        VKPP_DEVICE_PROC(vkCmdResetQueryPool)(mCommandBuffer, aQueryPool, aFirstQuery, aQueryCount);
+    }
+
+    void BeginQuery(const QueryPool& aQueryPool, uint32_t aQuery, const QueryControlFlags& aFlags = DefaultFlags) const
+    {
+        VKPP_DEVICE_PROC(vkCmdBeginQuery)(mCommandBuffer, aQueryPool, aQuery, aFlags);
+    }
+
+    void EndQuery(const QueryPool& aQueryPool, uint32_t aQuery) const
+    {
+        VKPP_DEVICE_PROC(vkCmdEndQuery)(mCommandBuffer, aQueryPool, aQuery);
+    }
+
+    // The timestamp is written once every previous command has completed aPipelineStage.
+    void WriteTimestamp(PipelineStageFlagBits aPipelineStage, const QueryPool& aQueryPool, uint32_t aQuery) const
+    {
+        VKPP_DEVICE_PROC(vkCmdWriteTimestamp)(mCommandBuffer, static_cast<VkPipelineStageFlagBits>(aPipelineStage), aQueryPool, aQuery);
+    }
+
+    void CopyQueryPoolResults(const QueryPool& aQueryPool, uint32_t aFirstQuery, uint32_t aQueryCount, const Buffer& aDstBuffer, DeviceSize aDstOffset,
+        DeviceSize aStride, const QueryResultFlags& aFlags = DefaultFlags) const
+    {
+        VKPP_DEVICE_PROC(vkCmdCopyQueryPoolResults)(mCommandBuffer, aQueryPool, aFirstQuery, aQueryCount, aDstBuffer, aDstOffset, aStride, aFlags);
+    }
+
     void ClearColorImage(const Image& aImage, ImageLayout aImageLayout, const ClearColorValue& aClearColor, const std::vector<ImageSubresourceRange>& aRanges) const
     {
         assert(!aRanges.empty());
 
-        vkCmdClearColorImage(mCommandBuffer, aImage, static_cast<VkImageLayout>(aImageLayout), &aClearColor, SizeOf<uint32_t>(aRanges), &aRanges[0]);
+        VKPP_DEVICE_PROC(vkCmdClearColorImage)(mCommandBuffer, aImage, static_cast<VkImageLayout>(aImageLayout), &aClearColor, SizeOf<uint32_t>(aRanges), &aRanges[0]);
     }
 
     void SetViewport(const Viewport& aViewport, uint32_t aFirstViewport = 0) const
     {
-        vkCmdSetViewport(mCommandBuffer, aFirstViewport, 1, &aViewport);
+        VKPP_DEVICE_PROC(vkCmdSetViewport)(mCommandBuffer, aFirstViewport, 1, &aViewport);
     }
 
     void SetViewports(uint32_t aFirstViewport, uint32_t aViewportCount, const Viewport* apViewports) const
     {
         assert(aViewportCount != 0 && apViewports != nullptr);
 
-        vkCmdSetViewport(mCommandBuffer, aFirstViewport, aViewportCount, &apViewports[0]);
+        VKPP_DEVICE_PROC(vkCmdSetViewport)(mCommandBuffer, aFirstViewport, aViewportCount, &apViewports[0]);
     }
 
     template <typename T, typename = EnableIfValueType<ValueType<T>, Viewport>>
@@ -584,34 +653,34 @@ public:
 
     void SetLineWidth(float aLineWidth) const
     {
-        vkCmdSetLineWidth(mCommandBuffer, aLineWidth);
+        VKPP_DEVICE_PROC(vkCmdSetLineWidth)(mCommandBuffer, aLineWidth);
     }
 
     void SetDepthBias(float aDepthBiasConstantFactor, float aDepthBiasClamp, float aDepthBiasSlopeFactor) const
     {
-        vkCmdSetDepthBias(mCommandBuffer, aDepthBiasConstantFactor, aDepthBiasClamp, aDepthBiasSlopeFactor);
+        VKPP_DEVICE_PROC(vkCmdSetDepthBias)(mCommandBuffer, aDepthBiasConstantFactor, aDepthBiasClamp, aDepthBiasSlopeFactor);
     }
 
     void SetBlendConstants(const std::array<float, 4>& aBlendConstants) const
     {
-        vkCmdSetBlendConstants(mCommandBuffer, aBlendConstants.data());
+        VKPP_DEVICE_PROC(vkCmdSetBlendConstants)(mCommandBuffer, aBlendConstants.data());
     }
 
     void SetBlendConstants(const float aBlendConstants[4]) const
     {
-        vkCmdSetBlendConstants(mCommandBuffer, aBlendConstants);
+        VKPP_DEVICE_PROC(vkCmdSetBlendConstants)(mCommandBuffer, aBlendConstants);
     }
 
     void SetScissor(const Rect2D& aScissor, uint32_t aFirstScissor = 0) const
     {
-        vkCmdSetScissor(mCommandBuffer, aFirstScissor, 1, &aScissor);
+        VKPP_DEVICE_PROC(vkCmdSetScissor)(mCommandBuffer, aFirstScissor, 1, &aScissor);
     }
 
     void SetScissors(uint32_t aFirstScissor, uint32_t aScissorCount, const Rect2D* apScissors) const
     {
         assert(aScissorCount != 0 && apScissors != nullptr);
 
-        vkCmdSetScissor(mCommandBuffer, aFirstScissor, aScissorCount, &apScissors[0]);
+        VKPP_DEVICE_PROC(vkCmdSetScissor)(mCommandBuffer, aFirstScissor, aScissorCount, &apScissors[0]);
     }
 
     template<typename T, typename = EnableIfValueType<ValueType<T>, Rect2D>>
@@ -627,34 +696,34 @@ public:
 
     void SetDepthBounds(float aMinDepthBounds, float aMaxDepthBounds) const
     {
-       vkCmdSetDepthBounds(mCommandBuffer, aMinDepthBounds, aMaxDepthBounds);
+       VKPP_DEVICE_PROC(vkCmdSetDepthBounds)(mCommandBuffer, aMinDepthBounds, aMaxDepthBounds);
     }
 
     void SetStencilCompareMask(const StencilFaceFlags& aFaceMask, uint32_t aCompareMask) const
     {
-        vkCmdSetStencilCompareMask(mCommandBuffer, aFaceMask, aCompareMask);
+        VKPP_DEVICE_PROC(vkCmdSetStencilCompareMask)(mCommandBuffer, aFaceMask, aCompareMask);
     }
 
     void SetStencilWriteMask(const StencilFaceFlags& aFaceMask, uint32_t aWriteMask) const
     {
-        vkCmdSetStencilWriteMask(mCommandBuffer, aFaceMask, aWriteMask);
+        VKPP_DEVICE_PROC(vkCmdSetStencilWriteMask)(mCommandBuffer, aFaceMask, aWriteMask);
     }
 
     void SetStencilReference(const StencilFaceFlags& aFaceMask, uint32_t aReference) const
     {
-        vkCmdSetStencilReference(mCommandBuffer, aFaceMask, aReference);
+        VKPP_DEVICE_PROC(vkCmdSetStencilReference)(mCommandBuffer, aFaceMask, aReference);
     }
 
     void BindVertexBuffer(const Buffer& aBuffer, const DeviceSize& aOffset = 0, uint32_t aFirstBinding = 0) const
     {
-        vkCmdBindVertexBuffers(mCommandBuffer, aFirstBinding, 1, &aBuffer, &aOffset);
+        VKPP_DEVICE_PROC(vkCmdBindVertexBuffers)(mCommandBuffer, aFirstBinding, 1, &aBuffer, &aOffset);
     }
 
     void BindVertexBuffers(uint32_t aFirstBinding, uint32_t aBindingCount, const Buffer* apBuffers, const DeviceSize* apOffsets) const
     {
         assert(aBindingCount != 0 && apBuffers != nullptr && apOffsets != nullptr);
 
-        vkCmdBindVertexBuffers(mCommandBuffer, aFirstBinding, aBindingCount, &apBuffers[0], &apOffsets[0]);
+        VKPP_DEVICE_PROC(vkCmdBindVertexBuffers)(mCommandBuffer, aFirstBinding, aBindingCount, &apBuffers[0], &apOffsets[0]);
     }
 
     template <typename B, typename S, typename = EnableIfValueType<ValueType<B>, Buffer, ValueType<S>, DeviceSize>>
@@ -670,20 +739,20 @@ public:
 
     void BindIndexBuffer(const Buffer& aBuffer, DeviceSize aOffset = 0, IndexType aIndexType = IndexType::eUInt32) const
     {
-        vkCmdBindIndexBuffer(mCommandBuffer, aBuffer, aOffset, static_cast<VkIndexType>(aIndexType));
+        VKPP_DEVICE_PROC(vkCmdBindIndexBuffer)(mCommandBuffer, aBuffer, aOffset, static_cast<VkIndexType>(aIndexType));
     }
 
     // Copy Data Between Buffers
     void Copy(Buffer& aDstBuffer, const Buffer& aSrcBuffer, const BufferCopy& aRegion) const
     {
-        vkCmdCopyBuffer(mCommandBuffer, aSrcBuffer, aDstBuffer, 1, &aRegion);
+        VKPP_DEVICE_PROC(vkCmdCopyBuffer)(mCommandBuffer, aSrcBuffer, aDstBuffer, 1, &aRegion);
     }
 
     void Copy(Buffer& aDstBuffer, const Buffer& aSrcBuffer, const std::vector<BufferCopy>& aRegions) const
     {
         assert(!aRegions.empty());
 
-        vkCmdCopyBuffer(mCommandBuffer, aSrcBuffer, aDstBuffer, SizeOf<uint32_t>(aRegions), &aRegions[0]);
+        VKPP_DEVICE_PROC(vkCmdCopyBuffer)(mCommandBuffer, aSrcBuffer, aDstBuffer, SizeOf<uint32_t>(aRegions), &aRegions[0]);
     }
 
     template <std::size_t R>
@@ -691,7 +760,7 @@ public:
     {
         static_assert(!aRegions.empty());
 
-        vkCmdCopyBuffer(mCommandBuffer, aSrcBuffer, aDstBuffer, SizeOf<uint32_t>(aRegions), &aRegions[0]);
+        VKPP_DEVICE_PROC(vkCmdCopyBuffer)(mCommandBuffer, aSrcBuffer, aDstBuffer, SizeOf<uint32_t>(aRegions), &aRegions[0]);
     }
 
     // Copy Data Between Images
@@ -700,7 +769,7 @@ public:
         assert(vkpp::ImageLayout::eTransferDstOptimal == aDstImageLayout || vkpp::ImageLayout::eGeneral == aDstImageLayout);
         assert(vkpp::ImageLayout::eTransferSrcOptimal == aSrcImageLayout || vkpp::ImageLayout::eGeneral == aSrcImageLayout);
 
-        vkCmdCopyImage(mCommandBuffer, aSrcImage, static_cast<VkImageLayout>(aSrcImageLayout), aDstImage, static_cast<VkImageLayout>(aDstImageLayout), 1, &aRegion);
+        VKPP_DEVICE_PROC(vkCmdCopyImage)(mCommandBuffer, aSrcImage, static_cast<VkImageLayout>(aSrcImageLayout), aDstImage, static_cast<VkImageLayout>(aDstImageLayout), 1, &aRegion);
     }
 
     void Copy(Image& aDstImage, ImageLayout aDstImageLayout, const Image& aSrcImage, ImageLayout aSrcImageLayout, const std::vector<ImageCopy>& aRegions) const
@@ -709,7 +778,7 @@ public:
         assert(vkpp::ImageLayout::eTransferDstOptimal == aDstImageLayout || vkpp::ImageLayout::eGeneral == aDstImageLayout);
         assert(vkpp::ImageLayout::eTransferSrcOptimal == aSrcImageLayout || vkpp::ImageLayout::eGeneral == aSrcImageLayout);
 
-        vkCmdCopyImage(mCommandBuffer, aSrcImage, static_cast<VkImageLayout>(aSrcImageLayout), aDstImage, static_cast<VkImageLayout>(aDstImageLayout), SizeOf<uint32_t>(aRegions), &aRegions[0]);
+        VKPP_DEVICE_PROC(vkCmdCopyImage)(mCommandBuffer, aSrcImage, static_cast<VkImageLayout>(aSrcImageLayout), aDstImage, static_cast<VkImageLayout>(aDstImageLayout), SizeOf<uint32_t>(aRegions), &aRegions[0]);
     }
 
     template <std::size_t R>
@@ -719,7 +788,7 @@ public:
         assert(vkpp::ImageLayout::eTransferDstOptimal == aDstImageLayout || vkpp::ImageLayout::eGeneral == aDstImageLayout);
         assert(vkpp::ImageLayout::eTransferSrcOptimal == aSrcImageLayout || vkpp::ImageLayout::eGeneral == aSrcImageLayout);
 
-        vkCmdCopyImage(mCommandBuffer, aSrcImage, static_cast<VkImageLayout>(aSrcImageLayout), aDstImage, static_cast<VkImageLayout>(aDstImageLayout), SizeOf<uint32_t>(aRegions), &aRegions[0]);
+        VKPP_DEVICE_PROC(vkCmdCopyImage)(mCommandBuffer, aSrcImage, static_cast<VkImageLayout>(aSrcImageLayout), aDstImage, static_cast<VkImageLayout>(aDstImageLayout), SizeOf<uint32_t>(aRegions), &aRegions[0]);
     }
 
     // Copy Data From Buffers to Images
@@ -727,7 +796,7 @@ public:
     {
         assert(vkpp::ImageLayout::eTransferDstOptimal == aDstImageLayout || vkpp::ImageLayout::eGeneral == aDstImageLayout);
 
-        vkCmdCopyBufferToImage(mCommandBuffer, aSrcBuffer, aDstImage, static_cast<VkImageLayout>(aDstImageLayout), 1, &aRegion);
+        VKPP_DEVICE_PROC(vkCmdCopyBufferToImage)(mCommandBuffer, aSrcBuffer, aDstImage, static_cast<VkImageLayout>(aDstImageLayout), 1, &aRegion);
     }
 
     void Copy(Image& aDstImage, ImageLayout aDstImageLayout, const Buffer& aSrcBuffer, const std::vector<BufferImageCopy>& aRegions) const
@@ -735,7 +804,7 @@ public:
         assert(vkpp::ImageLayout::eTransferDstOptimal == aDstImageLayout || vkpp::ImageLayout::eGeneral == aDstImageLayout);
         assert(!aRegions.empty());
 
-        vkCmdCopyBufferToImage(mCommandBuffer, aSrcBuffer, aDstImage, static_cast<VkImageLayout>(aDstImageLayout), SizeOf<uint32_t>(aRegions), &aRegions[0]);
+        VKPP_DEVICE_PROC(vkCmdCopyBufferToImage)(mCommandBuffer, aSrcBuffer, aDstImage, static_cast<VkImageLayout>(aDstImageLayout), SizeOf<uint32_t>(aRegions), &aRegions[0]);
     }
 
     template <std::size_t R>
@@ -744,7 +813,7 @@ public:
         assert(vkpp::ImageLayout::eTransferDstOptimal == aDstImageLayout || vkpp::ImageLayout::eGeneral == aDstImageLayout);
         static_assert(!aRegions.empty());
 
-        vkCmdCopyBufferToImage(mCommandBuffer, aSrcBuffer, aDstImage, static_cast<VkImageLayout>(aDstImageLayout), SizeOf<uint32_t>(aRegions), &aRegions[0]);
+        VKPP_DEVICE_PROC(vkCmdCopyBufferToImage)(mCommandBuffer, aSrcBuffer, aDstImage, static_cast<VkImageLayout>(aDstImageLayout), SizeOf<uint32_t>(aRegions), &aRegions[0]);
     }
 
     // Copy Data From Images to Buffers
@@ -752,7 +821,7 @@ public:
     {
         assert(vkpp::ImageLayout::eTransferSrcOptimal == aSrcImageLayout || vkpp::ImageLayout::eGeneral == aSrcImageLayout);
 
-        vkCmdCopyImageToBuffer(mCommandBuffer, aSrcImage, static_cast<VkImageLayout>(aSrcImageLayout), aDstBuffer, 1, &aRegion);
+        VKPP_DEVICE_PROC(vkCmdCopyImageToBuffer)(mCommandBuffer, aSrcImage, static_cast<VkImageLayout>(aSrcImageLayout), aDstBuffer, 1, &aRegion);
     }
 
     void Copy(Buffer& aDstBuffer, const Image& aSrcImage, ImageLayout aSrcImageLayout, const std::vector<BufferImageCopy>& aRegions) const
@@ -760,7 +829,7 @@ public:
         assert(vkpp::ImageLayout::eTransferSrcOptimal == aSrcImageLayout || vkpp::ImageLayout::eGeneral == aSrcImageLayout);
         assert(!aRegions.empty());
 
-        vkCmdCopyImageToBuffer(mCommandBuffer, aSrcImage, static_cast<VkImageLayout>(aSrcImageLayout), aDstBuffer, SizeOf<uint32_t>(aRegions), &aRegions[0]);
+        VKPP_DEVICE_PROC(vkCmdCopyImageToBuffer)(mCommandBuffer, aSrcImage, static_cast<VkImageLayout>(aSrcImageLayout), aDstBuffer, SizeOf<uint32_t>(aRegions), &aRegions[0]);
     }
 
     template <std::size_t R>
@@ -769,7 +838,7 @@ public:
         assert(vkpp::ImageLayout::eTransferSrcOptimal == aSrcImageLayout || vkpp::ImageLayout::eGeneral == aSrcImageLayout);
         static_assert(!aRegions.empty());
 
-        vkCmdCopyImageToBuffer(mCommandBuffer, aSrcImage, static_cast<VkImageLayout>(aSrcImageLayout), aDstBuffer, SizeOf<uint32_t>(aRegions), &aRegions[0]);
+        VKPP_DEVICE_PROC(vkCmdCopyImageToBuffer)(mCommandBuffer, aSrcImage, static_cast<VkImageLayout>(aSrcImageLayout), aDstBuffer, SizeOf<uint32_t>(aRegions), &aRegions[0]);
     }
 
     // Image Copies with Scaling
@@ -778,7 +847,7 @@ public:
         assert(vkpp::ImageLayout::eTransferDstOptimal == aDstImageLayout || vkpp::ImageLayout::eGeneral == aDstImageLayout);
         assert(vkpp::ImageLayout::eTransferSrcOptimal == aSrcImageLayout || vkpp::ImageLayout::eGeneral == aSrcImageLayout);
 
-        vkCmdBlitImage(mCommandBuffer, aSrcImage, static_cast<VkImageLayout>(aSrcImageLayout), aDstImage, static_cast<VkImageLayout>(aDstImageLayout), 1, &aRegion, static_cast<VkFilter>(aFilter));
+        VKPP_DEVICE_PROC(vkCmdBlitImage)(mCommandBuffer, aSrcImage, static_cast<VkImageLayout>(aSrcImageLayout), aDstImage, static_cast<VkImageLayout>(aDstImageLayout), 1, &aRegion, static_cast<VkFilter>(aFilter));
     }
 
     void Blit(Image& aDstImage, ImageLayout aDstImageLayout, const Image& aSrcImage, ImageLayout aSrcImageLayout, const std::vector<ImageBlit>& aRegions, Filter aFilter) const
@@ -787,7 +856,7 @@ public:
         assert(vkpp::ImageLayout::eTransferDstOptimal == aDstImageLayout || vkpp::ImageLayout::eGeneral == aDstImageLayout);
         assert(vkpp::ImageLayout::eTransferSrcOptimal == aSrcImageLayout || vkpp::ImageLayout::eGeneral == aSrcImageLayout);
 
-        vkCmdBlitImage(mCommandBuffer, aSrcImage, static_cast<VkImageLayout>(aSrcImageLayout), aDstImage, static_cast<VkImageLayout>(aDstImageLayout), SizeOf<uint32_t>(aRegions), &aRegions[0], static_cast<VkFilter>(aFilter));
+        VKPP_DEVICE_PROC(vkCmdBlitImage)(mCommandBuffer, aSrcImage, static_cast<VkImageLayout>(aSrcImageLayout), aDstImage, static_cast<VkImageLayout>(aDstImageLayout), SizeOf<uint32_t>(aRegions), &aRegions[0], static_cast<VkFilter>(aFilter));
     }
 
     template <std::size_t R>
@@ -797,7 +866,7 @@ public:
         assert(vkpp::ImageLayout::eTransferDstOptimal == aDstImageLayout || vkpp::ImageLayout::eGeneral == aDstImageLayout);
         assert(vkpp::ImageLayout::eTransferSrcOptimal == aSrcImageLayout || vkpp::ImageLayout::eGeneral == aSrcImageLayout);
 
-        vkCmdBlitImage(mCommandBuffer, aSrcImage, static_cast<VkImageLayout>(aSrcImageLayout), aDstImage, static_cast<VkImageLayout>(aDstImageLayout), SizeOf<uint32_t>(aRegions), &aRegions[0], static_cast<VkFilter>(aFilter));
+        VKPP_DEVICE_PROC(vkCmdBlitImage)(mCommandBuffer, aSrcImage, static_cast<VkImageLayout>(aSrcImageLayout), aDstImage, static_cast<VkImageLayout>(aDstImageLayout), SizeOf<uint32_t>(aRegions), &aRegions[0], static_cast<VkFilter>(aFilter));
     }
 };
 
@@ -0,0 +1,265 @@
+#ifndef __VKPP_TYPE_DESCRIPTOR_ALLOCATOR_H__
+#define __VKPP_TYPE_DESCRIPTOR_ALLOCATOR_H__
+
+
+
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+
+#include <Info/Common.h>
+
+#include <Type/LogicalDevice.h>
+#include <Type/DescriptorSet.h>
+#include <Type/DescriptorPool.h>
+
+
+
+namespace vkpp
+{
+
+
+
+/**
+ * \class DescriptorAllocator
+ *
+ * \brief Allocates descriptor sets from a growing list of descriptor pools instead of one hand-sized pool.
+ *
+ * Every pool is sized from per-type ratios of descriptors per set. The allocator counts the sets and descriptors of every type left in
+ * the current pool, and moves on to a fresh pool, twice as large as the previous one up to a cap, before a set would not fit: overrunning
+ * a pool is invalid usage on Vulkan 1.0 without VK_KHR_maintenance1, so the allocator never relies on VK_ERROR_OUT_OF_POOL_MEMORY_KHR.
+ * That needs the descriptors each layout takes, hence layouts are registered with RegisterSetLayout before their first allocation.
+ * Sets are never freed individually, so a pool can't fragment. Reset returns all the sets at once with vkResetDescriptorPool and keeps
+ * the pools for reuse; use one allocator per frame in flight for per-frame sets. The ratios must cover every descriptor type of the
+ * registered layouts. A layout taking more descriptors of a type than even a fresh pool holds gets a dedicated pool sized for one of its
+ * sets; those pools are destroyed by Reset rather than kept, so size the ratios for the common layouts.
+ */
+class DescriptorAllocator
+{
+public:
+    struct PoolSizeRatio
+    {
+        DescriptorType type;
+        float descriptorsPerSet;
+    };
+
+private:
+    const LogicalDevice& mLogicalDevice;
+    const std::vector<PoolSizeRatio> mPoolSizeRatios;
+    const uint32_t mMaxSetsPerPool;
+    const DescriptorPoolCreateFlags mFlags;
+
+    struct Pool
+    {
+        DescriptorPool handle;
+        uint32_t setCount{ 0 };
+    };
+
+    uint32_t mSetsPerPool;
+
+    Pool mCurrentPool;
+    std::vector<Pool> mUsedPools;               // Exhausted, waiting for Reset.
+    std::vector<Pool> mFreePools;               // Reset, reused before creating another pool.
+    std::vector<DescriptorPool> mDedicatedPools;    // One set each, of a layout the ratios can't hold.
+
+    // What is left in the current pool; the descriptor counts are indexed like mPoolSizeRatios.
+    uint32_t mRemainingSets{ 0 };
+    std::vector<uint32_t> mRemainingDescriptors;
+
+    // Descriptors of every ratio type a set of each registered layout takes.
+    std::unordered_map<VkDescriptorSetLayout, std::vector<uint32_t>> mSetLayoutDescriptors;
+
+    std::vector<DescriptorPoolSize> mPoolSizes;
+
+    uint32_t GetDescriptorCount(std::size_t aRatio, uint32_t aSetCount) const
+    {
+        return static_cast<uint32_t>(std::ceil(mPoolSizeRatios[aRatio].descriptorsPerSet * aSetCount));
+    }
+
+    bool Fits(const std::vector<uint32_t>& aDescriptors) const noexcept
+    {
+        if (!mCurrentPool.handle || mRemainingSets == 0)
+            return false;
+
+        for (std::size_t lRatio = 0; lRatio < aDescriptors.size(); ++lRatio)
+        {
+            if (aDescriptors[lRatio] > mRemainingDescriptors[lRatio])
+                return false;
+        }
+
+        return true;
+    }
+
+    void GrabPool(void)
+    {
+        if (mCurrentPool.handle)
+            mUsedPools.push_back(mCurrentPool);
+
+        if (!mFreePools.empty())
+        {
+            mCurrentPool = mFreePools.back();
+            mFreePools.pop_back();
+        }
+        else
+        {
+            mPoolSizes.clear();
+
+            for (std::size_t lRatio = 0; lRatio < mPoolSizeRatios.size(); ++lRatio)
+                mPoolSizes.emplace_back(mPoolSizeRatios[lRatio].type, GetDescriptorCount(lRatio, mSetsPerPool));
+
+            mCurrentPool = Pool{ mLogicalDevice.CreateDescriptorPool({ mPoolSizes, mSetsPerPool, mFlags }), mSetsPerPool };
+
+            mSetsPerPool = std::min(mSetsPerPool * 2, mMaxSetsPerPool);
+        }
+
+        mRemainingSets = mCurrentPool.setCount;
+
+        for (std::size_t lRatio = 0; lRatio < mPoolSizeRatios.size(); ++lRatio)
+            mRemainingDescriptors[lRatio] = GetDescriptorCount(lRatio, mCurrentPool.setCount);
+    }
+
+    const DescriptorPool& CreateDedicatedPool(const std::vector<uint32_t>& aDescriptors)
+    {
+        mPoolSizes.clear();
+
+        for (std::size_t lRatio = 0; lRatio < aDescriptors.size(); ++lRatio)
+        {
+            if (aDescriptors[lRatio] != 0)
+                mPoolSizes.emplace_back(mPoolSizeRatios[lRatio].type, aDescriptors[lRatio]);
+        }
+
+        return mDedicatedPools.emplace_back(mLogicalDevice.CreateDescriptorPool({ mPoolSizes, 1, mFlags }));
+    }
+
+public:
+    DescriptorAllocator(const LogicalDevice& aLogicalDevice, std::vector<PoolSizeRatio> aPoolSizeRatios, uint32_t aSetsPerPool = 64,
+        uint32_t aMaxSetsPerPool = 4096, const DescriptorPoolCreateFlags& aFlags = DefaultFlags)
+        : mLogicalDevice(aLogicalDevice), mPoolSizeRatios(std::move(aPoolSizeRatios)), mMaxSetsPerPool(std::max(aSetsPerPool, aMaxSetsPerPool)),
+          mFlags(aFlags), mSetsPerPool(aSetsPerPool), mRemainingDescriptors(mPoolSizeRatios.size(), 0)
+    {
+        assert(!mPoolSizeRatios.empty() && aSetsPerPool != 0);
+    }
+
+    DescriptorAllocator(const DescriptorAllocator&) = delete;
+    DescriptorAllocator& operator=(const DescriptorAllocator&) = delete;
+
+    ~DescriptorAllocator(void)
+    {
+        Clear();
+    }
+
+    // Record the bindings aSetLayout was created with. Register again if a destroyed layout's handle may have been recycled.
+    void RegisterSetLayout(const DescriptorSetLayout& aSetLayout, uint32_t aBindingCount, const DescriptorSetLayoutBinding* apBindings)
+    {
+        std::vector<uint32_t> lDescriptors(mPoolSizeRatios.size(), 0);
+
+        for (uint32_t lIndex = 0; lIndex < aBindingCount; ++lIndex)
+        {
+            const auto& lBinding = apBindings[lIndex];
+            const auto lRatioIter = std::find_if(mPoolSizeRatios.cbegin(), mPoolSizeRatios.cend(), [&lBinding](const PoolSizeRatio& aRatio)
+            {
+                return aRatio.type == lBinding.descriptorType;
+            });
+
+            assert(lRatioIter != mPoolSizeRatios.cend());
+
+            lDescriptors[lRatioIter - mPoolSizeRatios.cbegin()] += lBinding.descriptorCount;
+        }
+
+        mSetLayoutDescriptors[aSetLayout] = std::move(lDescriptors);
+    }
+
+    void RegisterSetLayout(const DescriptorSetLayout& aSetLayout, const DescriptorSetLayoutBinding& aBinding)
+    {
+        RegisterSetLayout(aSetLayout, 1, aBinding.AddressOf());
+    }
+
+    template <typename T, typename = EnableIfValueType<ValueType<T>, DescriptorSetLayoutBinding>>
+    void RegisterSetLayout(const DescriptorSetLayout& aSetLayout, T&& aBindings)
+    {
+        RegisterSetLayout(aSetLayout, SizeOf<uint32_t>(aBindings), DataOf(aBindings));
+    }
+
+    // aSetLayout must have been registered.
+    DescriptorSet Allocate(const DescriptorSetLayout& aSetLayout)
+    {
+        const auto lDescriptorsIter = mSetLayoutDescriptors.find(aSetLayout);
+
+        assert(lDescriptorsIter != mSetLayoutDescriptors.cend());
+
+        const auto& lDescriptors = lDescriptorsIter->second;
+
+        if (!Fits(lDescriptors))
+        {
+            GrabPool();
+
+            // Even a fresh pool is too small when the layout takes more descriptors of a type than the ratios provide.
+            if (!Fits(lDescriptors))
+                return mLogicalDevice.AllocateDescriptorSet({ CreateDedicatedPool(lDescriptors), aSetLayout });
+        }
+
+        const auto lDescriptorSet = mLogicalDevice.AllocateDescriptorSet({ mCurrentPool.handle, aSetLayout });
+
+        --mRemainingSets;
+
+        for (std::size_t lRatio = 0; lRatio < lDescriptors.size(); ++lRatio)
+            mRemainingDescriptors[lRatio] -= lDescriptors[lRatio];
+
+        return lDescriptorSet;
+    }
+
+    // Free all the sets allocated so far; none of them may still be in use by the device.
+    void Reset(void)
+    {
+        if (mCurrentPool.handle)
+            mUsedPools.push_back(mCurrentPool);
+
+        for (const auto& lPool : mUsedPools)
+        {
+            mLogicalDevice.ResetDescriptorPool(lPool.handle);
+            mFreePools.push_back(lPool);
+        }
+
+        for (const auto& lPool : mDedicatedPools)
+            mLogicalDevice.DestroyDescriptorPool(lPool);
+
+        mUsedPools.clear();
+        mDedicatedPools.clear();
+        mCurrentPool = Pool{};
+    }
+
+    // Destroy all the pools, and with them the sets allocated from them. The registered layouts are kept.
+    void Clear(void)
+    {
+        if (mCurrentPool.handle)
+            mLogicalDevice.DestroyDescriptorPool(mCurrentPool.handle);
+
+        for (const auto& lPool : mUsedPools)
+            mLogicalDevice.DestroyDescriptorPool(lPool.handle);
+
+        for (const auto& lPool : mFreePools)
+            mLogicalDevice.DestroyDescriptorPool(lPool.handle);
+
+        for (const auto& lPool : mDedicatedPools)
+            mLogicalDevice.DestroyDescriptorPool(lPool);
+
+        mUsedPools.clear();
+        mFreePools.clear();
+        mDedicatedPools.clear();
+        mCurrentPool = Pool{};
+    }
+
+    uint32_t GetPoolCount(void) const noexcept
+    {
+        return static_cast<uint32_t>(mUsedPools.size() + mFreePools.size() + mDedicatedPools.size()) + (mCurrentPool.handle ? 1 : 0);
+    }
+};
+
+
+
+}                   // End of namespace vkpp.
+
+
+
+#endif              // __VKPP_TYPE_DESCRIPTOR_ALLOCATOR_H__
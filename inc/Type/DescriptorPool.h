@@ -38,7 +38,8 @@ ConsistencyCheck(DescriptorPoolSize, type, descriptorCount)
 
 enum class DescriptorPoolCreateFlagBits
 {
-    eFreeDescriptorSet  = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT
+    eFreeDescriptorSet  = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT,
+    eUpdateAfterBindEXT = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT_EXT
 };
 
 VKPP_ENUM_BIT_MASK_FLAGS(DescriptorPoolCreate)
@@ -89,7 +89,8 @@ ConsistencyCheck(DescriptorSetLayoutBinding, binding, descriptorType, descriptor
 
 enum class DescriptorSetLayoutCreateFlagBits
 {
-    ePushDescriptorKHR      = VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR
+    ePushDescriptorKHR      = VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR,
+    eUpdateAfterBindPoolEXT = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT_EXT
 };
 
 VKPP_ENUM_BIT_MASK_FLAGS(DescriptorSetLayoutCreate)
@@ -452,4 +453,77 @@ ConsistencyCheck(CopyDescriptorSetInfo, pNext, srcSet, srcBinding, srcArrayEleme
 
 
 
+namespace vkpp::ext
+{
+
+
+
+enum class DescriptorBindingFlagBits
+{
+    eUpdateAfterBind            = VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT,
+    eUpdateUnusedWhilePending   = VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT_EXT,
+    ePartiallyBound             = VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT,
+    eVariableDescriptorCount    = VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT_EXT
+};
+
+VKPP_ENUM_BIT_MASK_FLAGS_EXT(DescriptorBinding)
+
+
+
+// Chained to DescriptorSetLayoutCreateInfo, one flags entry per binding; requires VK_EXT_descriptor_indexing.
+class DescriptorSetLayoutBindingFlagsCreateInfo : public internal::VkTrait<DescriptorSetLayoutBindingFlagsCreateInfo, VkDescriptorSetLayoutBindingFlagsCreateInfoEXT>
+{
+private:
+    const internal::Structure sType = internal::Structure::eDescriptorSetLayoutBindingFlags;
+
+public:
+    const void*                     pNext{ nullptr };
+    uint32_t                        bindingCount{ 0 };
+    const DescriptorBindingFlags*   pBindingFlags{ nullptr };
+
+    DEFINE_CLASS_MEMBER(DescriptorSetLayoutBindingFlagsCreateInfo)
+
+    constexpr DescriptorSetLayoutBindingFlagsCreateInfo(uint32_t aBindingCount, const DescriptorBindingFlags* apBindingFlags) noexcept
+        : bindingCount(aBindingCount), pBindingFlags(apBindingFlags)
+    {}
+
+    template <typename F, typename = EnableIfValueType<ValueType<F>, DescriptorBindingFlags>>
+    constexpr DescriptorSetLayoutBindingFlagsCreateInfo(F&& aBindingFlags) noexcept
+        : DescriptorSetLayoutBindingFlagsCreateInfo(SizeOf<uint32_t>(aBindingFlags), DataOf(aBindingFlags))
+    {
+        StaticLValueRefAssert(F, aBindingFlags);
+    }
+
+    DescriptorSetLayoutBindingFlagsCreateInfo& SetNext(const void* apNext) noexcept
+    {
+        pNext = apNext;
+
+        return *this;
+    }
+
+    DescriptorSetLayoutBindingFlagsCreateInfo& SetBindingFlags(uint32_t aBindingCount, const DescriptorBindingFlags* apBindingFlags) noexcept
+    {
+        bindingCount    = aBindingCount;
+        pBindingFlags   = apBindingFlags;
+
+        return *this;
+    }
+
+    template <typename F, typename = EnableIfValueType<ValueType<F>, DescriptorBindingFlags>>
+    DescriptorSetLayoutBindingFlagsCreateInfo& SetBindingFlags(F&& aBindingFlags) noexcept
+    {
+        StaticLValueRefAssert(F, aBindingFlags);
+
+        return SetBindingFlags(SizeOf<uint32_t>(aBindingFlags), DataOf(aBindingFlags));
+    }
+};
+
+ConsistencyCheck(DescriptorSetLayoutBindingFlagsCreateInfo, pNext, bindingCount, pBindingFlags)
+
+
+
+}                   // End of namespace vkpp::ext.
+
+
+
 #endif              // __VKPP_TYPE_DESCRIPTOR_SET_H__
@@ -0,0 +1,225 @@
+#ifndef __VKPP_TYPE_DESCRIPTOR_SET_CACHE_H__
+#define __VKPP_TYPE_DESCRIPTOR_SET_CACHE_H__
+
+
+
+#include <vector>
+#include <unordered_map>
+
+#include <Info/Common.h>
+#include <Info/Hash.h>
+
+#include <Type/LogicalDevice.h>
+#include <Type/DescriptorSet.h>
+#include <Type/DescriptorAllocator.h>
+
+
+
+namespace vkpp
+{
+
+
+
+/**
+ * \class DescriptorSetCache
+ *
+ * \brief Returns an already written descriptor set for a layout and a list of writes it has seen before.
+ *
+ * The key holds the layout and the contents of the writes (bindings, types and the image, buffer or texel buffer view descriptors), but not
+ * their dstSet, which the cache fills in on a miss; it is compared in full on a hash hit. Handles are hashed by value, so Clear the cache before a destroyed image view, sampler
+ * or buffer can be recycled for a different object. Writes with a pNext chain are not supported.
+ * NextFrame ages the entries: a set unused for more than aMaxUnusedFrames frames is recycled for the next miss on the same layout, so that
+ * count must cover the frames in flight. Sets come from a DescriptorAllocator, which must know the layouts, and are never freed individually.
+ */
+class DescriptorSetCache
+{
+private:
+    struct Entry
+    {
+        internal::HashKey key;
+        DescriptorSet descriptorSet;
+        VkDescriptorSetLayout setLayout;
+        uint64_t lastUsedFrame;
+    };
+
+    const LogicalDevice& mLogicalDevice;
+    DescriptorAllocator& mDescriptorAllocator;
+    const uint32_t mMaxUnusedFrames;
+
+    uint64_t mFrame{ 0 };
+
+    // Colliding hashes share a bucket; the keys tell them apart.
+    std::unordered_multimap<uint64_t, Entry> mEntries;
+    std::unordered_map<VkDescriptorSetLayout, std::vector<DescriptorSet>> mFreeSets;
+
+    std::vector<WriteDescriptorSetInfo> mWrites;
+    internal::HashKey mKey;                             // Key of the current lookup, kept for its capacity.
+
+    uint32_t mHitCount{ 0 };
+    uint32_t mMissCount{ 0 };
+
+    void Recycle(const Entry& aEntry)
+    {
+        mFreeSets[aEntry.setLayout].push_back(aEntry.descriptorSet);
+    }
+
+public:
+    DescriptorSetCache(const LogicalDevice& aLogicalDevice, DescriptorAllocator& aDescriptorAllocator, uint32_t aMaxUnusedFrames = 8) noexcept
+        : mLogicalDevice(aLogicalDevice), mDescriptorAllocator(aDescriptorAllocator), mMaxUnusedFrames(aMaxUnusedFrames)
+    {}
+
+    DescriptorSetCache(const DescriptorSetCache&) = delete;
+    DescriptorSetCache& operator=(const DescriptorSetCache&) = delete;
+
+    // Given apKey, also append the hashed bytes to it.
+    static uint64_t Hash(const DescriptorSetLayout& aSetLayout, uint32_t aWriteCount, const WriteDescriptorSetInfo* apWrites, internal::HashKey* apKey = nullptr)
+    {
+        internal::Hasher lHasher{ apKey };
+
+        lHasher.Add(static_cast<const VkDescriptorSetLayout&>(aSetLayout)).Add(aWriteCount);
+
+        for (uint32_t lIndex = 0; lIndex < aWriteCount; ++lIndex)
+        {
+            const VkWriteDescriptorSet& lWrite = *&apWrites[lIndex];
+
+            assert(lWrite.pNext == nullptr);
+
+            lHasher.Add(lWrite.dstBinding).Add(lWrite.dstArrayElement).Add(lWrite.descriptorCount).Add(lWrite.descriptorType);
+
+            switch (lWrite.descriptorType)
+            {
+            case VK_DESCRIPTOR_TYPE_SAMPLER:
+            case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+            case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+            case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+            case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+                // Hashed member by member, VkDescriptorImageInfo is padded on 64-bit targets.
+                for (uint32_t lElement = 0; lElement < lWrite.descriptorCount; ++lElement)
+                {
+                    const auto& lImageInfo = lWrite.pImageInfo[lElement];
+                    lHasher.Add(lImageInfo.sampler).Add(lImageInfo.imageView).Add(lImageInfo.imageLayout);
+                }
+                break;
+
+            case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+                lHasher.AddArray(lWrite.descriptorCount, lWrite.pTexelBufferView);
+                break;
+
+            default:
+                lHasher.AddArray(lWrite.descriptorCount, lWrite.pBufferInfo);
+                break;
+            }
+        }
+
+        return lHasher.Get();
+    }
+
+    // The cache and its allocator keep ownership of the returned set, which is valid until it ages out or the allocator is reset.
+    DescriptorSet GetDescriptorSet(const DescriptorSetLayout& aSetLayout, uint32_t aWriteCount, const WriteDescriptorSetInfo* apWrites)
+    {
+        assert(aWriteCount != 0 && apWrites != nullptr);
+
+        mKey.clear();
+
+        const auto lHash = Hash(aSetLayout, aWriteCount, apWrites, &mKey);
+        const auto lRange = mEntries.equal_range(lHash);
+
+        for (auto lIter = lRange.first; lIter != lRange.second; ++lIter)
+        {
+            if (lIter->second.key == mKey)
+            {
+                ++mHitCount;
+
+                lIter->second.lastUsedFrame = mFrame;
+                return lIter->second.descriptorSet;
+            }
+        }
+
+        ++mMissCount;
+
+        DescriptorSet lDescriptorSet;
+        auto& lFreeSets = mFreeSets[aSetLayout];
+
+        if (lFreeSets.empty())
+            lDescriptorSet = mDescriptorAllocator.Allocate(aSetLayout);
+        else
+        {
+            lDescriptorSet = lFreeSets.back();
+            lFreeSets.pop_back();
+        }
+
+        mWrites.clear();
+
+        for (uint32_t lIndex = 0; lIndex < aWriteCount; ++lIndex)
+            mWrites.emplace_back(apWrites[lIndex]).SetDescriptorSet(lDescriptorSet);
+
+        mLogicalDevice.UpdateDescriptorSets(mWrites);
+
+        mEntries.emplace(lHash, Entry{ mKey, lDescriptorSet, aSetLayout, mFrame });
+
+        return lDescriptorSet;
+    }
+
+    template <typename T, typename = EnableIfValueType<ValueType<T>, WriteDescriptorSetInfo>>
+    DescriptorSet GetDescriptorSet(const DescriptorSetLayout& aSetLayout, T&& aWrites)
+    {
+        return GetDescriptorSet(aSetLayout, SizeOf<uint32_t>(aWrites), DataOf(aWrites));
+    }
+
+    // Call once per frame, after the device is done with the oldest frame in flight.
+    void NextFrame(void)
+    {
+        ++mFrame;
+
+        for (auto lIter = mEntries.begin(); lIter != mEntries.end();)
+        {
+            if (mFrame - lIter->second.lastUsedFrame > mMaxUnusedFrames)
+            {
+                Recycle(lIter->second);
+                lIter = mEntries.erase(lIter);
+            }
+            else
+                ++lIter;
+        }
+    }
+
+    // Forget every entry and keep the sets for reuse; none of them may still be in use by the device.
+    void Clear(void)
+    {
+        for (const auto& lEntry : mEntries)
+            Recycle(lEntry.second);
+
+        mEntries.clear();
+    }
+
+    // Drop the entries and the recycled sets after the allocator has been reset or cleared.
+    void Reset(void) noexcept
+    {
+        mEntries.clear();
+        mFreeSets.clear();
+    }
+
+    std::size_t GetSize(void) const noexcept
+    {
+        return mEntries.size();
+    }
+
+    uint32_t GetHitCount(void) const noexcept
+    {
+        return mHitCount;
+    }
+
+    uint32_t GetMissCount(void) const noexcept
+    {
+        return mMissCount;
+    }
+};
+
+
+
+}                   // End of namespace vkpp.
+
+
+
+#endif              // __VKPP_TYPE_DESCRIPTOR_SET_CACHE_H__
@@ -0,0 +1,319 @@
+#ifndef __VKPP_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_H__
+#define __VKPP_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_H__
+
+
+
+#include <new>
+#include <array>
+#include <tuple>
+#include <cstddef>
+#include <utility>
+
+#include <Info/Common.h>
+#include <Info/Flags.h>
+#include <Info/PipelineStage.h>
+
+#include <Type/RenderPass.h>
+#include <Type/DescriptorSet.h>
+
+
+
+namespace vkpp::internal
+{
+
+
+
+// Offsets of consecutive arrays of the given sizes and alignments, packed as tightly as their alignments allow.
+template <std::size_t N>
+constexpr std::array<std::size_t, N> PackOffsets(const std::array<std::size_t, N>& aSizes, const std::array<std::size_t, N>& aAlignments) noexcept
+{
+    std::array<std::size_t, N> lOffsets{};
+    std::size_t lOffset{ 0 };
+
+    for (std::size_t lIndex = 0; lIndex < N; ++lIndex)
+    {
+        lOffset = (lOffset + aAlignments[lIndex] - 1) / aAlignments[lIndex] * aAlignments[lIndex];
+        lOffsets[lIndex] = lOffset;
+        lOffset += aSizes[lIndex];
+    }
+
+    return lOffsets;
+}
+
+
+
+}                   // End of namespace vkpp::internal.
+
+
+
+namespace vkpp::khr
+{
+
+
+
+enum class DescriptorUpdateTemplateType
+{
+    eDescriptorSet      = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET_KHR,
+    ePushDescriptors    = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_PUSH_DESCRIPTORS_KHR
+};
+
+
+
+enum class DescriptorUpdateTemplateCreateFlagBits
+{};
+
+VKPP_ENUM_BIT_MASK_FLAGS_KHR(DescriptorUpdateTemplateCreate)
+
+
+
+// Where the descriptors of one binding are read from: descriptorCount elements of the user data, the first one at offset and the next ones every stride bytes.
+struct DescriptorUpdateTemplateEntry : public internal::VkTrait<DescriptorUpdateTemplateEntry, VkDescriptorUpdateTemplateEntryKHR>
+{
+    uint32_t        dstBinding{ 0 };
+    uint32_t        dstArrayElement{ 0 };
+    uint32_t        descriptorCount{ 0 };
+    DescriptorType  descriptorType{ DescriptorType::eSampler };
+    std::size_t     offset{ 0 };
+    std::size_t     stride{ 0 };
+
+    DEFINE_CLASS_MEMBER(DescriptorUpdateTemplateEntry)
+
+    constexpr DescriptorUpdateTemplateEntry(uint32_t aDstBinding, uint32_t aDstArrayElement, uint32_t aDescriptorCount, DescriptorType aDescriptorType,
+        std::size_t aOffset, std::size_t aStride) noexcept
+        : dstBinding(aDstBinding), dstArrayElement(aDstArrayElement), descriptorCount(aDescriptorCount), descriptorType(aDescriptorType),
+          offset(aOffset), stride(aStride)
+    {}
+};
+
+ConsistencyCheck(DescriptorUpdateTemplateEntry, dstBinding, dstArrayElement, descriptorCount, descriptorType, offset, stride)
+
+
+
+class DescriptorUpdateTemplateCreateInfo : public internal::VkTrait<DescriptorUpdateTemplateCreateInfo, VkDescriptorUpdateTemplateCreateInfoKHR>
+{
+private:
+    const internal::Structure sType = internal::Structure::eDescriptorUpdateTemplate;
+
+public:
+    const void*                             pNext{ nullptr };
+    DescriptorUpdateTemplateCreateFlags     flags;
+    uint32_t                                descriptorUpdateEntryCount{ 0 };
+    const DescriptorUpdateTemplateEntry*    pDescriptorUpdateEntries{ nullptr };
+    DescriptorUpdateTemplateType            templateType{ DescriptorUpdateTemplateType::eDescriptorSet };
+    DescriptorSetLayout                     descriptorSetLayout;            // Only used by DescriptorUpdateTemplateType::eDescriptorSet templates.
+    PipelineBindPoint                       pipelineBindPoint{ PipelineBindPoint::eGraphics };     // The three last members are only used by push descriptor templates.
+    PipelineLayout                          pipelineLayout;
+    uint32_t                                set{ 0 };
+
+    DEFINE_CLASS_MEMBER(DescriptorUpdateTemplateCreateInfo)
+
+    // A template writing descriptor sets of aDescriptorSetLayout.
+    DescriptorUpdateTemplateCreateInfo(uint32_t aEntryCount, const DescriptorUpdateTemplateEntry* apEntries, const DescriptorSetLayout& aDescriptorSetLayout) noexcept
+        : descriptorUpdateEntryCount(aEntryCount), pDescriptorUpdateEntries(apEntries), descriptorSetLayout(aDescriptorSetLayout)
+    {}
+
+    template <typename E, typename = EnableIfValueType<ValueType<E>, DescriptorUpdateTemplateEntry>>
+    DescriptorUpdateTemplateCreateInfo(E&& aEntries, const DescriptorSetLayout& aDescriptorSetLayout) noexcept
+        : DescriptorUpdateTemplateCreateInfo(SizeOf<uint32_t>(aEntries), DataOf(aEntries), aDescriptorSetLayout)
+    {
+        StaticLValueRefAssert(E, aEntries);
+    }
+
+    // A template pushing the descriptors of set aSet of aPipelineLayout, requires VK_KHR_push_descriptor.
+    DescriptorUpdateTemplateCreateInfo(uint32_t aEntryCount, const DescriptorUpdateTemplateEntry* apEntries, PipelineBindPoint aPipelineBindPoint,
+        const PipelineLayout& aPipelineLayout, uint32_t aSet) noexcept
+        : descriptorUpdateEntryCount(aEntryCount), pDescriptorUpdateEntries(apEntries), templateType(DescriptorUpdateTemplateType::ePushDescriptors),
+          pipelineBindPoint(aPipelineBindPoint), pipelineLayout(aPipelineLayout), set(aSet)
+    {}
+
+    template <typename E, typename = EnableIfValueType<ValueType<E>, DescriptorUpdateTemplateEntry>>
+    DescriptorUpdateTemplateCreateInfo(E&& aEntries, PipelineBindPoint aPipelineBindPoint, const PipelineLayout& aPipelineLayout, uint32_t aSet) noexcept
+        : DescriptorUpdateTemplateCreateInfo(SizeOf<uint32_t>(aEntries), DataOf(aEntries), aPipelineBindPoint, aPipelineLayout, aSet)
+    {
+        StaticLValueRefAssert(E, aEntries);
+    }
+
+    DescriptorUpdateTemplateCreateInfo& SetNext(const void* apNext) noexcept
+    {
+        pNext = apNext;
+
+        return *this;
+    }
+
+    DescriptorUpdateTemplateCreateInfo& SetEntries(uint32_t aEntryCount, const DescriptorUpdateTemplateEntry* apEntries) noexcept
+    {
+        descriptorUpdateEntryCount  = aEntryCount;
+        pDescriptorUpdateEntries    = apEntries;
+
+        return *this;
+    }
+
+    template <typename E, typename = EnableIfValueType<ValueType<E>, DescriptorUpdateTemplateEntry>>
+    DescriptorUpdateTemplateCreateInfo& SetEntries(E&& aEntries) noexcept
+    {
+        StaticLValueRefAssert(E, aEntries);
+
+        return SetEntries(SizeOf<uint32_t>(aEntries), DataOf(aEntries));
+    }
+
+    DescriptorUpdateTemplateCreateInfo& SetDescriptorSetLayout(const DescriptorSetLayout& aDescriptorSetLayout) noexcept
+    {
+        templateType        = DescriptorUpdateTemplateType::eDescriptorSet;
+        descriptorSetLayout = aDescriptorSetLayout;
+
+        return *this;
+    }
+
+    DescriptorUpdateTemplateCreateInfo& SetPushDescriptors(PipelineBindPoint aPipelineBindPoint, const PipelineLayout& aPipelineLayout, uint32_t aSet) noexcept
+    {
+        templateType        = DescriptorUpdateTemplateType::ePushDescriptors;
+        pipelineBindPoint   = aPipelineBindPoint;
+        pipelineLayout      = aPipelineLayout;
+        set                 = aSet;
+
+        return *this;
+    }
+};
+
+ConsistencyCheck(DescriptorUpdateTemplateCreateInfo, pNext, flags, descriptorUpdateEntryCount, pDescriptorUpdateEntries, templateType, descriptorSetLayout,
+    pipelineBindPoint, pipelineLayout, set)
+
+
+
+class DescriptorUpdateTemplate : public internal::VkTrait<DescriptorUpdateTemplate, VkDescriptorUpdateTemplateKHR>
+{
+private:
+    VkDescriptorUpdateTemplateKHR mDescriptorUpdateTemplate{ VK_NULL_HANDLE };
+
+public:
+    DescriptorUpdateTemplate(void) noexcept = default;
+
+    DescriptorUpdateTemplate(std::nullptr_t) noexcept
+    {}
+
+    explicit DescriptorUpdateTemplate(VkDescriptorUpdateTemplateKHR aDescriptorUpdateTemplate) noexcept : mDescriptorUpdateTemplate(aDescriptorUpdateTemplate)
+    {}
+};
+
+StaticSizeCheck(DescriptorUpdateTemplate)
+
+
+
+// Binding aBinding of a DescriptorTemplateData, holding aCount descriptors of type aType.
+template <uint32_t aBinding, DescriptorType aType, uint32_t aCount = 1>
+struct DescriptorTemplateBinding
+{
+    static_assert(aCount != 0);
+
+    constexpr static uint32_t Binding = aBinding;
+    constexpr static DescriptorType Type = aType;
+    constexpr static uint32_t Count = aCount;
+
+    constexpr static bool IsImage = aType == DescriptorType::eSampler || aType == DescriptorType::eCombinedImageSampler || aType == DescriptorType::eSampledImage
+        || aType == DescriptorType::eStorageImage || aType == DescriptorType::eInputAttachment;
+    constexpr static bool IsTexelBuffer = aType == DescriptorType::eUniformTexelBuffer || aType == DescriptorType::eStorageTexelBuffer;
+
+    using Descriptor = std::conditional_t<IsImage, DescriptorImageInfo, std::conditional_t<IsTexelBuffer, BufferView, DescriptorBufferInfo>>;
+};
+
+
+
+/**
+ * \class DescriptorTemplateData
+ *
+ * \brief Packs the descriptors of a set into one block and derives the matching template entries at compile time.
+ *
+ * Each DescriptorTemplateBinding gets a tightly packed array of DescriptorImageInfo, DescriptorBufferInfo or BufferView, so a whole set
+ * is written with a single UpdateDescriptorSetWithTemplate call from GetData, using a template created from GetEntries.
+ *
+ * using MaterialData = khr::DescriptorTemplateData<khr::DescriptorTemplateBinding<0, DescriptorType::eUniformBuffer>,
+ *                                                  khr::DescriptorTemplateBinding<1, DescriptorType::eCombinedImageSampler, 2>>;
+ */
+template <typename... Bindings>
+class DescriptorTemplateData
+{
+public:
+    constexpr static std::size_t BindingCount = sizeof...(Bindings);
+
+    static_assert(BindingCount != 0);
+
+    template <std::size_t Index>
+    using Binding = std::tuple_element_t<Index, std::tuple<Bindings...>>;
+
+    template <std::size_t Index>
+    using Descriptor = typename Binding<Index>::Descriptor;
+
+private:
+    constexpr static std::array<std::size_t, BindingCount> Sizes{ sizeof(typename Bindings::Descriptor) * Bindings::Count... };
+    constexpr static std::array<std::size_t, BindingCount> Alignments{ alignof(typename Bindings::Descriptor)... };
+
+    constexpr static std::array<std::size_t, BindingCount> Offsets = internal::PackOffsets(Sizes, Alignments);
+    constexpr static std::size_t Size = Offsets[BindingCount - 1] + Sizes[BindingCount - 1];
+
+    template <std::size_t... Indices>
+    constexpr static std::array<DescriptorUpdateTemplateEntry, BindingCount> MakeEntries(std::index_sequence<Indices...>) noexcept
+    {
+        return
+        { {
+            { Bindings::Binding, 0, Bindings::Count, Bindings::Type, Offsets[Indices], sizeof(typename Bindings::Descriptor) }...
+        } };
+    }
+
+    template <std::size_t Index>
+    void Construct(void) noexcept
+    {
+        const auto lpDescriptors = reinterpret_cast<Descriptor<Index>*>(mData + Offsets[Index]);
+
+        for (uint32_t lElement = 0; lElement < Binding<Index>::Count; ++lElement)
+            new (lpDescriptors + lElement) Descriptor<Index>;
+    }
+
+    template <std::size_t... Indices>
+    void Construct(std::index_sequence<Indices...>) noexcept
+    {
+        (Construct<Indices>(), ...);
+    }
+
+    alignas(typename Bindings::Descriptor...) std::byte mData[Size];
+
+public:
+    DescriptorTemplateData(void) noexcept
+    {
+        Construct(std::index_sequence_for<Bindings...>{});
+    }
+
+    constexpr static std::array<DescriptorUpdateTemplateEntry, BindingCount> GetEntries(void) noexcept
+    {
+        return MakeEntries(std::index_sequence_for<Bindings...>{});
+    }
+
+    // Element aElement of the Index-th binding, in declaration order.
+    template <std::size_t Index>
+    Descriptor<Index>& Get(uint32_t aElement = 0) noexcept
+    {
+        assert(aElement < Binding<Index>::Count);
+
+        return std::launder(reinterpret_cast<Descriptor<Index>*>(mData + Offsets[Index]))[aElement];
+    }
+
+    template <std::size_t Index>
+    const Descriptor<Index>& Get(uint32_t aElement = 0) const noexcept
+    {
+        assert(aElement < Binding<Index>::Count);
+
+        return std::launder(reinterpret_cast<const Descriptor<Index>*>(mData + Offsets[Index]))[aElement];
+    }
+
+    const void* GetData(void) const noexcept
+    {
+        return mData;
+    }
+};
+
+
+
+}                   // End of namespace vkpp::khr.
+
+
+
+#endif              // __VKPP_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_H__
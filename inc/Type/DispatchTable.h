@@ -0,0 +1,350 @@
+#ifndef __VKPP_TYPE_DISPATCH_TABLE_H__
+#define __VKPP_TYPE_DISPATCH_TABLE_H__
+
+
+
+#include <memory>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <mutex>
+#include <shared_mutex>
+
+#include <Info/Common.h>
+
+
+
+// Instance level entry points: they take a VkInstance or a VkPhysicalDevice.
+#define VKPP_INSTANCE_FUNCTIONS(X) \
+    X(vkDestroyInstance) \
+    X(vkEnumeratePhysicalDevices) \
+    X(vkEnumerateDeviceLayerProperties) \
+    X(vkEnumerateDeviceExtensionProperties) \
+    X(vkGetPhysicalDeviceProperties) \
+    X(vkGetPhysicalDeviceFeatures) \
+    X(vkGetPhysicalDeviceFeatures2KHR) \
+    X(vkGetPhysicalDeviceFormatProperties) \
+    X(vkGetPhysicalDeviceMemoryProperties) \
+    X(vkGetPhysicalDeviceQueueFamilyProperties) \
+    X(vkCreateDevice) \
+    X(vkDestroySurfaceKHR) \
+    X(vkGetPhysicalDeviceSurfaceSupportKHR) \
+    X(vkGetPhysicalDeviceSurfaceCapabilitiesKHR) \
+    X(vkGetPhysicalDeviceSurfaceFormatsKHR) \
+    X(vkGetPhysicalDeviceSurfacePresentModesKHR) \
+    X(vkCreateDebugReportCallbackEXT) \
+    X(vkDestroyDebugReportCallbackEXT)
+
+
+
+// Device level entry points: they take a VkDevice, a VkQueue or a VkCommandBuffer.
+#define VKPP_DEVICE_FUNCTIONS(X) \
+    X(vkDestroyDevice) \
+    X(vkDeviceWaitIdle) \
+    X(vkGetDeviceQueue) \
+    X(vkQueueSubmit) \
+    X(vkQueueWaitIdle) \
+    X(vkAllocateMemory) \
+    X(vkFreeMemory) \
+    X(vkMapMemory) \
+    X(vkUnmapMemory) \
+    X(vkFlushMappedMemoryRanges) \
+    X(vkInvalidateMappedMemoryRanges) \
+    X(vkBindBufferMemory) \
+    X(vkBindImageMemory) \
+    X(vkGetBufferMemoryRequirements) \
+    X(vkGetImageMemoryRequirements) \
+    X(vkGetImageSubresourceLayout) \
+    X(vkCreateFence) \
+    X(vkDestroyFence) \
+    X(vkResetFences) \
+    X(vkGetFenceStatus) \
+    X(vkWaitForFences) \
+    X(vkCreateSemaphore) \
+    X(vkDestroySemaphore) \
+    X(vkCreateQueryPool) \
+    X(vkDestroyQueryPool) \
+    X(vkGetQueryPoolResults) \
+    X(vkCreateBuffer) \
+    X(vkDestroyBuffer) \
+    X(vkCreateBufferView) \
+    X(vkDestroyBufferView) \
+    X(vkCreateImage) \
+    X(vkDestroyImage) \
+    X(vkCreateImageView) \
+    X(vkDestroyImageView) \
+    X(vkCreateShaderModule) \
+    X(vkDestroyShaderModule) \
+    X(vkCreatePipelineCache) \
+    X(vkDestroyPipelineCache) \
+    X(vkGetPipelineCacheData) \
+    X(vkMergePipelineCaches) \
+    X(vkCreateGraphicsPipelines) \
+    X(vkCreateComputePipelines) \
+    X(vkDestroyPipeline) \
+    X(vkCreatePipelineLayout) \
+    X(vkDestroyPipelineLayout) \
+    X(vkCreateSampler) \
+    X(vkDestroySampler) \
+    X(vkCreateDescriptorSetLayout) \
+    X(vkDestroyDescriptorSetLayout) \
+    X(vkCreateDescriptorPool) \
+    X(vkDestroyDescriptorPool) \
+    X(vkResetDescriptorPool) \
+    X(vkAllocateDescriptorSets) \
+    X(vkFreeDescriptorSets) \
+    X(vkUpdateDescriptorSets) \
+    X(vkCreateFramebuffer) \
+    X(vkDestroyFramebuffer) \
+    X(vkCreateRenderPass) \
+    X(vkDestroyRenderPass) \
+    X(vkCreateCommandPool) \
+    X(vkDestroyCommandPool) \
+    X(vkResetCommandPool) \
+    X(vkAllocateCommandBuffers) \
+    X(vkFreeCommandBuffers) \
+    X(vkBeginCommandBuffer) \
+    X(vkEndCommandBuffer) \
+    X(vkCmdBindPipeline) \
+    X(vkCmdSetViewport) \
+    X(vkCmdSetScissor) \
+    X(vkCmdSetLineWidth) \
+    X(vkCmdSetDepthBias) \
+    X(vkCmdSetBlendConstants) \
+    X(vkCmdSetDepthBounds) \
+    X(vkCmdSetStencilCompareMask) \
+    X(vkCmdSetStencilWriteMask) \
+    X(vkCmdSetStencilReference) \
+    X(vkCmdBindDescriptorSets) \
+    X(vkCmdBindIndexBuffer) \
+    X(vkCmdBindVertexBuffers) \
+    X(vkCmdDraw) \
+    X(vkCmdDrawIndexed) \
+    X(vkCmdDrawIndirect) \
+    X(vkCmdDrawIndexedIndirect) \
+    X(vkCmdDispatch) \
+    X(vkCmdDispatchIndirect) \
+    X(vkCmdCopyBuffer) \
+    X(vkCmdCopyImage) \
+    X(vkCmdBlitImage) \
+    X(vkCmdCopyBufferToImage) \
+    X(vkCmdCopyImageToBuffer) \
+    X(vkCmdClearColorImage) \
+    X(vkCmdPipelineBarrier) \
+    X(vkCmdBeginQuery) \
+    X(vkCmdEndQuery) \
+    X(vkCmdResetQueryPool) \
+    X(vkCmdWriteTimestamp) \
+    X(vkCmdCopyQueryPoolResults) \
+    X(vkCmdPushConstants) \
+    X(vkCmdBeginRenderPass) \
+    X(vkCmdNextSubpass) \
+    X(vkCmdEndRenderPass) \
+    X(vkCmdExecuteCommands) \
+    X(vkCreateSwapchainKHR) \
+    X(vkDestroySwapchainKHR) \
+    X(vkGetSwapchainImagesKHR) \
+    X(vkAcquireNextImageKHR) \
+    X(vkQueuePresentKHR)
+
+
+
+// Device level entry points of extensions the loader doesn't export: they are always called through pointers fetched once per device.
+#define VKPP_DEVICE_EXTENSION_FUNCTIONS(X) \
+    X(vkCreateDescriptorUpdateTemplateKHR) \
+    X(vkDestroyDescriptorUpdateTemplateKHR) \
+    X(vkUpdateDescriptorSetWithTemplateKHR) \
+    X(vkCmdPushDescriptorSetWithTemplateKHR) \
+    X(vkCmdDrawIndirectCountKHR) \
+    X(vkCmdDrawIndexedIndirectCountKHR)
+
+
+
+#define VKPP_DECLARE_FUNCTION(Name) PFN_##Name Name{ nullptr };
+
+
+
+namespace vkpp::internal
+{
+
+
+
+/**
+ * \class InstanceDispatchTable
+ *
+ * \brief The instance level entry points, fetched once with vkGetInstanceProcAddr.
+ */
+struct InstanceDispatchTable
+{
+    VKPP_INSTANCE_FUNCTIONS(VKPP_DECLARE_FUNCTION)
+
+    void Load(VkInstance aInstance) noexcept
+    {
+#define VKPP_LOAD_INSTANCE_FUNCTION(Name) Name = reinterpret_cast<PFN_##Name>(vkGetInstanceProcAddr(aInstance, #Name));
+        VKPP_INSTANCE_FUNCTIONS(VKPP_LOAD_INSTANCE_FUNCTION)
+#undef VKPP_LOAD_INSTANCE_FUNCTION
+    }
+};
+
+
+
+/**
+ * \class DeviceDispatchTable
+ *
+ * \brief The device level entry points, fetched once with vkGetDeviceProcAddr.
+ *
+ * The pointers go straight to the driver (or the first enabled layer) instead of through the loader trampoline, which has to look up the
+ * dispatch table of the handle on every call. Entry points of extensions that are not enabled on the device are left null.
+ * A table holds the entry points of one device at a time: Unload it before loading it for another device.
+ */
+struct DeviceDispatchTable
+{
+    VkDevice device{ VK_NULL_HANDLE };
+
+    VKPP_DEVICE_FUNCTIONS(VKPP_DECLARE_FUNCTION)
+
+    void Load(VkDevice aDevice) noexcept
+    {
+        assert(device == VK_NULL_HANDLE || device == aDevice);
+
+        device = aDevice;
+
+#define VKPP_LOAD_DEVICE_FUNCTION(Name) Name = reinterpret_cast<PFN_##Name>(vkGetDeviceProcAddr(aDevice, #Name));
+        VKPP_DEVICE_FUNCTIONS(VKPP_LOAD_DEVICE_FUNCTION)
+#undef VKPP_LOAD_DEVICE_FUNCTION
+    }
+
+    void Unload(void) noexcept
+    {
+        *this = DeviceDispatchTable{};
+    }
+};
+
+
+
+/**
+ * \class DeviceExtensionTable
+ *
+ * \brief The extension entry points of one device, fetched once with vkGetDeviceProcAddr; those of extensions not enabled are left null.
+ */
+struct DeviceExtensionTable
+{
+    VKPP_DEVICE_EXTENSION_FUNCTIONS(VKPP_DECLARE_FUNCTION)
+
+    void Load(VkDevice aDevice) noexcept
+    {
+#define VKPP_LOAD_DEVICE_FUNCTION(Name) Name = reinterpret_cast<PFN_##Name>(vkGetDeviceProcAddr(aDevice, #Name));
+        VKPP_DEVICE_EXTENSION_FUNCTIONS(VKPP_LOAD_DEVICE_FUNCTION)
+#undef VKPP_LOAD_DEVICE_FUNCTION
+    }
+};
+
+
+
+/**
+ * \class DeviceExtensionRegistry
+ *
+ * \brief The DeviceExtensionTable of every live device, so that LogicalDevice stays as small as a VkDevice.
+ *
+ * LogicalDevice loads the table of a device it creates and drops it when destroying the device; a device created elsewhere is loaded on
+ * its first lookup. A lookup scans the few devices under a shared lock, which is far cheaper than vkGetDeviceProcAddr's string search.
+ */
+class DeviceExtensionRegistry
+{
+private:
+    mutable std::shared_mutex mMutex;
+    std::vector<std::pair<VkDevice, std::unique_ptr<DeviceExtensionTable>>> mTables;
+
+    const DeviceExtensionTable* Find(VkDevice aDevice) const noexcept
+    {
+        for (const auto& lTable : mTables)
+        {
+            if (lTable.first == aDevice)
+                return lTable.second.get();
+        }
+
+        return nullptr;
+    }
+
+public:
+    const DeviceExtensionTable& Load(VkDevice aDevice)
+    {
+        std::unique_lock<std::shared_mutex> lLock{ mMutex };
+
+        if (const auto lpTable = Find(aDevice))
+            return *lpTable;
+
+        auto lpTable = std::make_unique<DeviceExtensionTable>();
+        lpTable->Load(aDevice);
+
+        mTables.emplace_back(aDevice, std::move(lpTable));
+
+        return *mTables.back().second;
+    }
+
+    void Unload(VkDevice aDevice)
+    {
+        std::unique_lock<std::shared_mutex> lLock{ mMutex };
+
+        mTables.erase(std::remove_if(mTables.begin(), mTables.end(), [aDevice](const auto& aTable)
+        {
+            return aTable.first == aDevice;
+        }), mTables.end());
+    }
+
+    // The table stays valid until the device is destroyed.
+    const DeviceExtensionTable& Get(VkDevice aDevice)
+    {
+        {
+            std::shared_lock<std::shared_mutex> lLock{ mMutex };
+
+            if (const auto lpTable = Find(aDevice))
+                return *lpTable;
+        }
+
+        return Load(aDevice);
+    }
+};
+
+inline DeviceExtensionRegistry DeviceExtensions;
+
+
+
+// The tables of the instance and the device the wrappers dispatch through when VKPP_USE_DISPATCH_TABLE is defined.
+// Loaded by Instance and LogicalDevice on creation; the handles are no larger than their Vulkan counterparts, so the mode supports a single
+// device at a time. Creating a second LogicalDevice before destroying the first one asserts.
+inline InstanceDispatchTable InstanceDispatch;
+inline DeviceDispatchTable DeviceDispatch;
+
+
+
+}                   // End of namespace vkpp::internal.
+
+
+
+#undef VKPP_DECLARE_FUNCTION
+
+
+
+// VKPP_INSTANCE_PROC(vkName) and VKPP_DEVICE_PROC(vkName) name the entry point the wrappers call.
+// VKPP_GET_INSTANCE_PROC_ADDR fetches an instance extension entry point, from the table if there is one.
+// VKPP_GET_DEVICE_PROC_ADDR returns one of the VKPP_DEVICE_EXTENSION_FUNCTIONS of the device, loaded once per device in either mode.
+#ifdef VKPP_USE_DISPATCH_TABLE
+
+#define VKPP_INSTANCE_PROC(Name) ::vkpp::internal::InstanceDispatch.Name
+#define VKPP_DEVICE_PROC(Name) ::vkpp::internal::DeviceDispatch.Name
+#define VKPP_GET_INSTANCE_PROC_ADDR(Instance, Name) ::vkpp::internal::InstanceDispatch.Name
+
+#else
+
+#define VKPP_INSTANCE_PROC(Name) Name
+#define VKPP_DEVICE_PROC(Name) Name
+#define VKPP_GET_INSTANCE_PROC_ADDR(Instance, Name) reinterpret_cast<PFN_##Name>(vkGetInstanceProcAddr(Instance, #Name))
+
+#endif              // End of VKPP_USE_DISPATCH_TABLE
+
+#define VKPP_GET_DEVICE_PROC_ADDR(Device, Name) ::vkpp::internal::DeviceExtensions.Get(Device).Name
+
+
+
+#endif              // __VKPP_TYPE_DISPATCH_TABLE_H__
@@ -0,0 +1,114 @@
+#ifndef __VKPP_TYPE_FENCE_POOL_H__
+#define __VKPP_TYPE_FENCE_POOL_H__
+
+
+
+#include <vector>
+
+#include <Info/Common.h>
+
+#include <Type/LogicalDevice.h>
+#include <Type/Fence.h>
+
+
+
+namespace vkpp
+{
+
+
+
+/**
+ * \class FencePool
+ *
+ * \brief Recycles unsignaled fences instead of creating and destroying one per submission.
+ *
+ * Recycled fences are reset lazily, with a single vkResetFences for all of them, the next time the pool runs dry.
+ * The pool grows on demand; once warmed up, Acquire no longer creates anything.
+ */
+class FencePool
+{
+private:
+    const LogicalDevice& mLogicalDevice;
+
+    std::vector<Fence> mFreeFences;             // Unsignaled.
+    std::vector<Fence> mRecycledFences;         // Signaled or never submitted, waiting to be reset.
+
+    uint32_t mCreatedCount{ 0 };
+    uint32_t mReusedCount{ 0 };
+
+public:
+    explicit FencePool(const LogicalDevice& aLogicalDevice) noexcept : mLogicalDevice(aLogicalDevice)
+    {}
+
+    FencePool(const FencePool&) = delete;
+    FencePool& operator=(const FencePool&) = delete;
+
+    ~FencePool(void)
+    {
+        Clear();
+    }
+
+    // Return an unsignaled fence.
+    Fence Acquire(void)
+    {
+        if (mFreeFences.empty() && !mRecycledFences.empty())
+        {
+            mLogicalDevice.ResetFences(static_cast<uint32_t>(mRecycledFences.size()), mRecycledFences.data());
+            mFreeFences.swap(mRecycledFences);
+        }
+
+        if (mFreeFences.empty())
+        {
+            constexpr FenceCreateInfo lFenceCreateInfo;
+
+            ++mCreatedCount;
+            return mLogicalDevice.CreateFence(lFenceCreateInfo);
+        }
+
+        const auto lFence = mFreeFences.back();
+        mFreeFences.pop_back();
+
+        ++mReusedCount;
+        return lFence;
+    }
+
+    // aFence must no longer be used by any queue, i.e. it has been waited on or was never submitted.
+    void Recycle(const Fence& aFence)
+    {
+        mRecycledFences.push_back(aFence);
+    }
+
+    void WaitAndRecycle(const Fence& aFence)
+    {
+        mLogicalDevice.WaitForFence(aFence);
+        Recycle(aFence);
+    }
+
+    // Destroy the pooled fences. Fences still handed out are left to their owners.
+    void Clear(void)
+    {
+        mLogicalDevice.DestroyFences(mFreeFences);
+        mLogicalDevice.DestroyFences(mRecycledFences);
+
+        mFreeFences.clear();
+        mRecycledFences.clear();
+    }
+
+    uint32_t GetCreatedCount(void) const noexcept
+    {
+        return mCreatedCount;
+    }
+
+    uint32_t GetReusedCount(void) const noexcept
+    {
+        return mReusedCount;
+    }
+};
+
+
+
+}                   // End of namespace vkpp.
+
+
+
+#endif              // __VKPP_TYPE_FENCE_POOL_H__
@@ -0,0 +1,187 @@
+#ifndef __VKPP_TYPE_FRAME_QUERY_RING_H__
+#define __VKPP_TYPE_FRAME_QUERY_RING_H__
+
+
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include <Info/Common.h>
+
+#include <Type/LogicalDevice.h>
+#include <Type/CommandBuffer.h>
+#include <Type/QueryPool.h>
+
+
+
+namespace vkpp
+{
+
+
+
+namespace internal
+{
+
+
+
+/**
+ * \class FrameQueryRing
+ *
+ * \brief The frame-indexed query pools and named entries behind GPUProfiler and PipelineStatisticsProfiler.
+ *
+ * Every frame in flight owns a slice of each pool, made of up to aMaxSlotCount slots of aQueriesPerSlot queries. BeginFrame records the reset
+ * of the frame's slices, and each slot recorded into the frame remembers the named entry it feeds, so that the profilers resolve a frame into
+ * their entries once its fence has signaled. New entries are copies of a prototype, which lets the owner size their per-entry storage once.
+ */
+template <typename Entry>
+class FrameQueryRing
+{
+public:
+    constexpr static uint32_t InvalidSlot = UINT32_MAX;
+
+private:
+    const LogicalDevice& mLogicalDevice;
+    const uint32_t mFrameCount;
+    const uint32_t mMaxSlotCount;
+    const uint32_t mQueriesPerSlot;
+    const Entry mPrototype;
+
+    std::vector<QueryPool> mQueryPools;
+
+    // Entry index of every slot recorded into each frame, in query order.
+    std::vector<std::vector<uint32_t>> mFrameSlots;
+
+    std::vector<Entry> mEntries;
+    std::unordered_map<std::string, uint32_t> mEntryIndices;
+
+    uint32_t GetEntryIndex(const std::string& aName)
+    {
+        const auto lEntryIter = mEntryIndices.find(aName);
+
+        if (lEntryIter != mEntryIndices.cend())
+            return lEntryIter->second;
+
+        const auto lEntryIndex = static_cast<uint32_t>(mEntries.size());
+
+        mEntries.push_back(mPrototype);
+        mEntries.back().name = aName;
+
+        mEntryIndices.emplace(aName, lEntryIndex);
+
+        return lEntryIndex;
+    }
+
+public:
+    FrameQueryRing(const LogicalDevice& aLogicalDevice, uint32_t aFrameCount, uint32_t aMaxSlotCount, uint32_t aQueriesPerSlot, const Entry& aPrototype)
+        : mLogicalDevice(aLogicalDevice), mFrameCount(aFrameCount), mMaxSlotCount(aMaxSlotCount), mQueriesPerSlot(aQueriesPerSlot),
+          mPrototype(aPrototype), mFrameSlots(aFrameCount)
+    {
+        assert(aFrameCount != 0 && aMaxSlotCount != 0 && aQueriesPerSlot != 0);
+    }
+
+    FrameQueryRing(const FrameQueryRing&) = delete;
+    FrameQueryRing& operator=(const FrameQueryRing&) = delete;
+
+    ~FrameQueryRing(void)
+    {
+        for (auto& lQueryPool : mQueryPools)
+            mLogicalDevice.DestroyQueryPool(lQueryPool);
+    }
+
+    // Create a pool holding the slices of every frame; it is reset by BeginFrame and destroyed with the ring.
+    QueryPool CreateQueryPool(QueryType aQueryType, const QueryPipelineStatisticFlags& aPipelineStatistics = DefaultFlags)
+    {
+        const QueryPoolCreateInfo lQueryPoolCreateInfo
+        {
+            aQueryType,
+            mFrameCount * GetFrameQueryCount(),
+            aPipelineStatistics
+        };
+
+        mQueryPools.push_back(mLogicalDevice.CreateQueryPool(lQueryPoolCreateInfo));
+
+        return mQueryPools.back();
+    }
+
+    uint32_t GetFrameCount(void) const noexcept
+    {
+        return mFrameCount;
+    }
+
+    // Size of the slice every frame owns in each pool.
+    uint32_t GetFrameQueryCount(void) const noexcept
+    {
+        return mMaxSlotCount * mQueriesPerSlot;
+    }
+
+    uint32_t GetFirstQuery(uint32_t aFrame, uint32_t aSlot = 0) const noexcept
+    {
+        return aFrame * GetFrameQueryCount() + aSlot * mQueriesPerSlot;
+    }
+
+    // Record, outside of a render pass, the reset of the frame's slices; the slots recorded earlier into aFrame are dropped.
+    void BeginFrame(const CommandBuffer& aCommandBuffer, uint32_t aFrame)
+    {
+        assert(aFrame < mFrameCount);
+
+        mFrameSlots[aFrame].clear();
+
+        for (const auto& lQueryPool : mQueryPools)
+            aCommandBuffer.ResetQueryPool(lQueryPool, GetFirstQuery(aFrame), GetFrameQueryCount());
+    }
+
+    // Take the next slot of aFrame for the entry named aName. Return InvalidSlot once aFrame already holds the maximum number of slots.
+    uint32_t AcquireSlot(uint32_t aFrame, const std::string& aName)
+    {
+        assert(aFrame < mFrameCount);
+
+        auto& lSlots = mFrameSlots[aFrame];
+
+        if (lSlots.size() == mMaxSlotCount)
+            return InvalidSlot;
+
+        lSlots.push_back(GetEntryIndex(aName));
+
+        return static_cast<uint32_t>(lSlots.size() - 1);
+    }
+
+    // Entry index of every slot recorded into aFrame, in slot order.
+    const std::vector<uint32_t>& GetFrameSlots(uint32_t aFrame) const noexcept
+    {
+        assert(aFrame < mFrameCount);
+
+        return mFrameSlots[aFrame];
+    }
+
+    Entry& GetEntry(uint32_t aEntryIndex) noexcept
+    {
+        return mEntries[aEntryIndex];
+    }
+
+    // Entries in the order their names were first seen.
+    const std::vector<Entry>& GetEntries(void) const noexcept
+    {
+        return mEntries;
+    }
+
+    // Return nullptr if no slot of that name has been recorded yet.
+    const Entry* FindEntry(const std::string& aName) const
+    {
+        const auto lEntryIter = mEntryIndices.find(aName);
+
+        return lEntryIter != mEntryIndices.cend() ? &mEntries[lEntryIter->second] : nullptr;
+    }
+};
+
+
+
+}                   // End of namespace internal.
+
+
+
+}                   // End of namespace vkpp.
+
+
+
+#endif              // __VKPP_TYPE_FRAME_QUERY_RING_H__
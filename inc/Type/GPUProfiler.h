@@ -0,0 +1,209 @@
+#ifndef __VKPP_TYPE_GPU_PROFILER_H__
+#define __VKPP_TYPE_GPU_PROFILER_H__
+
+
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include <Info/Common.h>
+#include <Info/PipelineStage.h>
+
+#include <Type/LogicalDevice.h>
+#include <Type/CommandBuffer.h>
+#include <Type/QueryPool.h>
+#include <Type/FrameQueryRing.h>
+
+
+
+namespace vkpp
+{
+
+
+
+/**
+ * \class GPUProfiler
+ *
+ * \brief Measures the GPU time of named regions of command buffers with timestamp queries and keeps a rolling average per name.
+ *
+ * Every frame in flight owns a slice of one timestamp query pool, managed by an internal::FrameQueryRing. BeginFrame records the reset of the slice into the frame's command buffer;
+ * Resolve reads it back once the frame's fence has signaled, so results arrive a few frames late but the host never waits on the GPU.
+ * A frame recorded once and submitted repeatedly (prebuilt command buffers) is resolved again after each submission.
+ * Ticks are converted with PhysicalDeviceLimits::timestampPeriod and wrap around at the queue family's timestampValidBits.
+ * On a queue family without timestamp support (zero valid bits) the profiler records and measures nothing.
+ */
+class GPUProfiler
+{
+public:
+    struct PassTiming
+    {
+        std::string name;
+        double lastMilliseconds{ 0. };
+        double averageMilliseconds{ 0. };
+
+        std::vector<double> samples;            // Ring of the last AverageWindow timings.
+        uint32_t nextSample{ 0 };
+        double sampleSum{ 0. };
+    };
+
+    // Bracket the commands recorded during its lifetime.
+    class Scope
+    {
+    private:
+        GPUProfiler& mProfiler;
+        const CommandBuffer& mCommandBuffer;
+        const uint32_t mFrame;
+        const uint32_t mRegion;
+
+    public:
+        Scope(GPUProfiler& aProfiler, const CommandBuffer& aCommandBuffer, uint32_t aFrame, const std::string& aName)
+            : mProfiler(aProfiler), mCommandBuffer(aCommandBuffer), mFrame(aFrame), mRegion(aProfiler.BeginRegion(aCommandBuffer, aFrame, aName))
+        {}
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+        ~Scope(void)
+        {
+            mProfiler.EndRegion(mCommandBuffer, mFrame, mRegion);
+        }
+    };
+
+    constexpr static uint32_t InvalidRegion = internal::FrameQueryRing<PassTiming>::InvalidSlot;
+
+private:
+    const LogicalDevice& mLogicalDevice;
+    const double mNanosecondsPerTick;
+    const uint64_t mTimestampMask;
+    const uint32_t mAverageWindow;
+
+    // Every region takes two queries: its begin and end timestamps.
+    internal::FrameQueryRing<PassTiming> mQueryRing;
+    QueryPool mQueryPool;
+
+    std::vector<uint64_t> mResults;
+
+    static PassTiming MakePrototype(uint32_t aAverageWindow)
+    {
+        PassTiming lPass;
+        lPass.samples.resize(aAverageWindow, 0.);
+
+        return lPass;
+    }
+
+    void AddSample(PassTiming& aPass, double aMilliseconds)
+    {
+        // Until the window is full, the empty slots are zero and the average is taken over the samples seen so far.
+        aPass.sampleSum += aMilliseconds - aPass.samples[aPass.nextSample % mAverageWindow];
+        aPass.samples[aPass.nextSample % mAverageWindow] = aMilliseconds;
+        ++aPass.nextSample;
+
+        aPass.lastMilliseconds = aMilliseconds;
+        aPass.averageMilliseconds = aPass.sampleSum / std::min(aPass.nextSample, mAverageWindow);
+    }
+
+public:
+    // aFrameCount is the number of frames in flight, i.e. how many frames may be recorded before the oldest one is resolved.
+    GPUProfiler(const LogicalDevice& aLogicalDevice, float aTimestampPeriod, uint32_t aTimestampValidBits, uint32_t aFrameCount,
+        uint32_t aMaxRegionCount = 32, uint32_t aAverageWindow = 64)
+        : mLogicalDevice(aLogicalDevice), mNanosecondsPerTick(aTimestampPeriod),
+          mTimestampMask(aTimestampValidBits >= 64 ? UINT64_MAX : (uint64_t{ 1 } << aTimestampValidBits) - 1),
+          mAverageWindow(aAverageWindow), mQueryRing(aLogicalDevice, aFrameCount, aMaxRegionCount, 2, MakePrototype(aAverageWindow))
+    {
+        assert(aAverageWindow != 0);
+
+        if (!IsEnabled())
+            return;
+
+        mQueryPool = mQueryRing.CreateQueryPool(QueryType::eTimestamp);
+        mResults.resize(mQueryRing.GetFrameQueryCount());
+    }
+
+    GPUProfiler(const GPUProfiler&) = delete;
+    GPUProfiler& operator=(const GPUProfiler&) = delete;
+
+    bool IsEnabled(void) const noexcept
+    {
+        return mTimestampMask != 0;
+    }
+
+    // Record, outside of a render pass and before any region of aFrame, the reset of its queries; the regions recorded earlier into aFrame are dropped.
+    void BeginFrame(const CommandBuffer& aCommandBuffer, uint32_t aFrame)
+    {
+        if (!IsEnabled())
+            return;
+
+        mQueryRing.BeginFrame(aCommandBuffer, aFrame);
+    }
+
+    // Return InvalidRegion, and measure nothing, once aFrame already holds the maximum number of regions.
+    uint32_t BeginRegion(const CommandBuffer& aCommandBuffer, uint32_t aFrame, const std::string& aName,
+        PipelineStageFlagBits aPipelineStage = PipelineStageFlagBits::eTopOfPipe)
+    {
+        if (!IsEnabled())
+            return InvalidRegion;
+
+        const auto lRegion = mQueryRing.AcquireSlot(aFrame, aName);
+
+        if (lRegion != InvalidRegion)
+            aCommandBuffer.WriteTimestamp(aPipelineStage, mQueryPool, mQueryRing.GetFirstQuery(aFrame, lRegion));
+
+        return lRegion;
+    }
+
+    void EndRegion(const CommandBuffer& aCommandBuffer, uint32_t aFrame, uint32_t aRegion,
+        PipelineStageFlagBits aPipelineStage = PipelineStageFlagBits::eBottomOfPipe) const
+    {
+        if (aRegion == InvalidRegion)
+            return;
+
+        assert(aRegion < mQueryRing.GetFrameSlots(aFrame).size());
+
+        aCommandBuffer.WriteTimestamp(aPipelineStage, mQueryPool, mQueryRing.GetFirstQuery(aFrame, aRegion) + 1);
+    }
+
+    // Call once the submission of aFrame has completed, e.g. after waiting on its fence. Return false, without waiting, if its timestamps are not available.
+    bool Resolve(uint32_t aFrame)
+    {
+        const auto& lRegions = mQueryRing.GetFrameSlots(aFrame);
+
+        if (lRegions.empty())
+            return false;
+
+        const auto lQueryCount = static_cast<uint32_t>(lRegions.size() * 2);
+
+        if (mLogicalDevice.GetQueryPoolResults(mQueryPool, mQueryRing.GetFirstQuery(aFrame), lQueryCount, lQueryCount * sizeof(uint64_t), mResults.data(),
+            sizeof(uint64_t), QueryResultFlagBits::e64) == VK_NOT_READY)
+            return false;
+
+        for (std::size_t lRegion = 0; lRegion < lRegions.size(); ++lRegion)
+        {
+            const auto lTicks = (mResults[lRegion * 2 + 1] - mResults[lRegion * 2]) & mTimestampMask;
+
+            AddSample(mQueryRing.GetEntry(lRegions[lRegion]), lTicks * mNanosecondsPerTick * 1e-6);
+        }
+
+        return true;
+    }
+
+    // Passes in the order their names were first seen.
+    const std::vector<PassTiming>& GetPasses(void) const noexcept
+    {
+        return mQueryRing.GetEntries();
+    }
+
+    // Return nullptr if no region of that name has been recorded yet.
+    const PassTiming* GetPass(const std::string& aName) const
+    {
+        return mQueryRing.FindEntry(aName);
+    }
+};
+
+
+
+}                   // End of namespace vkpp.
+
+
+
+#endif              // __VKPP_TYPE_GPU_PROFILER_H__
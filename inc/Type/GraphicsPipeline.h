@@ -280,6 +280,79 @@ ConsistencyCheck(GraphicsPipelineCreateInfo, pNext, flags, stageCount, pStages,
 
 
 
+class ComputePipelineCreateInfo : public internal::VkTrait<ComputePipelineCreateInfo, VkComputePipelineCreateInfo>
+{
+private:
+    const internal::Structure sType = internal::Structure::ePipelineCompute;
+
+public:
+    const void*                     pNext{ nullptr };
+    PipelineCreateFlags             flags;
+    PipelineShaderStageCreateInfo   stage;
+    PipelineLayout                  layout;
+    Pipeline                        basePipelineHandle;
+    int32_t                         basePipelineIndex{ -1 };
+
+    DEFINE_CLASS_MEMBER(ComputePipelineCreateInfo)
+
+    ComputePipelineCreateInfo(const PipelineShaderStageCreateInfo& aStage, const PipelineLayout& aLayout,
+        const Pipeline& aBasePipelineHandle = nullptr, int32_t aBasePipelineIndex = -1, const PipelineCreateFlags& aFlags = DefaultFlags) noexcept
+        : flags(aFlags), stage(aStage), layout(aLayout), basePipelineHandle(aBasePipelineHandle), basePipelineIndex(aBasePipelineIndex)
+    {
+        assert(aStage.stage == ShaderStageFlagBits::eCompute);
+    }
+
+    ComputePipelineCreateInfo& SetNext(const void* apNext) noexcept
+    {
+        pNext = apNext;
+
+        return *this;
+    }
+
+    ComputePipelineCreateInfo& SetFlags(const PipelineCreateFlags& aFlags) noexcept
+    {
+        flags = aFlags;
+
+        return *this;
+    }
+
+    ComputePipelineCreateInfo& SetStage(const PipelineShaderStageCreateInfo& aStage) noexcept
+    {
+        assert(aStage.stage == ShaderStageFlagBits::eCompute);
+
+        // The stage is embedded by value and its sType is const, so it is copied member-wise.
+        stage.pNext                 = aStage.pNext;
+        stage.flags                 = aStage.flags;
+        stage.stage                 = aStage.stage;
+        stage.module                = aStage.module;
+        stage.pName                 = aStage.pName;
+        stage.pSpecializationInfo   = aStage.pSpecializationInfo;
+
+        return *this;
+    }
+
+    ComputePipelineCreateInfo& SetLayout(const PipelineLayout& aLayout) noexcept
+    {
+        layout = aLayout;
+
+        return *this;
+    }
+
+    ComputePipelineCreateInfo& SetBase(const Pipeline& aBaseHandle, int32_t aBaseIndex = -1) noexcept
+    {
+        assert((aBaseHandle && -1 == aBaseIndex) || (nullptr == aBaseHandle && aBaseIndex != -1));
+
+        basePipelineHandle  = aBaseHandle;
+        basePipelineIndex   = aBaseIndex;
+
+        return *this;
+    }
+};
+
+ConsistencyCheck(ComputePipelineCreateInfo, pNext, flags, stage, layout, basePipelineHandle, basePipelineIndex)
+
+
+
 }                   // End of namespace vkpp.
 
 
@@ -4,10 +4,12 @@
 
 
 #include <Info/Common.h>
+#include <Info/FixedVector.h>
 #include <Info/Layers.h>
 #include <Info/Extensions.h>
 
 #include <Type/AllocationCallbacks.h>
+#include <Type/DispatchTable.h>
 #include <Type/PhysicalDevice.h>
 #include <Type/Surface.h>
 #include <Type/DebugReportCallback.h>
@@ -175,17 +177,25 @@ public:
     explicit Instance(const InstanceInfo& aInstanceInfo, const T& aAllocator = DefaultAllocator) noexcept
     {
         ThrowIfFailed(vkCreateInstance(&aInstanceInfo, &aAllocator, &mInstance));
+
+#ifdef VKPP_USE_DISPATCH_TABLE
+        internal::InstanceDispatch.Load(mInstance);
+#endif
     }
 
     ~Instance(void)
     {
-        vkDestroyInstance(mInstance, nullptr);          // TODO: Support allocator.
+        VKPP_INSTANCE_PROC(vkDestroyInstance)(mInstance, nullptr);          // TODO: Support allocator.
     }
 
     template <typename T = DefaultAllocationCallbacks>
     void Reset(const InstanceInfo& aInstanceInfo, const T& aAllocator = DefaultAllocator)
     {
         ThrowIfFailed(vkCreateInstance(&aInstanceInfo, &aAllocator, &mInstance));
+
+#ifdef VKPP_USE_DISPATCH_TABLE
+        internal::InstanceDispatch.Load(mInstance);
+#endif
     }
 
     Instance& operator=(VkInstance aInstance) noexcept
@@ -215,15 +225,40 @@ public:
     std::vector<PhysicalDevice> GetPhysicalDevices(void) const
     {
         uint32_t lPhysicalDeviceCount{ 0 };
-        ThrowIfFailed(vkEnumeratePhysicalDevices(mInstance, &lPhysicalDeviceCount, nullptr));
+        ThrowIfFailed(VKPP_INSTANCE_PROC(vkEnumeratePhysicalDevices)(mInstance, &lPhysicalDeviceCount, nullptr));
         assert(lPhysicalDeviceCount != 0);
 
         std::vector<PhysicalDevice> lPhysicalDevices(lPhysicalDeviceCount);
-        ThrowIfFailed(vkEnumeratePhysicalDevices(mInstance, &lPhysicalDeviceCount, &lPhysicalDevices[0]));
+        ThrowIfFailed(VKPP_INSTANCE_PROC(vkEnumeratePhysicalDevices)(mInstance, &lPhysicalDeviceCount, &lPhysicalDevices[0]));
 
         return lPhysicalDevices;
     }
 
+    // Write up to aPhysicalDeviceCount devices into the caller's storage and set aPhysicalDeviceCount to the number written.
+    // Return VK_INCOMPLETE instead of throwing when there are more devices than room.
+    VkResult GetPhysicalDevices(uint32_t& aPhysicalDeviceCount, PhysicalDevice* apPhysicalDevices) const
+    {
+        assert(apPhysicalDevices != nullptr);
+
+        const auto lResult = VKPP_INSTANCE_PROC(vkEnumeratePhysicalDevices)(mInstance, &aPhysicalDeviceCount, &apPhysicalDevices[0]);
+
+        if (lResult != VK_INCOMPLETE)
+            ThrowIfFailed(lResult);
+
+        return lResult;
+    }
+
+    template <std::size_t N>
+    VkResult GetPhysicalDevices(FixedVector<PhysicalDevice, N>& aPhysicalDevices) const
+    {
+        auto lPhysicalDeviceCount = static_cast<uint32_t>(N);
+        const auto lResult = GetPhysicalDevices(lPhysicalDeviceCount, aPhysicalDevices.data());
+
+        aPhysicalDevices.resize(lPhysicalDeviceCount);
+
+        return lResult;
+    }
+
     static std::vector<LayerProperty> GetLayers(void)
     {
         uint32_t lLayerCount{ 0 };
@@ -236,6 +271,29 @@ public:
         return lLayers;
     }
 
+    static VkResult GetLayers(uint32_t& aLayerCount, LayerProperty* apLayers)
+    {
+        assert(apLayers != nullptr);
+
+        const auto lResult = vkEnumerateInstanceLayerProperties(&aLayerCount, &apLayers[0]);
+
+        if (lResult != VK_INCOMPLETE)
+            ThrowIfFailed(lResult);
+
+        return lResult;
+    }
+
+    template <std::size_t N>
+    static VkResult GetLayers(FixedVector<LayerProperty, N>& aLayers)
+    {
+        auto lLayerCount = static_cast<uint32_t>(N);
+        const auto lResult = GetLayers(lLayerCount, aLayers.data());
+
+        aLayers.resize(lLayerCount);
+
+        return lResult;
+    }
+
     static std::vector<ExtensionProperty> GetExtensions(const char* apLayerName = nullptr)
     {
         uint32_t lExtensionCount{ 0 };
@@ -248,6 +306,29 @@ public:
         return lExtensions;
     }
 
+    static VkResult GetExtensions(uint32_t& aExtensionCount, ExtensionProperty* apExtensions, const char* apLayerName = nullptr)
+    {
+        assert(apExtensions != nullptr);
+
+        const auto lResult = vkEnumerateInstanceExtensionProperties(apLayerName, &aExtensionCount, &apExtensions[0]);
+
+        if (lResult != VK_INCOMPLETE)
+            ThrowIfFailed(lResult);
+
+        return lResult;
+    }
+
+    template <std::size_t N>
+    static VkResult GetExtensions(FixedVector<ExtensionProperty, N>& aExtensions, const char* apLayerName = nullptr)
+    {
+        auto lExtensionCount = static_cast<uint32_t>(N);
+        const auto lResult = GetExtensions(lExtensionCount, aExtensions.data(), apLayerName);
+
+        aExtensions.resize(lExtensionCount);
+
+        return lResult;
+    }
+
     template <typename T = DefaultAllocationCallbacks>
     khr::Surface CreateSurface(const khr::SurfaceCreateInfo& aCreateInfo, const T& aAllocator = DefaultAllocator) const
     {
@@ -260,14 +341,14 @@ public:
     template <typename T = DefaultAllocationCallbacks>
     void DestroySurface(khr::Surface aSurface, const T& aAllocator = DefaultAllocator) const
     {
-        vkDestroySurfaceKHR(mInstance, aSurface, &aAllocator);
+        VKPP_INSTANCE_PROC(vkDestroySurfaceKHR)(mInstance, aSurface, &aAllocator);
     }
 
 #ifdef _DEBUG
 
     ext::DebugReportCallback CreateDebugReportCallback(const ext::DebugReportCallbackCreateInfo& aDebugReportCallbackInfo) const
     {
-        auto lpFunc = reinterpret_cast<PFN_vkCreateDebugReportCallbackEXT>(vkGetInstanceProcAddr(mInstance, "vkCreateDebugReportCallbackEXT"));
+        auto lpFunc = VKPP_GET_INSTANCE_PROC_ADDR(mInstance, vkCreateDebugReportCallbackEXT);
 
         ext::DebugReportCallback lDebugReportCallback;
         ThrowIfFailed(lpFunc(mInstance, &aDebugReportCallbackInfo, nullptr, &lDebugReportCallback));
@@ -277,7 +358,7 @@ public:
 
     void DestroyDebugReportCallback(const ext::DebugReportCallback& aDebugReportCallback) const
     {
-        auto lpFunc = reinterpret_cast<PFN_vkDestroyDebugReportCallbackEXT>(vkGetInstanceProcAddr(mInstance, "vkDestroyDebugReportCallbackEXT"));
+        auto lpFunc = VKPP_GET_INSTANCE_PROC_ADDR(mInstance, vkDestroyDebugReportCallbackEXT);
         lpFunc(mInstance, aDebugReportCallback, nullptr);
     }
 
@@ -7,11 +7,13 @@
 #include <fstream>
 
 #include <Info/Common.h>
+#include <Info/FixedVector.h>
 #include <Info/CommandBufferAllocateInfo.h>
 #include <Info/PipelineStage.h>
 #include <Info/PhysicalDeviceFeatures.h>
 #include <Info/MemoryRequirements.h>
 
+#include <Type/DispatchTable.h>
 #include <Type/PhysicalDevice.h>
 #include <Type/AllocationCallbacks.h>
 #include <Type/Queue.h>
@@ -29,6 +31,8 @@
 #include <Type/Memory.h>
 #include <Type/Buffer.h>
 #include <Type/DescriptorPool.h>
+#include <Type/DescriptorUpdateTemplate.h>
+#include <Type/UniqueHandle.h>
 
 
 
@@ -253,20 +257,34 @@ public:
     template <typename T = DefaultAllocationCallbacks>
     void Reset(const T& aAllocator = DefaultAllocator)
     {
-        vkDestroyDevice(mDevice, &aAllocator);
+        internal::DeviceExtensions.Unload(mDevice);
+
+        VKPP_DEVICE_PROC(vkDestroyDevice)(mDevice, &aAllocator);
+
+#ifdef VKPP_USE_DISPATCH_TABLE
+        if (internal::DeviceDispatch.device == mDevice)
+            internal::DeviceDispatch.Unload();
+#endif
+
         mDevice = VK_NULL_HANDLE;
     }
 
     template <typename T = DefaultAllocationCallbacks>
     void Reset(const PhysicalDevice& aPhysicalDevice, const LogicalDeviceCreateInfo& aLogicalDeviceCreateInfo, const T& aAllocator = DefaultAllocator)
     {
-        ThrowIfFailed(vkCreateDevice(aPhysicalDevice, &aLogicalDeviceCreateInfo, &aAllocator, &mDevice));
+        ThrowIfFailed(VKPP_INSTANCE_PROC(vkCreateDevice)(aPhysicalDevice, &aLogicalDeviceCreateInfo, &aAllocator, &mDevice));
+
+#ifdef VKPP_USE_DISPATCH_TABLE
+        internal::DeviceDispatch.Load(mDevice);
+#endif
+
+        internal::DeviceExtensions.Load(mDevice);
     }
 
     Queue GetQueue(uint32_t aQueueFamilyIndex, uint32_t aQueueIndex) const
     {
         Queue lQueue;
-        vkGetDeviceQueue(mDevice, aQueueFamilyIndex, aQueueIndex, &lQueue);
+        VKPP_DEVICE_PROC(vkGetDeviceQueue)(mDevice, aQueueFamilyIndex, aQueueIndex, &lQueue);
 
         return lQueue;
     }
@@ -274,7 +292,7 @@ public:
     MemoryRequirements GetBufferMemoryRequirements(const Buffer& aBuffer) const
     {
         MemoryRequirements lMemoryRequirements;
-        vkGetBufferMemoryRequirements(mDevice, aBuffer, &lMemoryRequirements);
+        VKPP_DEVICE_PROC(vkGetBufferMemoryRequirements)(mDevice, aBuffer, &lMemoryRequirements);
 
         return lMemoryRequirements;
     }
@@ -282,7 +300,7 @@ public:
     MemoryRequirements GetImageMemoryRequirements(const Image& aImage) const
     {
         MemoryRequirements lMemoryRequirements;
-        vkGetImageMemoryRequirements(mDevice, aImage, &lMemoryRequirements);
+        VKPP_DEVICE_PROC(vkGetImageMemoryRequirements)(mDevice, aImage, &lMemoryRequirements);
 
         return lMemoryRequirements;
     }
@@ -291,7 +309,7 @@ public:
     Semaphore CreateSemaphore(const SemaphoreCreateInfo& aSemaphoreCreateInfo, const T& aAllocator = DefaultAllocator) const
     {
         Semaphore lSemaphore;
-        ThrowIfFailed(vkCreateSemaphore(mDevice, &aSemaphoreCreateInfo, &aAllocator, &lSemaphore));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkCreateSemaphore)(mDevice, &aSemaphoreCreateInfo, &aAllocator, &lSemaphore));
 
         return lSemaphore;
     }
@@ -299,14 +317,14 @@ public:
     template <typename T = DefaultAllocationCallbacks>
     void DestroySemaphore(const Semaphore& aSemaphore, const T& aAllocator = DefaultAllocator) const
     {
-        vkDestroySemaphore(mDevice, aSemaphore, &aAllocator);
+        VKPP_DEVICE_PROC(vkDestroySemaphore)(mDevice, aSemaphore, &aAllocator);
     }
 
     template <typename T = DefaultAllocationCallbacks>
     Fence CreateFence(const FenceCreateInfo& aFenceCreateInfo, const T& aAllocator = DefaultAllocator) const
     {
         Fence lFence;
-        ThrowIfFailed(vkCreateFence(mDevice, &aFenceCreateInfo, &aAllocator, &lFence));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkCreateFence)(mDevice, &aFenceCreateInfo, &aAllocator, &lFence));
 
         return lFence;
     }
@@ -314,32 +332,32 @@ public:
     template <typename T = DefaultAllocationCallbacks>
     void DestroyFence(const Fence& aFence, const T& aAllocator = DefaultAllocator) const
     {
-        vkDestroyFence(mDevice, aFence, &aAllocator);
+        VKPP_DEVICE_PROC(vkDestroyFence)(mDevice, aFence, &aAllocator);
     }
 
     template <typename C, typename T = DefaultAllocationCallbacks>
     void DestroyFences(C&& aFences, const T& aAllocator = DefaultAllocator) const
     {
         for (auto& lFence : aFences)
-            vkDestroyFence(mDevice, lFence, &aAllocator);
+            VKPP_DEVICE_PROC(vkDestroyFence)(mDevice, lFence, &aAllocator);
     }
 
     VkResult GetFenceStatus(const Fence& aFence) const
     {
-        return vkGetFenceStatus(mDevice, aFence);
+        return VKPP_DEVICE_PROC(vkGetFenceStatus)(mDevice, aFence);
     }
 
     // Set the state of fence(s) to unsignaled from the host.
     void ResetFence(const Fence& apFences) const
     {
-        ThrowIfFailed(vkResetFences(mDevice, 1, &apFences));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkResetFences)(mDevice, 1, &apFences));
     }
 
     void ResetFences(uint32_t aFenceCount, const Fence* apFences) const
     {
         assert(aFenceCount != 0 && apFences != nullptr);
 
-        ThrowIfFailed(vkResetFences(mDevice, aFenceCount, &apFences[0]));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkResetFences)(mDevice, aFenceCount, &apFences[0]));
     }
 
     template <typename T, typename = EnableIfValueType<ValueType<T>, Fence>>
@@ -355,14 +373,14 @@ public:
 
     void WaitForFence(const Fence& aFence, bool aWaitAll = false, uint64_t aTimeout = DefaultFenceTimeOut) const
     {
-        ThrowIfFailed(vkWaitForFences(mDevice, 1, &aFence, aWaitAll, aTimeout));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkWaitForFences)(mDevice, 1, &aFence, aWaitAll, aTimeout));
     }
 
     void WaitForFences(uint32_t aFenceCount, const Fence* apFences, bool aWaitAll = false, uint64_t aTimeout = DefaultFenceTimeOut) const
     {
         assert(aFenceCount != 0 && apFences != nullptr);
 
-        ThrowIfFailed(vkWaitForFences(mDevice, aFenceCount, &apFences[0], aWaitAll, aTimeout));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkWaitForFences)(mDevice, aFenceCount, &apFences[0], aWaitAll, aTimeout));
     }
 
     template <typename T, typename = EnableIfValueType<ValueType<T>, Fence>>
@@ -376,11 +394,48 @@ public:
         return WaitForFences(SizeOf<uint32_t>(aFences), DataOf(aFences), aWaitAll, aTimeout);
     }
 
+    template <typename T = DefaultAllocationCallbacks>
+    QueryPool CreateQueryPool(const QueryPoolCreateInfo& aQueryPoolCreateInfo, const T& aAllocator = DefaultAllocator) const
+    {
+        QueryPool lQueryPool;
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkCreateQueryPool)(mDevice, &aQueryPoolCreateInfo, &aAllocator, &lQueryPool));
+
+        return lQueryPool;
+    }
+
+    template <typename T = DefaultAllocationCallbacks>
+    void DestroyQueryPool(const QueryPool& aQueryPool, const T& aAllocator = DefaultAllocator) const
+    {
+        VKPP_DEVICE_PROC(vkDestroyQueryPool)(mDevice, aQueryPool, &aAllocator);
+    }
+
+    // Return VK_NOT_READY instead of throwing when some of the queries are not available yet and QueryResultFlagBits::eWait is not set.
+    VkResult GetQueryPoolResults(const QueryPool& aQueryPool, uint32_t aFirstQuery, uint32_t aQueryCount, std::size_t aDataSize, void* apData, DeviceSize aStride,
+        const QueryResultFlags& aFlags = DefaultFlags) const
+    {
+        assert(aDataSize != 0 && apData != nullptr);
+
+        const auto lResult = VKPP_DEVICE_PROC(vkGetQueryPoolResults)(mDevice, aQueryPool, aFirstQuery, aQueryCount, aDataSize, apData, aStride, aFlags);
+
+        if (lResult != VK_NOT_READY)
+            ThrowIfFailed(lResult);
+
+        return lResult;
+    }
+
+    // One 64-bit result per query, tightly packed.
+    template <typename T, typename = EnableIfValueType<ValueType<T>, uint64_t>>
+    VkResult GetQueryPoolResults(const QueryPool& aQueryPool, uint32_t aFirstQuery, T&& aResults, const QueryResultFlags& aFlags = DefaultFlags) const
+    {
+        return GetQueryPoolResults(aQueryPool, aFirstQuery, SizeOf<uint32_t>(aResults), aResults.size() * sizeof(uint64_t), DataOf(aResults), sizeof(uint64_t),
+            aFlags | QueryResultFlagBits::e64);
+    }
+
     template <typename T = DefaultAllocationCallbacks>
     khr::Swapchain CreateSwapchain(const khr::SwapchainCreateInfo& aSwapchainCreateInfo, const T& aAllocator = DefaultAllocator) const
     {
         khr::Swapchain lSwapchain;
-        ThrowIfFailed(vkCreateSwapchainKHR(mDevice, &aSwapchainCreateInfo, &aAllocator, &lSwapchain));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkCreateSwapchainKHR)(mDevice, &aSwapchainCreateInfo, &aAllocator, &lSwapchain));
 
         return lSwapchain;
     }
@@ -388,26 +443,50 @@ public:
     template <typename T = DefaultAllocationCallbacks>
     void DestroySwapchain(const khr::Swapchain& aSwapchain, const T& aAllocator = DefaultAllocator) const
     {
-        vkDestroySwapchainKHR(mDevice, aSwapchain, &aAllocator);
+        VKPP_DEVICE_PROC(vkDestroySwapchainKHR)(mDevice, aSwapchain, &aAllocator);
     }
 
     std::vector<Image> GetSwapchainImages(const khr::Swapchain& aSwapchain) const
     {
         uint32_t lSwapchainImageCount{ 0 };
-        ThrowIfFailed(vkGetSwapchainImagesKHR(mDevice, aSwapchain, &lSwapchainImageCount, nullptr));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkGetSwapchainImagesKHR)(mDevice, aSwapchain, &lSwapchainImageCount, nullptr));
 
         std::vector<Image> lSwapchainImages(lSwapchainImageCount);
-        ThrowIfFailed(vkGetSwapchainImagesKHR(mDevice, aSwapchain, &lSwapchainImageCount, &lSwapchainImages[0]));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkGetSwapchainImagesKHR)(mDevice, aSwapchain, &lSwapchainImageCount, &lSwapchainImages[0]));
 
         return lSwapchainImages;
     }
 
+    // Return VK_INCOMPLETE instead of throwing when the swapchain has more images than aSwapchainImageCount.
+    VkResult GetSwapchainImages(const khr::Swapchain& aSwapchain, uint32_t& aSwapchainImageCount, Image* apSwapchainImages) const
+    {
+        assert(apSwapchainImages != nullptr);
+
+        const auto lResult = VKPP_DEVICE_PROC(vkGetSwapchainImagesKHR)(mDevice, aSwapchain, &aSwapchainImageCount, &apSwapchainImages[0]);
+
+        if (lResult != VK_INCOMPLETE)
+            ThrowIfFailed(lResult);
+
+        return lResult;
+    }
+
+    template <std::size_t N>
+    VkResult GetSwapchainImages(const khr::Swapchain& aSwapchain, FixedVector<Image, N>& aSwapchainImages) const
+    {
+        auto lSwapchainImageCount = static_cast<uint32_t>(N);
+        const auto lResult = GetSwapchainImages(aSwapchain, lSwapchainImageCount, aSwapchainImages.data());
+
+        aSwapchainImages.resize(lSwapchainImageCount);
+
+        return lResult;
+    }
+
     // \param[in] aSemaphore is null or a semaphore to signal.
     uint32_t AcquireNextImage(const khr::Swapchain& aSwapchain, const Semaphore& aSemaphore = nullptr, const Fence& aFence = nullptr, uint64_t aTimeout = DefaultSwapchainAcquireTimeOut) const
     {
         uint32_t lImageIndex;
         // TODO: Error handling.
-        ThrowIfFailed(vkAcquireNextImageKHR(mDevice, aSwapchain, aTimeout, aSemaphore, aFence, &lImageIndex));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkAcquireNextImageKHR)(mDevice, aSwapchain, aTimeout, aSemaphore, aFence, &lImageIndex));
 
         return lImageIndex;
     }
@@ -416,7 +495,7 @@ public:
     CommandPool CreateCommandPool(const CommandPoolCreateInfo& aCommandPoolCreateInfo, const T& aAllocator = DefaultAllocator) const
     {
         CommandPool lCommandPool;
-        ThrowIfFailed(vkCreateCommandPool(mDevice, &aCommandPoolCreateInfo, &aAllocator, &lCommandPool));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkCreateCommandPool)(mDevice, &aCommandPoolCreateInfo, &aAllocator, &lCommandPool));
 
         return lCommandPool;
     }
@@ -424,12 +503,12 @@ public:
     template <typename T = DefaultAllocationCallbacks>
     void DestroyCommandPool(const CommandPool& aCommandPool, const T& aAllocator = DefaultAllocator) const
     {
-        vkDestroyCommandPool(mDevice, aCommandPool, &aAllocator);
+        VKPP_DEVICE_PROC(vkDestroyCommandPool)(mDevice, aCommandPool, &aAllocator);
     }
 
     void ResetCommandPool(const CommandPool& aCommandPool, const CommandPoolResetFlags& aFlags = DefaultFlags) const
     {
-        ThrowIfFailed(vkResetCommandPool(mDevice, aCommandPool, static_cast<VkCommandPoolResetFlags>(aFlags)));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkResetCommandPool)(mDevice, aCommandPool, static_cast<VkCommandPoolResetFlags>(aFlags)));
     }
 
     CommandBuffer AllocateCommandBuffer(const CommandBufferAllocateInfo& aCommandBufferAllocateInfo) const
@@ -437,7 +516,7 @@ public:
         assert(aCommandBufferAllocateInfo.commandBufferCount == 1);
 
         CommandBuffer lCommandBuffer;
-        ThrowIfFailed(vkAllocateCommandBuffers(mDevice, &aCommandBufferAllocateInfo, &lCommandBuffer));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkAllocateCommandBuffers)(mDevice, &aCommandBufferAllocateInfo, &lCommandBuffer));
 
         return lCommandBuffer;
     }
@@ -447,7 +526,7 @@ public:
         assert(aCommandBufferAllocateInfo.commandBufferCount > 0U);
 
         std::vector<CommandBuffer> lCommandBuffers(aCommandBufferAllocateInfo.commandBufferCount);
-        ThrowIfFailed(vkAllocateCommandBuffers(mDevice, &aCommandBufferAllocateInfo, &lCommandBuffers[0]));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkAllocateCommandBuffers)(mDevice, &aCommandBufferAllocateInfo, &lCommandBuffers[0]));
 
         return lCommandBuffers;
     }
@@ -456,14 +535,14 @@ public:
     {
         assert(aCommandBuffer);
 
-        vkFreeCommandBuffers(mDevice, aCommandPool, 1, &aCommandBuffer);
+        VKPP_DEVICE_PROC(vkFreeCommandBuffers)(mDevice, aCommandPool, 1, &aCommandBuffer);
     }
 
     void FreeCommandBuffers(const CommandPool& aCommandPool, uint32_t aCommandBufferCount, const CommandBuffer* apCmdBuffers) const
     {
         assert(aCommandBufferCount != 0 && apCmdBuffers != nullptr);
 
-        vkFreeCommandBuffers(mDevice, aCommandPool, aCommandBufferCount, &apCmdBuffers[0]);
+        VKPP_DEVICE_PROC(vkFreeCommandBuffers)(mDevice, aCommandPool, aCommandBufferCount, &apCmdBuffers[0]);
     }
 
     template <typename T, typename = EnableIfValueType<ValueType<T>, CommandBuffer>>
@@ -481,7 +560,7 @@ public:
     DescriptorPool CreateDescriptorPool(const DescriptorPoolCreateInfo& aDescriptorPoolCreateInfo, const T& aAllocator = DefaultAllocator) const
     {
         DescriptorPool lDescriptorPool;
-        ThrowIfFailed(vkCreateDescriptorPool(mDevice, &aDescriptorPoolCreateInfo, &aAllocator, &lDescriptorPool));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkCreateDescriptorPool)(mDevice, &aDescriptorPoolCreateInfo, &aAllocator, &lDescriptorPool));
 
         return lDescriptorPool;
     }
@@ -489,12 +568,12 @@ public:
     template <typename T = DefaultAllocationCallbacks>
     void DestroyDescriptorPool(const DescriptorPool& aDescriptorPool, const T& aAllocator = DefaultAllocator) const
     {
-        vkDestroyDescriptorPool(mDevice, aDescriptorPool, &aAllocator);
+        VKPP_DEVICE_PROC(vkDestroyDescriptorPool)(mDevice, aDescriptorPool, &aAllocator);
     }
 
     void ResetDescriptorPool(const DescriptorPool& aDescriptorPool, const DescriptorPoolResetFlags& aFlags = DefaultFlags) const
     {
-        ThrowIfFailed(vkResetDescriptorPool(mDevice, aDescriptorPool, aFlags));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkResetDescriptorPool)(mDevice, aDescriptorPool, aFlags));
     }
 
     DescriptorSet AllocateDescriptorSet(const DescriptorSetAllocateInfo& aDescriptorSetAllocateInfo) const
@@ -502,7 +581,7 @@ public:
         assert(aDescriptorSetAllocateInfo.descriptorSetCount == 1);
 
         DescriptorSet lDescriptorSet;
-        ThrowIfFailed(vkAllocateDescriptorSets(mDevice, &aDescriptorSetAllocateInfo, &lDescriptorSet));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkAllocateDescriptorSets)(mDevice, &aDescriptorSetAllocateInfo, &lDescriptorSet));
 
         return lDescriptorSet;
     }
@@ -512,7 +591,7 @@ public:
         assert(aDescriptorSetAllocateInfo.descriptorSetCount != 0);
 
         std::vector<DescriptorSet> lDescriptorSets(aDescriptorSetAllocateInfo.descriptorSetCount);
-        ThrowIfFailed(vkAllocateDescriptorSets(mDevice, &aDescriptorSetAllocateInfo, &lDescriptorSets[0]));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkAllocateDescriptorSets)(mDevice, &aDescriptorSetAllocateInfo, &lDescriptorSets[0]));
 
         return lDescriptorSets;
     }
@@ -521,7 +600,7 @@ public:
     {
         assert(aDescriptorPool);
 
-        vkFreeDescriptorSets(mDevice, aDescriptorPool, 1, &aDescriptorSet);
+        VKPP_DEVICE_PROC(vkFreeDescriptorSets)(mDevice, aDescriptorPool, 1, &aDescriptorSet);
     }
 
     void FreeDescriptorSets(const DescriptorPool& aDescriptorPool, uint32_t aDescriptorSetCount, const DescriptorSet* apDescriptorSets) const
@@ -529,7 +608,7 @@ public:
         assert(aDescriptorPool);
         assert(aDescriptorSetCount != 0 && apDescriptorSets != nullptr);
 
-        vkFreeDescriptorSets(mDevice, aDescriptorPool, aDescriptorSetCount, &apDescriptorSets[0]);
+        VKPP_DEVICE_PROC(vkFreeDescriptorSets)(mDevice, aDescriptorPool, aDescriptorSetCount, &apDescriptorSets[0]);
     }
 
     template <typename T, typename = EnableIfValueType<ValueType<T>, DescriptorSet>>
@@ -557,21 +636,21 @@ public:
     {
         assert((aDescriptorWriteCount != 0 && apDescriptorWrites != nullptr) || (aDescriptorCopyCount != 0 && apDescriptorCopies != nullptr));
 
-        vkUpdateDescriptorSets(mDevice, aDescriptorWriteCount, &apDescriptorWrites[0], aDescriptorCopyCount, &apDescriptorCopies[0]);
+        VKPP_DEVICE_PROC(vkUpdateDescriptorSets)(mDevice, aDescriptorWriteCount, &apDescriptorWrites[0], aDescriptorCopyCount, &apDescriptorCopies[0]);
     }
 
     void UpdateDescriptorSets(uint32_t aDescriptorWriteCount, const WriteDescriptorSetInfo* apDescriptorWrites) const
     {
         assert(aDescriptorWriteCount != 0 && apDescriptorWrites != nullptr);
 
-        vkUpdateDescriptorSets(mDevice, aDescriptorWriteCount, &apDescriptorWrites[0], 0, nullptr);
+        VKPP_DEVICE_PROC(vkUpdateDescriptorSets)(mDevice, aDescriptorWriteCount, &apDescriptorWrites[0], 0, nullptr);
     }
 
     void UpdateDescriptorSets(uint32_t aDescriptorCopyCount, const CopyDescriptorSetInfo* apDescriptorCopies) const
     {
         assert(aDescriptorCopyCount != 0 && apDescriptorCopies != nullptr);
 
-        vkUpdateDescriptorSets(mDevice, 0, nullptr, aDescriptorCopyCount, &apDescriptorCopies[0]);
+        VKPP_DEVICE_PROC(vkUpdateDescriptorSets)(mDevice, 0, nullptr, aDescriptorCopyCount, &apDescriptorCopies[0]);
     }
 
     template <typename W, typename C, typename = EnableIfValueType<ValueType<W>, WriteDescriptorSetInfo, ValueType<C>, CopyDescriptorSetInfo>>
@@ -607,11 +686,82 @@ public:
         UpdateDescriptorSets(0, nullptr, SizeOf<uint32_t>(aDescriptorCopies), DataOf(aDescriptorCopies));
     }
 
+    // The descriptor update template functions require VK_KHR_descriptor_update_template to be enabled on the device.
+    template <typename T = DefaultAllocationCallbacks>
+    khr::DescriptorUpdateTemplate CreateDescriptorUpdateTemplate(const khr::DescriptorUpdateTemplateCreateInfo& aDescriptorUpdateTemplateCreateInfo,
+        const T& aAllocator = DefaultAllocator) const
+    {
+        auto lpFunc = VKPP_GET_DEVICE_PROC_ADDR(mDevice, vkCreateDescriptorUpdateTemplateKHR);
+        assert(lpFunc != nullptr);
+
+        khr::DescriptorUpdateTemplate lDescriptorUpdateTemplate;
+        ThrowIfFailed(lpFunc(mDevice, &aDescriptorUpdateTemplateCreateInfo, &aAllocator, &lDescriptorUpdateTemplate));
+
+        return lDescriptorUpdateTemplate;
+    }
+
+    template <typename T = DefaultAllocationCallbacks>
+    void DestroyDescriptorUpdateTemplate(const khr::DescriptorUpdateTemplate& aDescriptorUpdateTemplate, const T& aAllocator = DefaultAllocator) const
+    {
+        auto lpFunc = VKPP_GET_DEVICE_PROC_ADDR(mDevice, vkDestroyDescriptorUpdateTemplateKHR);
+        assert(lpFunc != nullptr);
+
+        lpFunc(mDevice, aDescriptorUpdateTemplate, &aAllocator);
+    }
+
+    // apData is read as described by the template entries, e.g. khr::DescriptorTemplateData::GetData.
+    void UpdateDescriptorSetWithTemplate(const DescriptorSet& aDescriptorSet, const khr::DescriptorUpdateTemplate& aDescriptorUpdateTemplate, const void* apData) const
+    {
+        assert(apData != nullptr);
+
+        auto lpFunc = VKPP_GET_DEVICE_PROC_ADDR(mDevice, vkUpdateDescriptorSetWithTemplateKHR);
+        assert(lpFunc != nullptr);
+
+        lpFunc(mDevice, aDescriptorSet, aDescriptorUpdateTemplate, apData);
+    }
+
+    // Record into aCommandBuffer the push of the descriptors of a khr::DescriptorUpdateTemplateType::ePushDescriptors template; requires VK_KHR_push_descriptor.
+    // Lives here rather than in CommandBuffer since the entry point has to be fetched from the device.
+    void PushDescriptorSetWithTemplate(const CommandBuffer& aCommandBuffer, const khr::DescriptorUpdateTemplate& aDescriptorUpdateTemplate,
+        const PipelineLayout& aPipelineLayout, uint32_t aSet, const void* apData) const
+    {
+        assert(apData != nullptr);
+
+        auto lpFunc = VKPP_GET_DEVICE_PROC_ADDR(mDevice, vkCmdPushDescriptorSetWithTemplateKHR);
+        assert(lpFunc != nullptr);
+
+        lpFunc(aCommandBuffer, aDescriptorUpdateTemplate, aPipelineLayout, aSet, apData);
+    }
+
+    // Record into aCommandBuffer an indirect draw whose draw count, capped at aMaxDrawCount, is read by the device from aCountBuffer at aCountOffset.
+    // Requires VK_KHR_draw_indirect_count; offsets and stride follow CommandBuffer::DrawIndirect.
+    void DrawIndirectCount(const CommandBuffer& aCommandBuffer, const Buffer& aBuffer, DeviceSize aOffset, const Buffer& aCountBuffer, DeviceSize aCountOffset,
+        uint32_t aMaxDrawCount, uint32_t aStride = sizeof(DrawIndirectCommand)) const
+    {
+        assert(aOffset % 4 == 0 && aCountOffset % 4 == 0 && aStride % 4 == 0 && aStride >= sizeof(DrawIndirectCommand));
+
+        auto lpFunc = VKPP_GET_DEVICE_PROC_ADDR(mDevice, vkCmdDrawIndirectCountKHR);
+        assert(lpFunc != nullptr);
+
+        lpFunc(aCommandBuffer, aBuffer, aOffset, aCountBuffer, aCountOffset, aMaxDrawCount, aStride);
+    }
+
+    void DrawIndexedIndirectCount(const CommandBuffer& aCommandBuffer, const Buffer& aBuffer, DeviceSize aOffset, const Buffer& aCountBuffer, DeviceSize aCountOffset,
+        uint32_t aMaxDrawCount, uint32_t aStride = sizeof(DrawIndexedIndirectCommand)) const
+    {
+        assert(aOffset % 4 == 0 && aCountOffset % 4 == 0 && aStride % 4 == 0 && aStride >= sizeof(DrawIndexedIndirectCommand));
+
+        auto lpFunc = VKPP_GET_DEVICE_PROC_ADDR(mDevice, vkCmdDrawIndexedIndirectCountKHR);
+        assert(lpFunc != nullptr);
+
+        lpFunc(aCommandBuffer, aBuffer, aOffset, aCountBuffer, aCountOffset, aMaxDrawCount, aStride);
+    }
+
     template <typename T = DefaultAllocationCallbacks>
     RenderPass CreateRenderPass(const RenderPassCreateInfo& aRenderPassCreateInfo, const T& aAllocator = DefaultAllocator) const
     {
         RenderPass lRenderPass;
-        ThrowIfFailed(vkCreateRenderPass(mDevice, &aRenderPassCreateInfo, &aAllocator, &lRenderPass));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkCreateRenderPass)(mDevice, &aRenderPassCreateInfo, &aAllocator, &lRenderPass));
 
         return lRenderPass;
     }
@@ -619,14 +769,14 @@ public:
     template <typename T = DefaultAllocationCallbacks>
     void DestroyRenderPass(const RenderPass& aRenderPass, const T& aAllocator = DefaultAllocator) const
     {
-        vkDestroyRenderPass(mDevice, aRenderPass, &aAllocator);
+        VKPP_DEVICE_PROC(vkDestroyRenderPass)(mDevice, aRenderPass, &aAllocator);
     }
 
     template <typename T = DefaultAllocationCallbacks>
     Buffer CreateBuffer(const BufferCreateInfo& aBufferCreateInfo, const T& aAllocator = DefaultAllocator) const
     {
         Buffer lBuffer;
-        ThrowIfFailed(vkCreateBuffer(mDevice, &aBufferCreateInfo, &aAllocator, &lBuffer));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkCreateBuffer)(mDevice, &aBufferCreateInfo, &aAllocator, &lBuffer));
 
         return lBuffer;
     }
@@ -634,7 +784,7 @@ public:
     template <typename T = DefaultAllocationCallbacks>
     void DestroyBuffer(const Buffer& aBuffer, const T& aAllocator = DefaultAllocator) const
     {
-        vkDestroyBuffer(mDevice, aBuffer, &aAllocator);
+        VKPP_DEVICE_PROC(vkDestroyBuffer)(mDevice, aBuffer, &aAllocator);
     }
 
     template <typename T = DefaultAllocationCallbacks>
@@ -643,7 +793,7 @@ public:
         assert(aBufferViewCreateInfo.buffer);
 
         BufferView lBufferView;
-        ThrowIfFailed(vkCreateBufferView(mDevice, &aBufferViewCreateInfo, &aAllocator, &lBufferView));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkCreateBufferView)(mDevice, &aBufferViewCreateInfo, &aAllocator, &lBufferView));
 
         return lBufferView;
     }
@@ -651,14 +801,14 @@ public:
     template <typename T = DefaultAllocationCallbacks>
     void DestroyBufferView(const BufferView& aBufferView, const T& aAllocator = DefaultAllocator) const
     {
-        vkDestroyBufferView(mDevice, aBufferView, &aAllocator);
+        VKPP_DEVICE_PROC(vkDestroyBufferView)(mDevice, aBufferView, &aAllocator);
     }
 
     template <typename T = DefaultAllocationCallbacks>
     Image CreateImage(const ImageCreateInfo& aImageCreateInfo, const T& aAllocator = DefaultAllocator) const
     {
         Image lImage;
-        ThrowIfFailed(vkCreateImage(mDevice, &aImageCreateInfo, &aAllocator, &lImage));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkCreateImage)(mDevice, &aImageCreateInfo, &aAllocator, &lImage));
 
         return lImage;
     }
@@ -668,7 +818,7 @@ public:
     {
         assert(aImage);
 
-        vkDestroyImage(mDevice, aImage, &aAllocator);
+        VKPP_DEVICE_PROC(vkDestroyImage)(mDevice, aImage, &aAllocator);
     }
 
     template <typename T = DefaultAllocationCallbacks>
@@ -677,7 +827,7 @@ public:
         assert(aImageViewCreateInfo.image);
 
         ImageView lImageView;
-        ThrowIfFailed(vkCreateImageView(mDevice, &aImageViewCreateInfo, &aAllocator, &lImageView));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkCreateImageView)(mDevice, &aImageViewCreateInfo, &aAllocator, &lImageView));
 
         return lImageView;
     }
@@ -685,13 +835,13 @@ public:
     template <typename T = DefaultAllocationCallbacks>
     void DestroyImageView(const ImageView& aImageView, const T& aAllocator = DefaultAllocator) const
     {
-        vkDestroyImageView(mDevice, aImageView, &aAllocator);
+        VKPP_DEVICE_PROC(vkDestroyImageView)(mDevice, aImageView, &aAllocator);
     }
 
     SubresourceLayout GetImageSubresourceLayout(const Image& aImage, const ImageSubresource& aSubresource) const
     {
         SubresourceLayout lSubresourceLayout;
-        vkGetImageSubresourceLayout(mDevice, aImage, &aSubresource, &lSubresourceLayout);
+        VKPP_DEVICE_PROC(vkGetImageSubresourceLayout)(mDevice, aImage, &aSubresource, &lSubresourceLayout);
 
         return lSubresourceLayout;
     }
@@ -700,7 +850,7 @@ public:
     Sampler CreateSampler(const SamplerCreateInfo& aSamplerCreateInfo, const T& aAllocator = DefaultAllocator) const
     {
         Sampler lSampler;
-        ThrowIfFailed(vkCreateSampler(mDevice, &aSamplerCreateInfo, &aAllocator, &lSampler));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkCreateSampler)(mDevice, &aSamplerCreateInfo, &aAllocator, &lSampler));
 
         return lSampler;
     }
@@ -708,14 +858,14 @@ public:
     template <typename T = DefaultAllocationCallbacks>
     void DestroySampler(const Sampler& aSampler, const T& aAllocator = DefaultAllocator) const
     {
-        vkDestroySampler(mDevice, aSampler, &aAllocator);
+        VKPP_DEVICE_PROC(vkDestroySampler)(mDevice, aSampler, &aAllocator);
     }
 
     template <typename T = DefaultAllocationCallbacks>
     Framebuffer CreateFramebuffer(const FramebufferCreateInfo& aFramebufferCreateInfo, const T& aAllocator = DefaultAllocator) const
     {
         Framebuffer lFramebuffer;
-        ThrowIfFailed(vkCreateFramebuffer(mDevice, &aFramebufferCreateInfo, &aAllocator, &lFramebuffer));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkCreateFramebuffer)(mDevice, &aFramebufferCreateInfo, &aAllocator, &lFramebuffer));
 
         return lFramebuffer;
     }
@@ -745,21 +895,21 @@ public:
     template <typename T = DefaultAllocationCallbacks>
     void DestroyFramebuffer(const Framebuffer& aFramebuffer, const T& aAllocator = DefaultAllocator) const
     {
-        vkDestroyFramebuffer(mDevice, aFramebuffer, &aAllocator);
+        VKPP_DEVICE_PROC(vkDestroyFramebuffer)(mDevice, aFramebuffer, &aAllocator);
     }
 
     template <typename C, typename T = DefaultAllocationCallbacks, typename = EnableIfValueType<ValueType<C>, Framebuffer>>
     void DestroyFramebuffers(C&& aFramebuffers, const T& aAllocator = DefaultAllocator) const
     {
         for (auto& lFramebuffer : aFramebuffers)
-            vkDestroyFramebuffer(mDevice, lFramebuffer, &aAllocator);
+            VKPP_DEVICE_PROC(vkDestroyFramebuffer)(mDevice, lFramebuffer, &aAllocator);
     }
 
     template <typename T = DefaultAllocationCallbacks>
     ShaderModule CreateShaderModule(const ShaderModuleCreateInfo& aShaderModuleCreateInfo, const T& aAllocator = DefaultAllocator) const
     {
         ShaderModule lShaderModule;
-        ThrowIfFailed(vkCreateShaderModule(mDevice, &aShaderModuleCreateInfo, &aAllocator, &lShaderModule));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkCreateShaderModule)(mDevice, &aShaderModuleCreateInfo, &aAllocator, &lShaderModule));
 
         return lShaderModule;
     }
@@ -779,14 +929,14 @@ public:
     template <typename T = DefaultAllocationCallbacks>
     void DestroyShaderModule(const ShaderModule& aShaderModule, const T& aAllocator = DefaultAllocator) const
     {
-        vkDestroyShaderModule(mDevice, aShaderModule, &aAllocator);
+        VKPP_DEVICE_PROC(vkDestroyShaderModule)(mDevice, aShaderModule, &aAllocator);
     }
 
     template <typename T = DefaultAllocationCallbacks>
     DescriptorSetLayout CreateDescriptorSetLayout(const DescriptorSetLayoutCreateInfo& aDescriptorSetLayoutCreateInfo, const T& aAllocator = DefaultAllocator) const
     {
         DescriptorSetLayout lDescriptorSetLayout;
-        ThrowIfFailed(vkCreateDescriptorSetLayout(mDevice, &aDescriptorSetLayoutCreateInfo, &aAllocator, &lDescriptorSetLayout));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkCreateDescriptorSetLayout)(mDevice, &aDescriptorSetLayoutCreateInfo, &aAllocator, &lDescriptorSetLayout));
 
         return lDescriptorSetLayout;
     }
@@ -794,14 +944,14 @@ public:
     template <typename T = DefaultAllocationCallbacks>
     void DestroyDescriptorSetLayout(const DescriptorSetLayout& aDescriptorSetLayout, const T& aAllocator = DefaultAllocator) const
     {
-        vkDestroyDescriptorSetLayout(mDevice, aDescriptorSetLayout, &aAllocator);
+        VKPP_DEVICE_PROC(vkDestroyDescriptorSetLayout)(mDevice, aDescriptorSetLayout, &aAllocator);
     }
 
     template <typename T = DefaultAllocationCallbacks>
     PipelineLayout CreatePipelineLayout(const PipelineLayoutCreateInfo& aPipelineLayoutCreateInfo, const T& aAllocator = DefaultAllocator) const
     {
         PipelineLayout lPipelineLayout;
-        ThrowIfFailed(vkCreatePipelineLayout(mDevice, &aPipelineLayoutCreateInfo, &aAllocator, &lPipelineLayout));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkCreatePipelineLayout)(mDevice, &aPipelineLayoutCreateInfo, &aAllocator, &lPipelineLayout));
 
         return lPipelineLayout;
     }
@@ -809,14 +959,14 @@ public:
     template <typename T = DefaultAllocationCallbacks>
     void DestroyPipelineLayout(const PipelineLayout& aPipelineLayout, const T& aAllocator = DefaultAllocator) const
     {
-        vkDestroyPipelineLayout(mDevice, aPipelineLayout, &aAllocator);
+        VKPP_DEVICE_PROC(vkDestroyPipelineLayout)(mDevice, aPipelineLayout, &aAllocator);
     }
 
     template <typename T = DefaultAllocationCallbacks>
     Pipeline CreateGraphicsPipeline(const GraphicsPipelineCreateInfo& aGraphicsPipelineCreateInfo, const PipelineCache& aPipelineCache = nullptr, const T& aAllocator = DefaultAllocator) const
     {
         Pipeline lPipeline;
-        ThrowIfFailed(vkCreateGraphicsPipelines(mDevice, aPipelineCache, 1, &aGraphicsPipelineCreateInfo, &aAllocator, &lPipeline));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkCreateGraphicsPipelines)(mDevice, aPipelineCache, 1, &aGraphicsPipelineCreateInfo, &aAllocator, &lPipeline));
 
         return lPipeline;
     }
@@ -828,22 +978,49 @@ public:
         assert(aCreateInfoCount > 0 && apGraphicsPipelineCraeteInfos != nullptr);
 
         std::vector<Pipeline> lPipelines(aCreateInfoCount);
-        ThrowIfFailed(vkCreateGraphicsPipelines(mDevice, aPipelineCache, aCreateInfoCount, &apGraphicsPipelineCraeteInfos[0], &aAllocator, &lPipelines[0]));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkCreateGraphicsPipelines)(mDevice, aPipelineCache, aCreateInfoCount, &apGraphicsPipelineCraeteInfos[0], &aAllocator, &lPipelines[0]));
+
+        return lPipelines;
+    }
+
+    template <typename T = DefaultAllocationCallbacks>
+    Pipeline CreateComputePipeline(const ComputePipelineCreateInfo& aComputePipelineCreateInfo, const PipelineCache& aPipelineCache = nullptr, const T& aAllocator = DefaultAllocator) const
+    {
+        Pipeline lPipeline;
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkCreateComputePipelines)(mDevice, aPipelineCache, 1, &aComputePipelineCreateInfo, &aAllocator, &lPipeline));
+
+        return lPipeline;
+    }
+
+    template <typename T = DefaultAllocationCallbacks>
+    std::vector<Pipeline> CreateComputePipelines(uint32_t aCreateInfoCount, const ComputePipelineCreateInfo* apComputePipelineCreateInfos,
+        const PipelineCache& aPipelineCache = nullptr, const T& aAllocator = DefaultAllocator) const
+    {
+        assert(aCreateInfoCount > 0 && apComputePipelineCreateInfos != nullptr);
+
+        std::vector<Pipeline> lPipelines(aCreateInfoCount);
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkCreateComputePipelines)(mDevice, aPipelineCache, aCreateInfoCount, &apComputePipelineCreateInfos[0], &aAllocator, &lPipelines[0]));
 
         return lPipelines;
     }
 
+    template <typename P, typename T = DefaultAllocationCallbacks, typename = EnableIfValueType<ValueType<P>, ComputePipelineCreateInfo>>
+    std::vector<Pipeline> CreateComputePipelines(P&& aComputePipelineCreateInfos, const PipelineCache& aPipelineCache = nullptr, const T& aAllocator = DefaultAllocator) const
+    {
+        return CreateComputePipelines(SizeOf<uint32_t>(aComputePipelineCreateInfos), DataOf(aComputePipelineCreateInfos), aPipelineCache, aAllocator);
+    }
+
     template <typename T = DefaultAllocationCallbacks>
     void DestroyPipeline(const Pipeline& aPipeline, const T& aAllocator = DefaultAllocator) const
     {
-        vkDestroyPipeline(mDevice, aPipeline, &aAllocator);
+        VKPP_DEVICE_PROC(vkDestroyPipeline)(mDevice, aPipeline, &aAllocator);
     }
 
     template <typename T = DefaultAllocationCallbacks>
     PipelineCache CreatePipelineCache(const PipelineCacheCreateInfo& aPipelineCacheCreateInfo, const T& aAllocator = DefaultAllocator) const
     {
         PipelineCache lPipelineCache;
-        ThrowIfFailed(vkCreatePipelineCache(mDevice, &aPipelineCacheCreateInfo, &aAllocator, &lPipelineCache));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkCreatePipelineCache)(mDevice, &aPipelineCacheCreateInfo, &aAllocator, &lPipelineCache));
 
         return lPipelineCache;
     }
@@ -851,7 +1028,7 @@ public:
     template <typename T = DefaultAllocationCallbacks>
     void DestroyPipelineCache(const PipelineCache& aPipelineCache, const T& aAllocator = DefaultAllocator) const
     {
-        vkDestroyPipelineCache(mDevice, aPipelineCache, &aAllocator);
+        VKPP_DEVICE_PROC(vkDestroyPipelineCache)(mDevice, aPipelineCache, &aAllocator);
     }
 
     const PipelineCache& MergePipelineCaches(const PipelineCache& aDstCache, uint32_t aSrcCacheCount, const PipelineCache* apSrcCaches) const
@@ -859,7 +1036,7 @@ public:
         assert(aDstCache);
         assert(aSrcCacheCount > 0 && apSrcCaches != nullptr);
 
-        ThrowIfFailed(vkMergePipelineCaches(mDevice, aDstCache, aSrcCacheCount, &apSrcCaches[0]));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkMergePipelineCaches)(mDevice, aDstCache, aSrcCacheCount, &apSrcCaches[0]));
 
         return aDstCache;
     }
@@ -881,14 +1058,27 @@ public:
 
     void GetPipelineCacheData(const PipelineCache& aPipelineCache, size_t& aDataSize, void*& apData) const
     {
-        ThrowIfFailed(vkGetPipelineCacheData(mDevice, aPipelineCache, &aDataSize, apData));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkGetPipelineCacheData)(mDevice, aPipelineCache, &aDataSize, apData));
+    }
+
+    std::vector<char> GetPipelineCacheData(const PipelineCache& aPipelineCache) const
+    {
+        size_t lDataSize{ 0 };
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkGetPipelineCacheData)(mDevice, aPipelineCache, &lDataSize, nullptr));
+
+        std::vector<char> lData(lDataSize);
+
+        if (lDataSize != 0)
+            ThrowIfFailed(VKPP_DEVICE_PROC(vkGetPipelineCacheData)(mDevice, aPipelineCache, &lDataSize, lData.data()));
+
+        return lData;
     }
 
     template <typename T = DefaultAllocationCallbacks>
     DeviceMemory AllocateMemory(const MemoryAllocateInfo& aMemoryAllocationInfo, const T& aAllocator = DefaultAllocator) const
     {
         DeviceMemory lDeviceMemory;
-        ThrowIfFailed(vkAllocateMemory(mDevice, &aMemoryAllocationInfo, &aAllocator, &lDeviceMemory));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkAllocateMemory)(mDevice, &aMemoryAllocationInfo, &aAllocator, &lDeviceMemory));
 
         return lDeviceMemory;
     }
@@ -896,24 +1086,24 @@ public:
     template <typename T = DefaultAllocationCallbacks>
     void FreeMemory(const DeviceMemory& aDeviceMemory, const T& aAllocator = DefaultAllocator) const
     {
-        vkFreeMemory(mDevice, aDeviceMemory, &aAllocator);
+        VKPP_DEVICE_PROC(vkFreeMemory)(mDevice, aDeviceMemory, &aAllocator);
     }
 
     void BindBufferMemory(const Buffer& aBuffer, const DeviceMemory& aDeviceMemory, DeviceSize aMemoryOffset = 0) const
     {
-        ThrowIfFailed(vkBindBufferMemory(mDevice, aBuffer, aDeviceMemory, aMemoryOffset));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkBindBufferMemory)(mDevice, aBuffer, aDeviceMemory, aMemoryOffset));
     }
 
     void BindImageMemory(const Image& aImage, const DeviceMemory& aDeviceMemory, DeviceSize aMemoryOffset = 0) const
     {
-        ThrowIfFailed(vkBindImageMemory(mDevice, aImage, aDeviceMemory, aMemoryOffset));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkBindImageMemory)(mDevice, aImage, aDeviceMemory, aMemoryOffset));
     }
 
     void* MapMemory(const DeviceMemory& aDeviceMemory, DeviceSize aOffset = 0, DeviceSize aSize = VK_WHOLE_SIZE, const MemoryMapFlags& aFlags = DefaultFlags) const
     {
         void* lpHostData{ nullptr };
 
-        ThrowIfFailed(vkMapMemory(mDevice, aDeviceMemory, aOffset, aSize, aFlags, &lpHostData));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkMapMemory)(mDevice, aDeviceMemory, aOffset, aSize, aFlags, &lpHostData));
 
         assert(lpHostData != nullptr);
 
@@ -922,19 +1112,19 @@ public:
 
     void UnmapMemory(const DeviceMemory& aDeviceMemory) const
     {
-        vkUnmapMemory(mDevice, aDeviceMemory);
+        VKPP_DEVICE_PROC(vkUnmapMemory)(mDevice, aDeviceMemory);
     }
 
     void FlushMappedMemoryRange(const MappedMemoryRange& aMappedMemoryRange) const
     {
-        ThrowIfFailed(vkFlushMappedMemoryRanges(mDevice, 1, &aMappedMemoryRange));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkFlushMappedMemoryRanges)(mDevice, 1, &aMappedMemoryRange));
     }
 
     void FlushMappedMemoryRanges(uint32_t aMemoryRangeCount, const MappedMemoryRange* aMappedMemoryRanges) const
     {
         assert(aMemoryRangeCount != 0 && aMappedMemoryRanges != nullptr);
 
-        ThrowIfFailed(vkFlushMappedMemoryRanges(mDevice, aMemoryRangeCount, &aMappedMemoryRanges[0]));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkFlushMappedMemoryRanges)(mDevice, aMemoryRangeCount, &aMappedMemoryRanges[0]));
     }
 
     template <typename T, typename = EnableIfValueType<ValueType<T>, MappedMemoryRange>>
@@ -952,7 +1142,7 @@ public:
     {
         assert(aMemoryRangeCount != 0 && apMappedMemoryRanges != nullptr);
 
-        ThrowIfFailed(vkInvalidateMappedMemoryRanges(mDevice, aMemoryRangeCount, &apMappedMemoryRanges[0]));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkInvalidateMappedMemoryRanges)(mDevice, aMemoryRangeCount, &apMappedMemoryRanges[0]));
     }
 
     template <typename T, typename = EnableIfValueType<ValueType<T>, MappedMemoryRange>>
@@ -966,9 +1156,120 @@ public:
         InvalidateMappedMemoryRanges(SizeOf<uint32_t>(aMappedMemoryRanges), DataOf(aMappedMemoryRanges));
     }
 
+    // The *Unique variants wrap the result in a UniqueHandle, which destroys it with the default allocator when it goes out of scope.
+    UniqueHandle<Semaphore> CreateSemaphoreUnique(const SemaphoreCreateInfo& aSemaphoreCreateInfo) const
+    {
+        return UniqueHandle<Semaphore>{ *this, CreateSemaphore(aSemaphoreCreateInfo) };
+    }
+
+    UniqueHandle<Fence> CreateFenceUnique(const FenceCreateInfo& aFenceCreateInfo) const
+    {
+        return UniqueHandle<Fence>{ *this, CreateFence(aFenceCreateInfo) };
+    }
+
+    UniqueHandle<QueryPool> CreateQueryPoolUnique(const QueryPoolCreateInfo& aQueryPoolCreateInfo) const
+    {
+        return UniqueHandle<QueryPool>{ *this, CreateQueryPool(aQueryPoolCreateInfo) };
+    }
+
+    UniqueHandle<khr::Swapchain> CreateSwapchainUnique(const khr::SwapchainCreateInfo& aSwapchainCreateInfo) const
+    {
+        return UniqueHandle<khr::Swapchain>{ *this, CreateSwapchain(aSwapchainCreateInfo) };
+    }
+
+    UniqueHandle<CommandPool> CreateCommandPoolUnique(const CommandPoolCreateInfo& aCommandPoolCreateInfo) const
+    {
+        return UniqueHandle<CommandPool>{ *this, CreateCommandPool(aCommandPoolCreateInfo) };
+    }
+
+    UniqueHandle<DescriptorPool> CreateDescriptorPoolUnique(const DescriptorPoolCreateInfo& aDescriptorPoolCreateInfo) const
+    {
+        return UniqueHandle<DescriptorPool>{ *this, CreateDescriptorPool(aDescriptorPoolCreateInfo) };
+    }
+
+    UniqueHandle<khr::DescriptorUpdateTemplate> CreateDescriptorUpdateTemplateUnique(const khr::DescriptorUpdateTemplateCreateInfo& aDescriptorUpdateTemplateCreateInfo) const
+    {
+        return UniqueHandle<khr::DescriptorUpdateTemplate>{ *this, CreateDescriptorUpdateTemplate(aDescriptorUpdateTemplateCreateInfo) };
+    }
+
+    UniqueHandle<RenderPass> CreateRenderPassUnique(const RenderPassCreateInfo& aRenderPassCreateInfo) const
+    {
+        return UniqueHandle<RenderPass>{ *this, CreateRenderPass(aRenderPassCreateInfo) };
+    }
+
+    UniqueHandle<Buffer> CreateBufferUnique(const BufferCreateInfo& aBufferCreateInfo) const
+    {
+        return UniqueHandle<Buffer>{ *this, CreateBuffer(aBufferCreateInfo) };
+    }
+
+    UniqueHandle<BufferView> CreateBufferViewUnique(const BufferViewCreateInfo& aBufferViewCreateInfo) const
+    {
+        return UniqueHandle<BufferView>{ *this, CreateBufferView(aBufferViewCreateInfo) };
+    }
+
+    UniqueHandle<Image> CreateImageUnique(const ImageCreateInfo& aImageCreateInfo) const
+    {
+        return UniqueHandle<Image>{ *this, CreateImage(aImageCreateInfo) };
+    }
+
+    UniqueHandle<ImageView> CreateImageViewUnique(const ImageViewCreateInfo& aImageViewCreateInfo) const
+    {
+        return UniqueHandle<ImageView>{ *this, CreateImageView(aImageViewCreateInfo) };
+    }
+
+    UniqueHandle<Sampler> CreateSamplerUnique(const SamplerCreateInfo& aSamplerCreateInfo) const
+    {
+        return UniqueHandle<Sampler>{ *this, CreateSampler(aSamplerCreateInfo) };
+    }
+
+    UniqueHandle<Framebuffer> CreateFramebufferUnique(const FramebufferCreateInfo& aFramebufferCreateInfo) const
+    {
+        return UniqueHandle<Framebuffer>{ *this, CreateFramebuffer(aFramebufferCreateInfo) };
+    }
+
+    UniqueHandle<ShaderModule> CreateShaderModuleUnique(const ShaderModuleCreateInfo& aShaderModuleCreateInfo) const
+    {
+        return UniqueHandle<ShaderModule>{ *this, CreateShaderModule(aShaderModuleCreateInfo) };
+    }
+
+    UniqueHandle<ShaderModule> CreateShaderModuleUnique(const std::string& aFilename) const
+    {
+        return UniqueHandle<ShaderModule>{ *this, CreateShaderModule(aFilename) };
+    }
+
+    UniqueHandle<DescriptorSetLayout> CreateDescriptorSetLayoutUnique(const DescriptorSetLayoutCreateInfo& aDescriptorSetLayoutCreateInfo) const
+    {
+        return UniqueHandle<DescriptorSetLayout>{ *this, CreateDescriptorSetLayout(aDescriptorSetLayoutCreateInfo) };
+    }
+
+    UniqueHandle<PipelineLayout> CreatePipelineLayoutUnique(const PipelineLayoutCreateInfo& aPipelineLayoutCreateInfo) const
+    {
+        return UniqueHandle<PipelineLayout>{ *this, CreatePipelineLayout(aPipelineLayoutCreateInfo) };
+    }
+
+    UniqueHandle<Pipeline> CreateGraphicsPipelineUnique(const GraphicsPipelineCreateInfo& aGraphicsPipelineCreateInfo, const PipelineCache& aPipelineCache = nullptr) const
+    {
+        return UniqueHandle<Pipeline>{ *this, CreateGraphicsPipeline(aGraphicsPipelineCreateInfo, aPipelineCache) };
+    }
+
+    UniqueHandle<Pipeline> CreateComputePipelineUnique(const ComputePipelineCreateInfo& aComputePipelineCreateInfo, const PipelineCache& aPipelineCache = nullptr) const
+    {
+        return UniqueHandle<Pipeline>{ *this, CreateComputePipeline(aComputePipelineCreateInfo, aPipelineCache) };
+    }
+
+    UniqueHandle<PipelineCache> CreatePipelineCacheUnique(const PipelineCacheCreateInfo& aPipelineCacheCreateInfo) const
+    {
+        return UniqueHandle<PipelineCache>{ *this, CreatePipelineCache(aPipelineCacheCreateInfo) };
+    }
+
+    UniqueHandle<DeviceMemory> AllocateMemoryUnique(const MemoryAllocateInfo& aMemoryAllocationInfo) const
+    {
+        return UniqueHandle<DeviceMemory>{ *this, AllocateMemory(aMemoryAllocationInfo) };
+    }
+
     VkResult Wait(void) const
     {
-        return vkDeviceWaitIdle(mDevice);
+        return VKPP_DEVICE_PROC(vkDeviceWaitIdle)(mDevice);
     }
 };
 
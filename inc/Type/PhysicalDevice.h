@@ -6,11 +6,13 @@
 #include <vector>
 
 #include <Info/Common.h>
+#include <Info/FixedVector.h>
 #include <Info/Layers.h>
 #include <Info/Extensions.h>
 #include <Info/SurfaceCapabilities.h>
 #include <Info/PhysicalDeviceFeatures.h>
 
+#include <Type/DispatchTable.h>
 #include <Type/Surface.h>
 #include <Type/Swapchain.h>
 
@@ -195,11 +197,11 @@ public:
     std::vector<LayerProperty> GetLayers(void) const
     {
         uint32_t lLayerCount{ 0 };
-        ThrowIfFailed(vkEnumerateDeviceLayerProperties(mPhysicalDevice, &lLayerCount, nullptr));
+        ThrowIfFailed(VKPP_INSTANCE_PROC(vkEnumerateDeviceLayerProperties)(mPhysicalDevice, &lLayerCount, nullptr));
         assert(lLayerCount != 0);
 
         std::vector<LayerProperty> lLayers(lLayerCount);
-        ThrowIfFailed(vkEnumerateDeviceLayerProperties(mPhysicalDevice, &lLayerCount, &lLayers[0]));
+        ThrowIfFailed(VKPP_INSTANCE_PROC(vkEnumerateDeviceLayerProperties)(mPhysicalDevice, &lLayerCount, &lLayers[0]));
 
         return lLayers;
     }
@@ -207,11 +209,11 @@ public:
     std::vector<ExtensionProperty> GetExtensions(const char* apLayerName = nullptr) const
     {
         uint32_t lExtensionCount{ 0 };
-        ThrowIfFailed(vkEnumerateDeviceExtensionProperties(mPhysicalDevice, apLayerName, &lExtensionCount, nullptr));
+        ThrowIfFailed(VKPP_INSTANCE_PROC(vkEnumerateDeviceExtensionProperties)(mPhysicalDevice, apLayerName, &lExtensionCount, nullptr));
         assert(lExtensionCount);
 
         std::vector<ExtensionProperty> lExtensions(lExtensionCount);
-        ThrowIfFailed(vkEnumerateDeviceExtensionProperties(mPhysicalDevice, apLayerName, &lExtensionCount, &lExtensions[0]));
+        ThrowIfFailed(VKPP_INSTANCE_PROC(vkEnumerateDeviceExtensionProperties)(mPhysicalDevice, apLayerName, &lExtensionCount, &lExtensions[0]));
 
         return lExtensions;
     }
@@ -219,7 +221,7 @@ public:
     PhysicalDeviceProperties GetProperties(void) const
     {
         PhysicalDeviceProperties lProperties;
-        vkGetPhysicalDeviceProperties(mPhysicalDevice, &lProperties);
+        VKPP_INSTANCE_PROC(vkGetPhysicalDeviceProperties)(mPhysicalDevice, &lProperties);
 
         return lProperties;
     }
@@ -227,15 +229,27 @@ public:
     PhysicalDeviceFeatures GetFeatures(void) const
     {
         PhysicalDeviceFeatures lFeatures;
-        vkGetPhysicalDeviceFeatures(mPhysicalDevice, &lFeatures);
+        VKPP_INSTANCE_PROC(vkGetPhysicalDeviceFeatures)(mPhysicalDevice, &lFeatures);
 
         return lFeatures;
     }
 
+    // Also fill the extension feature structures chained to apNext; aInstance must have VK_KHR_get_physical_device_properties2 enabled.
+    PhysicalDeviceFeatures GetFeatures(VkInstance aInstance, void* apNext) const
+    {
+        khr::PhysicalDeviceFeatures2 lFeatures;
+        lFeatures.SetNext(apNext);
+
+        auto lpFunc = VKPP_GET_INSTANCE_PROC_ADDR(aInstance, vkGetPhysicalDeviceFeatures2KHR);
+        lpFunc(mPhysicalDevice, &lFeatures);
+
+        return lFeatures.features;
+    }
+
     FormatProperties GetFormatProperties(Format aFormat) const
     {
         FormatProperties lFormatProperties;
-        vkGetPhysicalDeviceFormatProperties(mPhysicalDevice, static_cast<VkFormat>(aFormat), &lFormatProperties);
+        VKPP_INSTANCE_PROC(vkGetPhysicalDeviceFormatProperties)(mPhysicalDevice, static_cast<VkFormat>(aFormat), &lFormatProperties);
 
         return lFormatProperties;
     }
@@ -243,7 +257,7 @@ public:
     PhysicalDeviceMemoryProperties GetMemoryProperties(void) const
     {
         PhysicalDeviceMemoryProperties lMemoryProperties;
-        vkGetPhysicalDeviceMemoryProperties(mPhysicalDevice, &lMemoryProperties);
+        VKPP_INSTANCE_PROC(vkGetPhysicalDeviceMemoryProperties)(mPhysicalDevice, &lMemoryProperties);
 
         return lMemoryProperties;
     }
@@ -251,19 +265,53 @@ public:
     std::vector<QueueFamilyProperties> GetQueueFamilyProperties(void) const
     {
         uint32_t lQueueFamilyPropertyCount{ 0 };
-        vkGetPhysicalDeviceQueueFamilyProperties(mPhysicalDevice, &lQueueFamilyPropertyCount, nullptr);
+        VKPP_INSTANCE_PROC(vkGetPhysicalDeviceQueueFamilyProperties)(mPhysicalDevice, &lQueueFamilyPropertyCount, nullptr);
         assert(lQueueFamilyPropertyCount != 0);
 
         std::vector<QueueFamilyProperties> lQueueFamilyProperties(lQueueFamilyPropertyCount);
-        vkGetPhysicalDeviceQueueFamilyProperties(mPhysicalDevice, &lQueueFamilyPropertyCount, &lQueueFamilyProperties[0]);
+        VKPP_INSTANCE_PROC(vkGetPhysicalDeviceQueueFamilyProperties)(mPhysicalDevice, &lQueueFamilyPropertyCount, &lQueueFamilyProperties[0]);
 
         return lQueueFamilyProperties;
     }
 
+    // Write up to aQueueFamilyPropertyCount families into the caller's storage and set aQueueFamilyPropertyCount to the number written.
+    void GetQueueFamilyProperties(uint32_t& aQueueFamilyPropertyCount, QueueFamilyProperties* apQueueFamilyProperties) const
+    {
+        assert(apQueueFamilyProperties != nullptr);
+
+        VKPP_INSTANCE_PROC(vkGetPhysicalDeviceQueueFamilyProperties)(mPhysicalDevice, &aQueueFamilyPropertyCount, &apQueueFamilyProperties[0]);
+    }
+
+    template <std::size_t N>
+    void GetQueueFamilyProperties(FixedVector<QueueFamilyProperties, N>& aQueueFamilyProperties) const
+    {
+        auto lQueueFamilyPropertyCount = static_cast<uint32_t>(N);
+        GetQueueFamilyProperties(lQueueFamilyPropertyCount, aQueueFamilyProperties.data());
+
+        aQueueFamilyProperties.resize(lQueueFamilyPropertyCount);
+    }
+
+    // Index of the first queue family supporting every aQueueFlags and none of aExcludedFlags, or UINT32_MAX if there is none.
+    // E.g. (eTransfer, eGraphics | eCompute) picks the dedicated DMA family that can copy while the graphics queue keeps rendering.
+    uint32_t GetQueueFamilyIndex(const QueueFlags& aQueueFlags, const QueueFlags& aExcludedFlags = DefaultFlags) const
+    {
+        const auto& lQueueFamilyProperties = GetQueueFamilyProperties();
+
+        for (uint32_t lIndex = 0; lIndex < lQueueFamilyProperties.size(); ++lIndex)
+        {
+            const auto& lQueueFlags = lQueueFamilyProperties[lIndex].queueFlags;
+
+            if (lQueueFamilyProperties[lIndex].queueCount != 0 && (lQueueFlags & aQueueFlags) == aQueueFlags && !(lQueueFlags & aExcludedFlags))
+                return lIndex;
+        }
+
+        return UINT32_MAX;
+    }
+
     Bool32 IsSurfaceSupported(uint32_t aQueueFamilyIndex, khr::Surface aSurface) const
     {
         Bool32 lIsSupported{ VK_FALSE };
-        ThrowIfFailed(vkGetPhysicalDeviceSurfaceSupportKHR(mPhysicalDevice, aQueueFamilyIndex, aSurface, &lIsSupported));
+        ThrowIfFailed(VKPP_INSTANCE_PROC(vkGetPhysicalDeviceSurfaceSupportKHR)(mPhysicalDevice, aQueueFamilyIndex, aSurface, &lIsSupported));
 
         return lIsSupported;
     }
@@ -271,7 +319,7 @@ public:
     khr::SurfaceCapabilities GetSurfaceCapabilities(khr::Surface aSurface) const
     {
         khr::SurfaceCapabilities lSurfaceCapabilities;
-        ThrowIfFailed(vkGetPhysicalDeviceSurfaceCapabilitiesKHR(mPhysicalDevice, aSurface, &lSurfaceCapabilities));
+        ThrowIfFailed(VKPP_INSTANCE_PROC(vkGetPhysicalDeviceSurfaceCapabilitiesKHR)(mPhysicalDevice, aSurface, &lSurfaceCapabilities));
 
         return lSurfaceCapabilities;
     }
@@ -279,25 +327,151 @@ public:
     std::vector<khr::SurfaceFormat> GetSurfaceFormats(khr::Surface aSurface) const
     {
         uint32_t lSurfaceFormatCount{ 0 };
-        ThrowIfFailed(vkGetPhysicalDeviceSurfaceFormatsKHR(mPhysicalDevice, aSurface, &lSurfaceFormatCount, nullptr));
+        ThrowIfFailed(VKPP_INSTANCE_PROC(vkGetPhysicalDeviceSurfaceFormatsKHR)(mPhysicalDevice, aSurface, &lSurfaceFormatCount, nullptr));
         assert(lSurfaceFormatCount != 0);
 
         std::vector<khr::SurfaceFormat> lSurfaceFormats(lSurfaceFormatCount);
-        ThrowIfFailed(vkGetPhysicalDeviceSurfaceFormatsKHR(mPhysicalDevice, aSurface, &lSurfaceFormatCount, &lSurfaceFormats[0]));
+        ThrowIfFailed(VKPP_INSTANCE_PROC(vkGetPhysicalDeviceSurfaceFormatsKHR)(mPhysicalDevice, aSurface, &lSurfaceFormatCount, &lSurfaceFormats[0]));
 
         return lSurfaceFormats;
     }
 
+    // Return VK_INCOMPLETE instead of throwing when the surface has more formats than aSurfaceFormatCount.
+    VkResult GetSurfaceFormats(khr::Surface aSurface, uint32_t& aSurfaceFormatCount, khr::SurfaceFormat* apSurfaceFormats) const
+    {
+        assert(apSurfaceFormats != nullptr);
+
+        const auto lResult = VKPP_INSTANCE_PROC(vkGetPhysicalDeviceSurfaceFormatsKHR)(mPhysicalDevice, aSurface, &aSurfaceFormatCount, &apSurfaceFormats[0]);
+
+        if (lResult != VK_INCOMPLETE)
+            ThrowIfFailed(lResult);
+
+        return lResult;
+    }
+
+    template <std::size_t N>
+    VkResult GetSurfaceFormats(khr::Surface aSurface, FixedVector<khr::SurfaceFormat, N>& aSurfaceFormats) const
+    {
+        auto lSurfaceFormatCount = static_cast<uint32_t>(N);
+        const auto lResult = GetSurfaceFormats(aSurface, lSurfaceFormatCount, aSurfaceFormats.data());
+
+        aSurfaceFormats.resize(lSurfaceFormatCount);
+
+        return lResult;
+    }
+
     std::vector<khr::PresentMode> GetSurfacePresentModes(khr::Surface aSurface) const
     {
         uint32_t lPresentModeCount{ 0 };
-        ThrowIfFailed(vkGetPhysicalDeviceSurfacePresentModesKHR(mPhysicalDevice, aSurface, &lPresentModeCount, nullptr));
+        ThrowIfFailed(VKPP_INSTANCE_PROC(vkGetPhysicalDeviceSurfacePresentModesKHR)(mPhysicalDevice, aSurface, &lPresentModeCount, nullptr));
 
         std::vector<khr::PresentMode> lPresentModes(lPresentModeCount);
-        ThrowIfFailed(vkGetPhysicalDeviceSurfacePresentModesKHR(mPhysicalDevice, aSurface, &lPresentModeCount, reinterpret_cast<VkPresentModeKHR*>(lPresentModes.data())));
+        ThrowIfFailed(VKPP_INSTANCE_PROC(vkGetPhysicalDeviceSurfacePresentModesKHR)(mPhysicalDevice, aSurface, &lPresentModeCount, reinterpret_cast<VkPresentModeKHR*>(lPresentModes.data())));
 
         return lPresentModes;
     }
+
+    VkResult GetSurfacePresentModes(khr::Surface aSurface, uint32_t& aPresentModeCount, khr::PresentMode* apPresentModes) const
+    {
+        assert(apPresentModes != nullptr);
+
+        const auto lResult = VKPP_INSTANCE_PROC(vkGetPhysicalDeviceSurfacePresentModesKHR)(mPhysicalDevice, aSurface, &aPresentModeCount, reinterpret_cast<VkPresentModeKHR*>(apPresentModes));
+
+        if (lResult != VK_INCOMPLETE)
+            ThrowIfFailed(lResult);
+
+        return lResult;
+    }
+
+    template <std::size_t N>
+    VkResult GetSurfacePresentModes(khr::Surface aSurface, FixedVector<khr::PresentMode, N>& aPresentModes) const
+    {
+        auto lPresentModeCount = static_cast<uint32_t>(N);
+        const auto lResult = GetSurfacePresentModes(aSurface, lPresentModeCount, aPresentModes.data());
+
+        aPresentModes.resize(lPresentModeCount);
+
+        return lResult;
+    }
+};
+
+StaticSizeCheck(PhysicalDevice)
+
+
+
+/**
+ * \class PhysicalDeviceSnapshot
+ *
+ * \brief The properties, features, memory properties and queue families of a physical device, queried once.
+ *
+ * None of them change for the lifetime of the instance, so keep a snapshot rather than asking the driver again at every use.
+ * PhysicalDevice itself stays the size of its handle and keeps querying on every call.
+ */
+class PhysicalDeviceSnapshot
+{
+public:
+    static constexpr std::size_t MaxQueueFamilyCount = 16;
+
+private:
+    PhysicalDevice mPhysicalDevice;
+    PhysicalDeviceProperties mProperties;
+    PhysicalDeviceFeatures mFeatures;
+    PhysicalDeviceMemoryProperties mMemoryProperties;
+    FixedVector<QueueFamilyProperties, MaxQueueFamilyCount> mQueueFamilyProperties;
+
+public:
+    PhysicalDeviceSnapshot(void) noexcept = default;
+
+    explicit PhysicalDeviceSnapshot(const PhysicalDevice& aPhysicalDevice)
+        : mPhysicalDevice(aPhysicalDevice), mProperties(aPhysicalDevice.GetProperties()), mFeatures(aPhysicalDevice.GetFeatures()),
+          mMemoryProperties(aPhysicalDevice.GetMemoryProperties())
+    {
+        aPhysicalDevice.GetQueueFamilyProperties(mQueueFamilyProperties);
+    }
+
+    const PhysicalDevice& GetPhysicalDevice(void) const noexcept
+    {
+        return mPhysicalDevice;
+    }
+
+    const PhysicalDeviceProperties& GetProperties(void) const noexcept
+    {
+        return mProperties;
+    }
+
+    const PhysicalDeviceLimits& GetLimits(void) const noexcept
+    {
+        return mProperties.limits;
+    }
+
+    const PhysicalDeviceFeatures& GetFeatures(void) const noexcept
+    {
+        return mFeatures;
+    }
+
+    const PhysicalDeviceMemoryProperties& GetMemoryProperties(void) const noexcept
+    {
+        return mMemoryProperties;
+    }
+
+    const FixedVector<QueueFamilyProperties, MaxQueueFamilyCount>& GetQueueFamilyProperties(void) const noexcept
+    {
+        return mQueueFamilyProperties;
+    }
+
+    // Same as PhysicalDevice::GetQueueFamilyIndex, on the snapshot.
+    uint32_t GetQueueFamilyIndex(const QueueFlags& aQueueFlags, const QueueFlags& aExcludedFlags = DefaultFlags) const noexcept
+    {
+        for (uint32_t lIndex = 0; lIndex < mQueueFamilyProperties.size(); ++lIndex)
+        {
+            const auto& lQueueFlags = mQueueFamilyProperties[lIndex].queueFlags;
+
+            if (mQueueFamilyProperties[lIndex].queueCount != 0 && (lQueueFlags & aQueueFlags) == aQueueFlags && !(lQueueFlags & aExcludedFlags))
+                return lIndex;
+        }
+
+        return UINT32_MAX;
+    }
 };
 
 
@@ -0,0 +1,178 @@
+#ifndef __VKPP_TYPE_PIPELINE_CACHE_STORE_H__
+#define __VKPP_TYPE_PIPELINE_CACHE_STORE_H__
+
+
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <iostream>
+#include <cstring>
+#include <filesystem>
+
+#include <Info/Common.h>
+
+#include <Type/PhysicalDevice.h>
+#include <Type/LogicalDevice.h>
+#include <Type/GraphicsPipeline.h>
+
+
+
+namespace vkpp
+{
+
+
+
+/**
+ * \class PipelineCacheStore
+ *
+ * \brief PipelineCache backed by a file, so pipelines compiled by one run are not compiled again by the next one.
+ *
+ * The blob is only handed to the driver if its VkPipelineCacheHeaderVersionOne matches the physical device; otherwise the cache starts empty.
+ * Save writes to a temporary file that then replaces the previous blob, so an interrupted save never leaves a truncated cache behind.
+ * The destructor saves as well, but only logs a failure; call Save beforehand to find out whether the blob was written.
+ */
+class PipelineCacheStore
+{
+private:
+    // Layout of VkPipelineCacheHeaderVersionOne.
+    constexpr static std::size_t HeaderSizeOffset{ 0 };
+    constexpr static std::size_t HeaderVersionOffset{ 4 };
+    constexpr static std::size_t VendorIDOffset{ 8 };
+    constexpr static std::size_t DeviceIDOffset{ 12 };
+    constexpr static std::size_t UUIDOffset{ 16 };
+    constexpr static std::size_t HeaderSize{ UUIDOffset + VK_UUID_SIZE };
+
+    const LogicalDevice& mLogicalDevice;
+    const PhysicalDeviceProperties& mPhysicalDeviceProperties;
+    std::string mFilename;
+
+    PipelineCache mPipelineCache;
+    bool mIsLoaded{ false };
+
+    static uint32_t ReadUInt32(const std::vector<char>& aData, std::size_t aOffset) noexcept
+    {
+        uint32_t lValue{ 0 };
+        std::memcpy(&lValue, aData.data() + aOffset, sizeof(uint32_t));
+
+        return lValue;
+    }
+
+    std::vector<char> Load(void) const
+    {
+        std::ifstream lFin(mFilename, std::ios::binary);
+
+        if (!lFin)
+            return {};
+
+        std::vector<char> lData{ std::istreambuf_iterator<char>(lFin), std::istreambuf_iterator<char>() };
+
+        if (!IsCompatible(lData, mPhysicalDeviceProperties))
+            return {};
+
+        return lData;
+    }
+
+public:
+    PipelineCacheStore(const LogicalDevice& aLogicalDevice, const PhysicalDeviceProperties& aPhysicalDeviceProperties, std::string aFilename)
+        : mLogicalDevice(aLogicalDevice), mPhysicalDeviceProperties(aPhysicalDeviceProperties), mFilename(std::move(aFilename))
+    {
+        const auto& lInitialData = Load();
+        mIsLoaded = !lInitialData.empty();
+
+        const PipelineCacheCreateInfo lPipelineCacheCreateInfo{ lInitialData.size(), lInitialData.data() };
+        mPipelineCache = mLogicalDevice.CreatePipelineCache(lPipelineCacheCreateInfo);
+    }
+
+    PipelineCacheStore(const PipelineCacheStore&) = delete;
+    PipelineCacheStore& operator=(const PipelineCacheStore&) = delete;
+
+    ~PipelineCacheStore(void)
+    {
+        // Reading the cache data or the file system may throw, which must not escape a destructor.
+        try
+        {
+            if (!Save())
+                std::cerr << "Pipeline cache not saved to " << mFilename << std::endl;
+        }
+        catch (const std::exception& aException)
+        {
+            std::cerr << "Pipeline cache not saved to " << mFilename << ": " << aException.what() << std::endl;
+        }
+        catch (...)
+        {
+            std::cerr << "Pipeline cache not saved to " << mFilename << std::endl;
+        }
+
+        mLogicalDevice.DestroyPipelineCache(mPipelineCache);
+    }
+
+    // Whether aData starts with a version one header written by the same driver for the same device.
+    static bool IsCompatible(const std::vector<char>& aData, const PhysicalDeviceProperties& aPhysicalDeviceProperties) noexcept
+    {
+        if (aData.size() < HeaderSize)
+            return false;
+
+        const auto lHeaderSize = ReadUInt32(aData, HeaderSizeOffset);
+
+        return lHeaderSize >= HeaderSize && lHeaderSize <= aData.size()
+            && ReadUInt32(aData, HeaderVersionOffset) == static_cast<uint32_t>(VK_PIPELINE_CACHE_HEADER_VERSION_ONE)
+            && ReadUInt32(aData, VendorIDOffset) == aPhysicalDeviceProperties.vendorID
+            && ReadUInt32(aData, DeviceIDOffset) == aPhysicalDeviceProperties.deviceID
+            && std::memcmp(aData.data() + UUIDOffset, aPhysicalDeviceProperties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+    }
+
+    // Write the current cache content back. Failing to save is not fatal, the next run just starts cold.
+    bool Save(void) const
+    {
+        const auto& lData = mLogicalDevice.GetPipelineCacheData(mPipelineCache);
+
+        if (lData.empty())
+            return false;
+
+        const auto& lTempFilename = mFilename + ".tmp";
+
+        {
+            std::ofstream lFout(lTempFilename, std::ios::binary | std::ios::trunc);
+            lFout.write(lData.data(), static_cast<std::streamsize>(lData.size()));
+            lFout.close();
+
+            if (!lFout)
+                return false;
+        }
+
+        std::error_code lErrorCode;
+        std::filesystem::rename(lTempFilename, mFilename, lErrorCode);
+
+        if (!lErrorCode)
+            return true;
+
+        std::filesystem::remove(lTempFilename, lErrorCode);
+
+        return false;
+    }
+
+    const PipelineCache& GetPipelineCache(void) const noexcept
+    {
+        return mPipelineCache;
+    }
+
+    // Whether a compatible blob was found, i.e. pipeline creation should mostly hit the cache.
+    bool IsLoaded(void) const noexcept
+    {
+        return mIsLoaded;
+    }
+
+    const std::string& GetFilename(void) const noexcept
+    {
+        return mFilename;
+    }
+};
+
+
+
+}                   // End of namespace vkpp.
+
+
+
+#endif              // __VKPP_TYPE_PIPELINE_CACHE_STORE_H__
@@ -0,0 +1,221 @@
+#ifndef __VKPP_TYPE_PIPELINE_COMPILER_H__
+#define __VKPP_TYPE_PIPELINE_COMPILER_H__
+
+
+
+#include <deque>
+#include <vector>
+#include <future>
+#include <optional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include <Info/Common.h>
+
+#include <Type/LogicalDevice.h>
+#include <Type/GraphicsPipeline.h>
+#include <Memory/ThreadPool.h>
+
+
+
+namespace vkpp
+{
+
+
+
+/**
+ * \class PipelineCompiler
+ *
+ * \brief Compiles graphics pipelines on worker threads and hands back futures, so rendering can start with the variants already built.
+ *
+ * Every worker compiles into its own PipelineCache, seeded from the destination cache, so the driver never serializes the workers on a shared cache.
+ * Merge folds the worker caches back into the destination cache with vkMergePipelineCaches.
+ * Everything a create info points to (stages, states, specialization data) must stay alive until its future is ready.
+ */
+class PipelineCompiler
+{
+private:
+    struct Job
+    {
+        GraphicsPipelineCreateInfo  createInfo;
+        std::promise<Pipeline>      promise;
+    };
+
+    const LogicalDevice& mLogicalDevice;
+    PipelineCache mPipelineCache;
+
+    std::vector<PipelineCache> mThreadCaches;
+    std::vector<std::thread> mWorkers;
+
+    std::mutex mMutex;
+    std::condition_variable mWakeCondition;
+    std::condition_variable mIdleCondition;
+
+    std::deque<Job> mJobs;
+    uint32_t mActiveJobCount{ 0 };
+    bool mIsStopping{ false };
+
+    PipelineCache CreateThreadCache(void) const
+    {
+        if (!mPipelineCache)
+        {
+            constexpr PipelineCacheCreateInfo lPipelineCacheCreateInfo;
+
+            return mLogicalDevice.CreatePipelineCache(lPipelineCacheCreateInfo);
+        }
+
+        const auto& lInitialData = mLogicalDevice.GetPipelineCacheData(mPipelineCache);
+
+        return mLogicalDevice.CreatePipelineCache({ lInitialData.size(), lInitialData.data() });
+    }
+
+    void WorkerLoop(uint32_t aWorkerIndex)
+    {
+        for (;;)
+        {
+            std::optional<Job> lJob;
+
+            {
+                std::unique_lock<std::mutex> lLock{ mMutex };
+
+                mWakeCondition.wait(lLock, [this](void)
+                {
+                    return mIsStopping || !mJobs.empty();
+                });
+
+                // Pending jobs are still compiled on shutdown so that no future is left broken.
+                if (mJobs.empty())
+                    return;
+
+                lJob.emplace(std::move(mJobs.front()));
+                mJobs.pop_front();
+
+                ++mActiveJobCount;
+            }
+
+            // A failed creation is rethrown by the future's get(), rather than terminating the worker thread.
+            try
+            {
+                lJob->promise.set_value(mLogicalDevice.CreateGraphicsPipeline(lJob->createInfo, mThreadCaches[aWorkerIndex]));
+            }
+            catch (...)
+            {
+                lJob->promise.set_exception(std::current_exception());
+            }
+
+            std::lock_guard<std::mutex> lLock{ mMutex };
+
+            if (--mActiveJobCount == 0 && mJobs.empty())
+                mIdleCondition.notify_all();
+        }
+    }
+
+public:
+    explicit PipelineCompiler(const LogicalDevice& aLogicalDevice, const PipelineCache& aPipelineCache = nullptr,
+        uint32_t aThreadCount = ThreadPool::DefaultThreadCount())
+        : mLogicalDevice(aLogicalDevice), mPipelineCache(aPipelineCache)
+    {
+        assert(aThreadCount != 0);
+
+        for (uint32_t lWorkerIndex = 0; lWorkerIndex < aThreadCount; ++lWorkerIndex)
+            mThreadCaches.emplace_back(CreateThreadCache());
+
+        for (uint32_t lWorkerIndex = 0; lWorkerIndex < aThreadCount; ++lWorkerIndex)
+            mWorkers.emplace_back(&PipelineCompiler::WorkerLoop, this, lWorkerIndex);
+    }
+
+    PipelineCompiler(const PipelineCompiler&) = delete;
+    PipelineCompiler& operator=(const PipelineCompiler&) = delete;
+
+    ~PipelineCompiler(void)
+    {
+        {
+            std::lock_guard<std::mutex> lLock{ mMutex };
+            mIsStopping = true;
+        }
+
+        mWakeCondition.notify_all();
+
+        for (auto& lWorker : mWorkers)
+            lWorker.join();
+
+        if (mPipelineCache)
+            mLogicalDevice.MergePipelineCaches(mPipelineCache, mThreadCaches);
+
+        for (const auto& lThreadCache : mThreadCaches)
+            mLogicalDevice.DestroyPipelineCache(lThreadCache);
+    }
+
+    std::future<Pipeline> Compile(const GraphicsPipelineCreateInfo& aGraphicsPipelineCreateInfo)
+    {
+        // Each pipeline is compiled on its own, so a base pipeline can only be given by handle.
+        assert(aGraphicsPipelineCreateInfo.basePipelineIndex == -1 || !(aGraphicsPipelineCreateInfo.flags & PipelineCreateFlagBits::eDerivative));
+
+        std::future<Pipeline> lFuture;
+
+        {
+            std::lock_guard<std::mutex> lLock{ mMutex };
+
+            mJobs.push_back({ aGraphicsPipelineCreateInfo, {} });
+            lFuture = mJobs.back().promise.get_future();
+        }
+
+        mWakeCondition.notify_one();
+
+        return lFuture;
+    }
+
+    // One future per create info, in the same order; the pipelines of a batch are compiled concurrently.
+    std::vector<std::future<Pipeline>> Compile(uint32_t aCreateInfoCount, const GraphicsPipelineCreateInfo* apGraphicsPipelineCreateInfos)
+    {
+        assert(aCreateInfoCount > 0 && apGraphicsPipelineCreateInfos != nullptr);
+
+        std::vector<std::future<Pipeline>> lFutures;
+        lFutures.reserve(aCreateInfoCount);
+
+        for (uint32_t lIndex = 0; lIndex < aCreateInfoCount; ++lIndex)
+            lFutures.emplace_back(Compile(apGraphicsPipelineCreateInfos[lIndex]));
+
+        return lFutures;
+    }
+
+    template <typename T, typename = EnableIfValueType<ValueType<T>, GraphicsPipelineCreateInfo>>
+    std::vector<std::future<Pipeline>> Compile(T&& aGraphicsPipelineCreateInfos)
+    {
+        return Compile(SizeOf<uint32_t>(aGraphicsPipelineCreateInfos), DataOf(aGraphicsPipelineCreateInfos));
+    }
+
+    void WaitIdle(void)
+    {
+        std::unique_lock<std::mutex> lLock{ mMutex };
+
+        mIdleCondition.wait(lLock, [this](void)
+        {
+            return mActiveJobCount == 0 && mJobs.empty();
+        });
+    }
+
+    // Fold what the workers compiled so far into the destination cache, e.g. before a PipelineCacheStore saves it.
+    void Merge(void)
+    {
+        assert(mPipelineCache);
+
+        WaitIdle();
+
+        mLogicalDevice.MergePipelineCaches(mPipelineCache, mThreadCaches);
+    }
+
+    uint32_t GetThreadCount(void) const noexcept
+    {
+        return static_cast<uint32_t>(mWorkers.size());
+    }
+};
+
+
+
+}                   // End of namespace vkpp.
+
+
+
+#endif              // __VKPP_TYPE_PIPELINE_COMPILER_H__
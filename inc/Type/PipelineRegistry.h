@@ -0,0 +1,252 @@
+#ifndef __VKPP_TYPE_PIPELINE_REGISTRY_H__
+#define __VKPP_TYPE_PIPELINE_REGISTRY_H__
+
+
+
+#include <vector>
+
+#include <Info/Common.h>
+#include <Info/Hash.h>
+#include <Info/PipelineStage.h>
+
+#include <Type/LogicalDevice.h>
+#include <Type/GraphicsPipeline.h>
+
+
+
+namespace vkpp
+{
+
+
+
+/**
+ * \class PipelineRegistry
+ *
+ * \brief Owns graphics pipelines keyed by a hash of their full create info, so an identical state never reaches the driver twice.
+ *
+ * The hash follows every pointer of the create info: shader stages with their entry names and specialization data, vertex input, viewports,
+ * sample mask, blend attachments and dynamic states. Every entry keeps the bytes that were hashed, and a hit is only taken if they match. Handles (shader modules, layout, render pass) are hashed by value, so Clear the registry
+ * before a destroyed handle can be recycled for a different object.
+ * Create infos with a pNext chain anywhere are not hashed; their pipelines are still created and owned, just never shared.
+ */
+class PipelineRegistry
+{
+private:
+    const LogicalDevice& mLogicalDevice;
+    PipelineCache mPipelineCache;
+
+    internal::HashTable<Pipeline> mPipelines;
+    std::vector<Pipeline> mUnhashedPipelines;
+
+    internal::HashKey mKey;                             // Key of the current lookup, kept for its capacity.
+
+    uint32_t mHitCount{ 0 };
+    uint32_t mMissCount{ 0 };
+
+    static bool HasExtensions(const VkGraphicsPipelineCreateInfo& aCreateInfo) noexcept
+    {
+        const auto HasNext = [](const auto* apState)
+        {
+            return apState != nullptr && apState->pNext != nullptr;
+        };
+
+        for (uint32_t lIndex = 0; lIndex < aCreateInfo.stageCount; ++lIndex)
+        {
+            if (aCreateInfo.pStages[lIndex].pNext != nullptr)
+                return true;
+        }
+
+        return aCreateInfo.pNext != nullptr || HasNext(aCreateInfo.pVertexInputState) || HasNext(aCreateInfo.pInputAssemblyState)
+            || HasNext(aCreateInfo.pTessellationState) || HasNext(aCreateInfo.pViewportState) || HasNext(aCreateInfo.pRasterizationState)
+            || HasNext(aCreateInfo.pMultisampleState) || HasNext(aCreateInfo.pDepthStencilState) || HasNext(aCreateInfo.pColorBlendState)
+            || HasNext(aCreateInfo.pDynamicState);
+    }
+
+    static void HashStage(internal::Hasher& aHasher, const VkPipelineShaderStageCreateInfo& aStage)
+    {
+        aHasher.Add(aStage.flags).Add(aStage.stage).Add(aStage.module).AddString(aStage.pName);
+
+        const auto lpSpecialization = aStage.pSpecializationInfo;
+        aHasher.Add(lpSpecialization != nullptr);
+
+        if (lpSpecialization != nullptr)
+        {
+            aHasher.AddArray(lpSpecialization->mapEntryCount, lpSpecialization->pMapEntries)
+                .Add(lpSpecialization->dataSize).AddBytes(lpSpecialization->pData, lpSpecialization->dataSize);
+        }
+    }
+
+public:
+    explicit PipelineRegistry(const LogicalDevice& aLogicalDevice, const PipelineCache& aPipelineCache = nullptr) noexcept
+        : mLogicalDevice(aLogicalDevice), mPipelineCache(aPipelineCache)
+    {}
+
+    PipelineRegistry(const PipelineRegistry&) = delete;
+    PipelineRegistry& operator=(const PipelineRegistry&) = delete;
+
+    ~PipelineRegistry(void)
+    {
+        Clear();
+    }
+
+    // Appends the hashed bytes to apKey if given.
+    static uint64_t Hash(const GraphicsPipelineCreateInfo& aGraphicsPipelineCreateInfo, internal::HashKey* apKey = nullptr)
+    {
+        const VkGraphicsPipelineCreateInfo& lCreateInfo = *&aGraphicsPipelineCreateInfo;
+        internal::Hasher lHasher{ apKey };
+
+        lHasher.Add(lCreateInfo.flags).Add(lCreateInfo.stageCount);
+
+        for (uint32_t lIndex = 0; lIndex < lCreateInfo.stageCount; ++lIndex)
+            HashStage(lHasher, lCreateInfo.pStages[lIndex]);
+
+        // A marker per optional state keeps an absent state distinct from an empty one.
+        const auto lpVertexInput = lCreateInfo.pVertexInputState;
+        lHasher.Add(lpVertexInput != nullptr);
+
+        if (lpVertexInput != nullptr)
+        {
+            lHasher.Add(lpVertexInput->flags)
+                .AddArray(lpVertexInput->vertexBindingDescriptionCount, lpVertexInput->pVertexBindingDescriptions)
+                .AddArray(lpVertexInput->vertexAttributeDescriptionCount, lpVertexInput->pVertexAttributeDescriptions);
+        }
+
+        const auto lpInputAssembly = lCreateInfo.pInputAssemblyState;
+        lHasher.Add(lpInputAssembly != nullptr);
+
+        if (lpInputAssembly != nullptr)
+            lHasher.Add(lpInputAssembly->flags).Add(lpInputAssembly->topology).Add(lpInputAssembly->primitiveRestartEnable);
+
+        const auto lpTessellation = lCreateInfo.pTessellationState;
+        lHasher.Add(lpTessellation != nullptr);
+
+        if (lpTessellation != nullptr)
+            lHasher.Add(lpTessellation->flags).Add(lpTessellation->patchControlPoints);
+
+        const auto lpViewport = lCreateInfo.pViewportState;
+        lHasher.Add(lpViewport != nullptr);
+
+        if (lpViewport != nullptr)
+        {
+            // Dynamic viewports and scissors leave the arrays null; only their counts matter then.
+            lHasher.Add(lpViewport->flags)
+                .AddArray(lpViewport->viewportCount, lpViewport->pViewports)
+                .AddArray(lpViewport->scissorCount, lpViewport->pScissors);
+        }
+
+        const auto lpRasterization = lCreateInfo.pRasterizationState;
+        lHasher.Add(lpRasterization != nullptr);
+
+        if (lpRasterization != nullptr)
+        {
+            lHasher.Add(lpRasterization->flags).Add(lpRasterization->depthClampEnable).Add(lpRasterization->rasterizerDiscardEnable)
+                .Add(lpRasterization->polygonMode).Add(lpRasterization->cullMode).Add(lpRasterization->frontFace)
+                .Add(lpRasterization->depthBiasEnable).Add(lpRasterization->depthBiasConstantFactor).Add(lpRasterization->depthBiasClamp)
+                .Add(lpRasterization->depthBiasSlopeFactor).Add(lpRasterization->lineWidth);
+        }
+
+        const auto lpMultisample = lCreateInfo.pMultisampleState;
+        lHasher.Add(lpMultisample != nullptr);
+
+        if (lpMultisample != nullptr)
+        {
+            lHasher.Add(lpMultisample->flags).Add(lpMultisample->rasterizationSamples).Add(lpMultisample->sampleShadingEnable)
+                .Add(lpMultisample->minSampleShading).Add(lpMultisample->alphaToCoverageEnable).Add(lpMultisample->alphaToOneEnable)
+                .AddArray((static_cast<uint32_t>(lpMultisample->rasterizationSamples) + 31) / 32, lpMultisample->pSampleMask);
+        }
+
+        const auto lpDepthStencil = lCreateInfo.pDepthStencilState;
+        lHasher.Add(lpDepthStencil != nullptr);
+
+        if (lpDepthStencil != nullptr)
+        {
+            lHasher.Add(lpDepthStencil->flags).Add(lpDepthStencil->depthTestEnable).Add(lpDepthStencil->depthWriteEnable)
+                .Add(lpDepthStencil->depthCompareOp).Add(lpDepthStencil->depthBoundsTestEnable).Add(lpDepthStencil->stencilTestEnable)
+                .Add(lpDepthStencil->front).Add(lpDepthStencil->back).Add(lpDepthStencil->minDepthBounds).Add(lpDepthStencil->maxDepthBounds);
+        }
+
+        const auto lpColorBlend = lCreateInfo.pColorBlendState;
+        lHasher.Add(lpColorBlend != nullptr);
+
+        if (lpColorBlend != nullptr)
+        {
+            lHasher.Add(lpColorBlend->flags).Add(lpColorBlend->logicOpEnable).Add(lpColorBlend->logicOp)
+                .AddArray(lpColorBlend->attachmentCount, lpColorBlend->pAttachments).Add(lpColorBlend->blendConstants);
+        }
+
+        const auto lpDynamic = lCreateInfo.pDynamicState;
+        lHasher.Add(lpDynamic != nullptr);
+
+        if (lpDynamic != nullptr)
+            lHasher.Add(lpDynamic->flags).AddArray(lpDynamic->dynamicStateCount, lpDynamic->pDynamicStates);
+
+        lHasher.Add(lCreateInfo.layout).Add(lCreateInfo.renderPass).Add(lCreateInfo.subpass)
+            .Add(lCreateInfo.basePipelineHandle).Add(lCreateInfo.basePipelineIndex);
+
+        return lHasher.Get();
+    }
+
+    // The registry keeps ownership of the returned pipeline.
+    Pipeline GetPipeline(const GraphicsPipelineCreateInfo& aGraphicsPipelineCreateInfo)
+    {
+        if (HasExtensions(*&aGraphicsPipelineCreateInfo))
+        {
+            ++mMissCount;
+
+            return mUnhashedPipelines.emplace_back(mLogicalDevice.CreateGraphicsPipeline(aGraphicsPipelineCreateInfo, mPipelineCache));
+        }
+
+        mKey.clear();
+
+        const auto lHash = Hash(aGraphicsPipelineCreateInfo, &mKey);
+
+        if (const auto lpPipeline = mPipelines.Find(lHash, mKey))
+        {
+            ++mHitCount;
+
+            return *lpPipeline;
+        }
+
+        ++mMissCount;
+
+        return mPipelines.Insert(lHash, mKey, mLogicalDevice.CreateGraphicsPipeline(aGraphicsPipelineCreateInfo, mPipelineCache));
+    }
+
+    // Destroy every pipeline; none of them may still be in use by the device.
+    void Clear(void)
+    {
+        mPipelines.ForEach([this](const Pipeline& aPipeline)
+        {
+            mLogicalDevice.DestroyPipeline(aPipeline);
+        });
+
+        for (const auto& lPipeline : mUnhashedPipelines)
+            mLogicalDevice.DestroyPipeline(lPipeline);
+
+        mPipelines.Clear();
+        mUnhashedPipelines.clear();
+    }
+
+    std::size_t GetSize(void) const noexcept
+    {
+        return mPipelines.GetSize() + mUnhashedPipelines.size();
+    }
+
+    uint32_t GetHitCount(void) const noexcept
+    {
+        return mHitCount;
+    }
+
+    uint32_t GetMissCount(void) const noexcept
+    {
+        return mMissCount;
+    }
+};
+
+
+
+}                   // End of namespace vkpp.
+
+
+
+#endif              // __VKPP_TYPE_PIPELINE_REGISTRY_H__
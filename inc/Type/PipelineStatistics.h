@@ -0,0 +1,250 @@
+#ifndef __VKPP_TYPE_PIPELINE_STATISTICS_H__
+#define __VKPP_TYPE_PIPELINE_STATISTICS_H__
+
+
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include <Info/Common.h>
+
+#include <Type/LogicalDevice.h>
+#include <Type/CommandBuffer.h>
+#include <Type/QueryPool.h>
+#include <Type/FrameQueryRing.h>
+
+
+
+namespace vkpp
+{
+
+
+
+/**
+ * \class PipelineStatisticsProfiler
+ *
+ * \brief Attributes pipeline statistics counters and occlusion samples to named draw or dispatch batches.
+ *
+ * Works like GPUProfiler, on the same internal::FrameQueryRing: every frame in flight owns a slice of the query pools, BeginFrame records its reset, and Resolve reads it
+ * back without waiting once the frame's fence has signaled. Batches sharing a name within a frame are summed.
+ * Pipeline statistics need PhysicalDeviceFeatures::pipelineStatisticsQuery; counting samples exactly needs occlusionQueryPrecise,
+ * otherwise an occlusion query only tells zero from non-zero. Batches may not nest, and a batch begun inside a render pass
+ * must end in the same subpass.
+ */
+class PipelineStatisticsProfiler
+{
+public:
+    struct BatchStatistics
+    {
+        std::string name;
+        std::vector<uint64_t> counters;         // One per enabled statistic, in ascending bit order.
+        uint64_t samplesPassed{ 0 };
+        uint32_t batchCount{ 0 };               // Batches of that name summed into the values above.
+    };
+
+    // Attribute the commands recorded during its lifetime to a batch.
+    class Scope
+    {
+    private:
+        PipelineStatisticsProfiler& mProfiler;
+        const CommandBuffer& mCommandBuffer;
+        const uint32_t mFrame;
+        const uint32_t mBatch;
+
+    public:
+        Scope(PipelineStatisticsProfiler& aProfiler, const CommandBuffer& aCommandBuffer, uint32_t aFrame, const std::string& aName)
+            : mProfiler(aProfiler), mCommandBuffer(aCommandBuffer), mFrame(aFrame), mBatch(aProfiler.BeginBatch(aCommandBuffer, aFrame, aName))
+        {}
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+        ~Scope(void)
+        {
+            mProfiler.EndBatch(mCommandBuffer, mFrame, mBatch);
+        }
+    };
+
+    constexpr static uint32_t InvalidBatch = internal::FrameQueryRing<BatchStatistics>::InvalidSlot;
+
+private:
+    const LogicalDevice& mLogicalDevice;
+    const QueryPipelineStatisticFlags mStatistics;
+    const uint32_t mCounterCount;
+    const OcclusionQuery mOcclusionQuery;
+    const QueryControlFlags mOcclusionFlags;
+
+    // Every batch takes one query of each pool.
+    internal::FrameQueryRing<BatchStatistics> mQueryRing;
+    QueryPool mStatisticsPool;
+    QueryPool mOcclusionPool;
+
+    std::vector<uint64_t> mStatisticsResults;
+    std::vector<uint64_t> mOcclusionResults;
+
+    static uint32_t CountBits(VkFlags aMask) noexcept
+    {
+        uint32_t lCount{ 0 };
+
+        for (; aMask != 0; aMask &= aMask - 1)
+            ++lCount;
+
+        return lCount;
+    }
+
+    static BatchStatistics MakePrototype(uint32_t aCounterCount)
+    {
+        BatchStatistics lBatch;
+        lBatch.counters.resize(aCounterCount, 0);
+
+        return lBatch;
+    }
+
+public:
+    // aFrameCount is the number of frames in flight. Either kind of query may be left out: pass no statistic flags or OcclusionQuery::Disable.
+    PipelineStatisticsProfiler(const LogicalDevice& aLogicalDevice, const QueryPipelineStatisticFlags& aStatistics, OcclusionQuery aOcclusionQuery,
+        uint32_t aFrameCount, const QueryControlFlags& aOcclusionFlags = DefaultFlags, uint32_t aMaxBatchCount = 32)
+        : mLogicalDevice(aLogicalDevice), mStatistics(aStatistics), mCounterCount(CountBits(aStatistics)), mOcclusionQuery(aOcclusionQuery),
+          mOcclusionFlags(aOcclusionFlags), mQueryRing(aLogicalDevice, aFrameCount, aMaxBatchCount, 1, MakePrototype(mCounterCount))
+    {
+        if (mCounterCount != 0)
+        {
+            mStatisticsPool = mQueryRing.CreateQueryPool(QueryType::ePipelineStatistics, mStatistics);
+            mStatisticsResults.resize(aMaxBatchCount * mCounterCount);
+        }
+
+        if (mOcclusionQuery == OcclusionQuery::Enable)
+        {
+            mOcclusionPool = mQueryRing.CreateQueryPool(QueryType::eOcclusion);
+            mOcclusionResults.resize(aMaxBatchCount);
+        }
+    }
+
+    PipelineStatisticsProfiler(const PipelineStatisticsProfiler&) = delete;
+    PipelineStatisticsProfiler& operator=(const PipelineStatisticsProfiler&) = delete;
+
+    // Let the secondary command buffers executed within a batch contribute to it; inheriting occlusion queries needs the inheritedQueries feature.
+    CommandBufferInheritanceInfo& Inherit(CommandBufferInheritanceInfo& aInheritanceInfo) const noexcept
+    {
+        if (mOcclusionQuery == OcclusionQuery::Enable)
+            aInheritanceInfo.EnableOcclusionQuery().SetQueryFlags(mOcclusionFlags);
+
+        return aInheritanceInfo.SetPipelineStatistics(mStatistics);
+    }
+
+    // Record, outside of a render pass and before any batch of aFrame, the reset of its queries; the batches recorded earlier into aFrame are dropped.
+    void BeginFrame(const CommandBuffer& aCommandBuffer, uint32_t aFrame)
+    {
+        mQueryRing.BeginFrame(aCommandBuffer, aFrame);
+    }
+
+    // Return InvalidBatch, and count nothing, once aFrame already holds the maximum number of batches.
+    uint32_t BeginBatch(const CommandBuffer& aCommandBuffer, uint32_t aFrame, const std::string& aName)
+    {
+        const auto lBatch = mQueryRing.AcquireSlot(aFrame, aName);
+
+        if (lBatch == InvalidBatch)
+            return InvalidBatch;
+
+        const auto lQuery = mQueryRing.GetFirstQuery(aFrame, lBatch);
+
+        if (mCounterCount != 0)
+            aCommandBuffer.BeginQuery(mStatisticsPool, lQuery);
+
+        if (mOcclusionQuery == OcclusionQuery::Enable)
+            aCommandBuffer.BeginQuery(mOcclusionPool, lQuery, mOcclusionFlags);
+
+        return lBatch;
+    }
+
+    void EndBatch(const CommandBuffer& aCommandBuffer, uint32_t aFrame, uint32_t aBatch) const
+    {
+        if (aBatch == InvalidBatch)
+            return;
+
+        assert(aBatch < mQueryRing.GetFrameSlots(aFrame).size());
+
+        const auto lQuery = mQueryRing.GetFirstQuery(aFrame, aBatch);
+
+        if (mOcclusionQuery == OcclusionQuery::Enable)
+            aCommandBuffer.EndQuery(mOcclusionPool, lQuery);
+
+        if (mCounterCount != 0)
+            aCommandBuffer.EndQuery(mStatisticsPool, lQuery);
+    }
+
+    // Call once the submission of aFrame has completed, e.g. after waiting on its fence. Return false, without waiting, if its results are not available.
+    bool Resolve(uint32_t aFrame)
+    {
+        const auto& lBatches = mQueryRing.GetFrameSlots(aFrame);
+
+        if (lBatches.empty())
+            return false;
+
+        const auto lQueryCount = static_cast<uint32_t>(lBatches.size());
+
+        if (mCounterCount != 0 && mLogicalDevice.GetQueryPoolResults(mStatisticsPool, mQueryRing.GetFirstQuery(aFrame), lQueryCount,
+            lQueryCount * mCounterCount * sizeof(uint64_t), mStatisticsResults.data(), mCounterCount * sizeof(uint64_t), QueryResultFlagBits::e64) == VK_NOT_READY)
+            return false;
+
+        if (mOcclusionQuery == OcclusionQuery::Enable && mLogicalDevice.GetQueryPoolResults(mOcclusionPool, mQueryRing.GetFirstQuery(aFrame), lQueryCount,
+            lQueryCount * sizeof(uint64_t), mOcclusionResults.data(), sizeof(uint64_t), QueryResultFlagBits::e64) == VK_NOT_READY)
+            return false;
+
+        // Only the batches recorded into this frame are replaced; the others keep the values of the last frame that recorded them.
+        for (auto lBatchIndex : lBatches)
+        {
+            auto& lBatch = mQueryRing.GetEntry(lBatchIndex);
+
+            std::fill(lBatch.counters.begin(), lBatch.counters.end(), 0);
+            lBatch.samplesPassed = 0;
+            lBatch.batchCount = 0;
+        }
+
+        for (uint32_t lQuery = 0; lQuery < lQueryCount; ++lQuery)
+        {
+            auto& lBatch = mQueryRing.GetEntry(lBatches[lQuery]);
+
+            for (uint32_t lCounter = 0; lCounter < mCounterCount; ++lCounter)
+                lBatch.counters[lCounter] += mStatisticsResults[lQuery * mCounterCount + lCounter];
+
+            if (mOcclusionQuery == OcclusionQuery::Enable)
+                lBatch.samplesPassed += mOcclusionResults[lQuery];
+
+            ++lBatch.batchCount;
+        }
+
+        return true;
+    }
+
+    // aStatistic has to be one of the statistics the profiler was created with.
+    uint64_t GetCounter(const BatchStatistics& aBatch, QueryPipelineStatisticFlagBits aStatistic) const noexcept
+    {
+        const auto lBit = static_cast<VkFlags>(aStatistic);
+
+        assert((static_cast<VkFlags>(mStatistics) & lBit) != 0);
+
+        return aBatch.counters[CountBits(static_cast<VkFlags>(mStatistics) & (lBit - 1))];
+    }
+
+    // Batches in the order their names were first seen.
+    const std::vector<BatchStatistics>& GetBatches(void) const noexcept
+    {
+        return mQueryRing.GetEntries();
+    }
+
+    // Return nullptr if no batch of that name has been recorded yet.
+    const BatchStatistics* GetBatch(const std::string& aName) const
+    {
+        return mQueryRing.FindEntry(aName);
+    }
+};
+
+
+
+}                   // End of namespace vkpp.
+
+
+
+#endif              // __VKPP_TYPE_PIPELINE_STATISTICS_H__
@@ -0,0 +1,147 @@
+#ifndef __VKPP_TYPE_QUERY_POOL_H__
+#define __VKPP_TYPE_QUERY_POOL_H__
+
+
+
+#include <Info/Common.h>
+#include <Info/Flags.h>
+
+
+
+namespace vkpp
+{
+
+
+
+enum class QueryType
+{
+    eOcclusion              = VK_QUERY_TYPE_OCCLUSION,
+    ePipelineStatistics     = VK_QUERY_TYPE_PIPELINE_STATISTICS,
+    eTimestamp              = VK_QUERY_TYPE_TIMESTAMP
+};
+
+
+
+enum class QueryPoolCreateFlagBits
+{};
+
+VKPP_ENUM_BIT_MASK_FLAGS(QueryPoolCreate)
+
+
+
+enum class QueryControlFlagBits
+{
+    ePrecise        = VK_QUERY_CONTROL_PRECISE_BIT
+};
+
+VKPP_ENUM_BIT_MASK_FLAGS(QueryControl)
+
+
+
+enum class QueryPipelineStatisticFlagBits
+{
+    eInputAssemblyVertices                      = VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_VERTICES_BIT,
+    eInputAssemblyPrimitives                    = VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_PRIMITIVES_BIT,
+    eVertexShaderInvocations                    = VK_QUERY_PIPELINE_STATISTIC_VERTEX_SHADER_INVOCATIONS_BIT,
+    eGeometryShaderInvocations                  = VK_QUERY_PIPELINE_STATISTIC_GEOMETRY_SHADER_INVOCATIONS_BIT,
+    eGeometryShaderPrimitives                   = VK_QUERY_PIPELINE_STATISTIC_GEOMETRY_SHADER_PRIMITIVES_BIT,
+    eClippingInvocations                        = VK_QUERY_PIPELINE_STATISTIC_CLIPPING_INVOCATIONS_BIT,
+    eClippingPrimitives                         = VK_QUERY_PIPELINE_STATISTIC_CLIPPING_PRIMITIVES_BIT,
+    eFragmentShaderInvocations                  = VK_QUERY_PIPELINE_STATISTIC_FRAGMENT_SHADER_INVOCATIONS_BIT,
+    eTessellationControlShaderPatches           = VK_QUERY_PIPELINE_STATISTIC_TESSELLATION_CONTROL_SHADER_PATCHES_BIT,
+    eTessellationEvaluationShaderInvocations    = VK_QUERY_PIPELINE_STATISTIC_TESSELLATION_EVALUATION_SHADER_INVOCATIONS_BIT,
+    eComputeShaderInvocations                   = VK_QUERY_PIPELINE_STATISTIC_COMPUTE_SHADER_INVOCATIONS_BIT
+};
+
+VKPP_ENUM_BIT_MASK_FLAGS(QueryPipelineStatistic)
+
+
+
+enum class QueryResultFlagBits
+{
+    e64                 = VK_QUERY_RESULT_64_BIT,
+    eWait               = VK_QUERY_RESULT_WAIT_BIT,
+    eWithAvailability   = VK_QUERY_RESULT_WITH_AVAILABILITY_BIT,
+    ePartial            = VK_QUERY_RESULT_PARTIAL_BIT
+};
+
+VKPP_ENUM_BIT_MASK_FLAGS(QueryResult)
+
+
+
+class QueryPoolCreateInfo : public internal::VkTrait<QueryPoolCreateInfo, VkQueryPoolCreateInfo>
+{
+private:
+    const internal::Structure sType = internal::Structure::eQueryPool;
+
+public:
+    const void*                 pNext{ nullptr };
+    QueryPoolCreateFlags        flags;
+    QueryType                   queryType{ QueryType::eTimestamp };
+    uint32_t                    queryCount{ 0 };
+    QueryPipelineStatisticFlags pipelineStatistics;
+
+    DEFINE_CLASS_MEMBER(QueryPoolCreateInfo)
+
+    constexpr QueryPoolCreateInfo(QueryType aQueryType, uint32_t aQueryCount, const QueryPipelineStatisticFlags& aPipelineStatistics = DefaultFlags) noexcept
+        : queryType(aQueryType), queryCount(aQueryCount), pipelineStatistics(aPipelineStatistics)
+    {}
+
+    QueryPoolCreateInfo& SetNext(const void* apNext) noexcept
+    {
+        pNext = apNext;
+
+        return *this;
+    }
+
+    QueryPoolCreateInfo& SetType(QueryType aQueryType) noexcept
+    {
+        queryType = aQueryType;
+
+        return *this;
+    }
+
+    QueryPoolCreateInfo& SetCount(uint32_t aQueryCount) noexcept
+    {
+        queryCount = aQueryCount;
+
+        return *this;
+    }
+
+    // Only used by QueryType::ePipelineStatistics pools.
+    QueryPoolCreateInfo& SetPipelineStatistics(const QueryPipelineStatisticFlags& aPipelineStatistics) noexcept
+    {
+        pipelineStatistics = aPipelineStatistics;
+
+        return *this;
+    }
+};
+
+ConsistencyCheck(QueryPoolCreateInfo, pNext, flags, queryType, queryCount, pipelineStatistics)
+
+
+
+class QueryPool : public internal::VkTrait<QueryPool, VkQueryPool>
+{
+private:
+    VkQueryPool mQueryPool{ VK_NULL_HANDLE };
+
+public:
+    QueryPool(void) noexcept = default;
+
+    QueryPool(std::nullptr_t) noexcept
+    {}
+
+    explicit QueryPool(VkQueryPool aQueryPool) noexcept : mQueryPool(aQueryPool)
+    {}
+};
+
+StaticSizeCheck(QueryPool)
+
+
+
+}                   // End of namespace vkpp.
+
+
+
+#endif              // __VKPP_TYPE_QUERY_POOL_H__
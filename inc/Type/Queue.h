@@ -8,6 +8,7 @@
 #include <Info/Common.h>
 #include <Info/PipelineStage.h>
 
+#include <Type/DispatchTable.h>
 #include <Type/Fence.h>
 #include <Type/Semaphore.h>
 #include <Type/CommandBuffer.h>
@@ -235,7 +236,7 @@ public:
 
     VkResult Wait(void) const
     {
-        return vkQueueWaitIdle(mQueue);
+        return VKPP_DEVICE_PROC(vkQueueWaitIdle)(mQueue);
     }
 
     void Submit(const SubmitInfo& aSubmit) const
@@ -252,14 +253,14 @@ public:
     {
         assert(aSubmitCount != 0 && apSubmits != nullptr);
 
-        ThrowIfFailed(vkQueueSubmit(mQueue, aSubmitCount, &apSubmits[0], VK_NULL_HANDLE));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkQueueSubmit)(mQueue, aSubmitCount, &apSubmits[0], VK_NULL_HANDLE));
     }
 
     void Submit(uint32_t aSubmitCount, const SubmitInfo* apSubmits, const Fence& aFence) const
     {
         assert(aSubmitCount != 0 && apSubmits != nullptr);
 
-        ThrowIfFailed(vkQueueSubmit(mQueue, aSubmitCount, &apSubmits[0], aFence));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkQueueSubmit)(mQueue, aSubmitCount, &apSubmits[0], aFence));
     }
 
     template <typename T, typename = EnableIfValueType<ValueType<T>, SubmitInfo>>
@@ -275,7 +276,7 @@ public:
 
     void Present(const khr::PresentInfo& aPresentInfo) const
     {
-        ThrowIfFailed(vkQueuePresentKHR(mQueue, &aPresentInfo));
+        ThrowIfFailed(VKPP_DEVICE_PROC(vkQueuePresentKHR)(mQueue, &aPresentInfo));
     }
 };
 
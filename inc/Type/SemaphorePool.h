@@ -0,0 +1,98 @@
+#ifndef __VKPP_TYPE_SEMAPHORE_POOL_H__
+#define __VKPP_TYPE_SEMAPHORE_POOL_H__
+
+
+
+#include <vector>
+
+#include <Info/Common.h>
+
+#include <Type/LogicalDevice.h>
+#include <Type/Semaphore.h>
+
+
+
+namespace vkpp
+{
+
+
+
+/**
+ * \class SemaphorePool
+ *
+ * \brief Recycles binary semaphores instead of creating and destroying them ad hoc.
+ *
+ * A semaphore may be recycled once the wait operation on it has completed, e.g. after the fence of the waiting submission was signaled.
+ * No reset is needed: a completed wait leaves a binary semaphore unsignaled.
+ */
+class SemaphorePool
+{
+private:
+    const LogicalDevice& mLogicalDevice;
+
+    std::vector<Semaphore> mFreeSemaphores;
+
+    uint32_t mCreatedCount{ 0 };
+    uint32_t mReusedCount{ 0 };
+
+public:
+    explicit SemaphorePool(const LogicalDevice& aLogicalDevice) noexcept : mLogicalDevice(aLogicalDevice)
+    {}
+
+    SemaphorePool(const SemaphorePool&) = delete;
+    SemaphorePool& operator=(const SemaphorePool&) = delete;
+
+    ~SemaphorePool(void)
+    {
+        Clear();
+    }
+
+    Semaphore Acquire(void)
+    {
+        if (mFreeSemaphores.empty())
+        {
+            constexpr SemaphoreCreateInfo lSemaphoreCreateInfo;
+
+            ++mCreatedCount;
+            return mLogicalDevice.CreateSemaphore(lSemaphoreCreateInfo);
+        }
+
+        const auto lSemaphore = mFreeSemaphores.back();
+        mFreeSemaphores.pop_back();
+
+        ++mReusedCount;
+        return lSemaphore;
+    }
+
+    void Recycle(const Semaphore& aSemaphore)
+    {
+        mFreeSemaphores.push_back(aSemaphore);
+    }
+
+    // Destroy the pooled semaphores. Semaphores still handed out are left to their owners.
+    void Clear(void)
+    {
+        for (const auto& lSemaphore : mFreeSemaphores)
+            mLogicalDevice.DestroySemaphore(lSemaphore);
+
+        mFreeSemaphores.clear();
+    }
+
+    uint32_t GetCreatedCount(void) const noexcept
+    {
+        return mCreatedCount;
+    }
+
+    uint32_t GetReusedCount(void) const noexcept
+    {
+        return mReusedCount;
+    }
+};
+
+
+
+}                   // End of namespace vkpp.
+
+
+
+#endif              // __VKPP_TYPE_SEMAPHORE_POOL_H__
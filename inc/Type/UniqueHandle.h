@@ -0,0 +1,197 @@
+#ifndef __VKPP_TYPE_UNIQUE_HANDLE_H__
+#define __VKPP_TYPE_UNIQUE_HANDLE_H__
+
+
+
+#include <utility>
+
+#include <Info/Common.h>
+#include <Info/PipelineStage.h>
+
+#include <Type/Semaphore.h>
+#include <Type/Fence.h>
+#include <Type/QueryPool.h>
+#include <Type/Swapchain.h>
+#include <Type/CommandPool.h>
+#include <Type/DescriptorSet.h>
+#include <Type/DescriptorPool.h>
+#include <Type/DescriptorUpdateTemplate.h>
+#include <Type/RenderPass.h>
+#include <Type/Buffer.h>
+#include <Type/Image.h>
+#include <Type/Sampler.h>
+#include <Type/Framebuffer.h>
+#include <Type/ShaderModule.h>
+#include <Type/GraphicsPipeline.h>
+#include <Type/Memory.h>
+
+
+
+namespace vkpp
+{
+
+
+
+class LogicalDevice;
+
+
+
+namespace internal
+{
+
+
+
+// Maps a handle type to the LogicalDevice member that destroys it, at compile time.
+// The owner is a template parameter only so that this header doesn't need the definition of LogicalDevice.
+template <typename T>
+struct HandleDeleter;
+
+
+
+#define VKPP_DEFINE_HANDLE_DELETER(Handle, DestroyFunction) \
+template <> \
+struct HandleDeleter<Handle> \
+{ \
+    template <typename O> \
+    static void Delete(const O& aOwner, const Handle& aHandle) \
+    { \
+        aOwner.DestroyFunction(aHandle); \
+    } \
+};
+
+VKPP_DEFINE_HANDLE_DELETER(Semaphore, DestroySemaphore)
+VKPP_DEFINE_HANDLE_DELETER(Fence, DestroyFence)
+VKPP_DEFINE_HANDLE_DELETER(QueryPool, DestroyQueryPool)
+VKPP_DEFINE_HANDLE_DELETER(khr::Swapchain, DestroySwapchain)
+VKPP_DEFINE_HANDLE_DELETER(CommandPool, DestroyCommandPool)
+VKPP_DEFINE_HANDLE_DELETER(DescriptorSetLayout, DestroyDescriptorSetLayout)
+VKPP_DEFINE_HANDLE_DELETER(DescriptorPool, DestroyDescriptorPool)
+VKPP_DEFINE_HANDLE_DELETER(khr::DescriptorUpdateTemplate, DestroyDescriptorUpdateTemplate)
+VKPP_DEFINE_HANDLE_DELETER(RenderPass, DestroyRenderPass)
+VKPP_DEFINE_HANDLE_DELETER(Buffer, DestroyBuffer)
+VKPP_DEFINE_HANDLE_DELETER(BufferView, DestroyBufferView)
+VKPP_DEFINE_HANDLE_DELETER(Image, DestroyImage)
+VKPP_DEFINE_HANDLE_DELETER(ImageView, DestroyImageView)
+VKPP_DEFINE_HANDLE_DELETER(Sampler, DestroySampler)
+VKPP_DEFINE_HANDLE_DELETER(Framebuffer, DestroyFramebuffer)
+VKPP_DEFINE_HANDLE_DELETER(ShaderModule, DestroyShaderModule)
+VKPP_DEFINE_HANDLE_DELETER(PipelineLayout, DestroyPipelineLayout)
+VKPP_DEFINE_HANDLE_DELETER(Pipeline, DestroyPipeline)
+VKPP_DEFINE_HANDLE_DELETER(PipelineCache, DestroyPipelineCache)
+VKPP_DEFINE_HANDLE_DELETER(DeviceMemory, FreeMemory)
+
+#undef VKPP_DEFINE_HANDLE_DELETER
+
+
+
+}                   // End of namespace internal.
+
+
+
+/**
+ * \class UniqueHandle
+ *
+ * \brief Move-only owner of a handle, which destroys it through its owner when going out of scope.
+ *
+ * The deleter is picked by the handle type at compile time, so a UniqueHandle is just the handle and a copy of the owner's handle:
+ * nothing is allocated and destroying costs the same as calling LogicalDevice::Destroy* by hand. The object is destroyed with the default
+ * allocator. The owner must outlive the handle; the owner is held by value, so unlike a reference it can't dangle into a moved-from wrapper.
+ */
+template <typename T, typename Owner = LogicalDevice>
+class UniqueHandle
+{
+private:
+    T mHandle;
+    Owner mOwner;
+
+    bool IsValid(void) const noexcept
+    {
+        return static_cast<const typename T::VkType&>(mHandle) != VK_NULL_HANDLE;
+    }
+
+public:
+    UniqueHandle(void) noexcept = default;
+
+    UniqueHandle(std::nullptr_t) noexcept
+    {}
+
+    UniqueHandle(const Owner& aOwner, const T& aHandle) noexcept : mHandle(aHandle), mOwner(aOwner)
+    {}
+
+    UniqueHandle(const UniqueHandle&) = delete;
+    UniqueHandle& operator=(const UniqueHandle&) = delete;
+
+    UniqueHandle(UniqueHandle&& aRhs) noexcept : mHandle(aRhs.mHandle), mOwner(aRhs.mOwner)
+    {
+        aRhs.mHandle = nullptr;
+    }
+
+    UniqueHandle& operator=(UniqueHandle&& aRhs) noexcept
+    {
+        if (this != &aRhs)
+        {
+            Reset(aRhs.mHandle);
+            mOwner = aRhs.mOwner;
+
+            aRhs.mHandle = nullptr;
+        }
+
+        return *this;
+    }
+
+    ~UniqueHandle(void)
+    {
+        Reset();
+    }
+
+    // Destroy the owned handle, if any, and take aHandle from the same owner.
+    void Reset(const T& aHandle = nullptr) noexcept
+    {
+        if (IsValid())
+            internal::HandleDeleter<T>::Delete(mOwner, mHandle);
+
+        mHandle = aHandle;
+    }
+
+    // Give up ownership without destroying the handle.
+    T Release(void) noexcept
+    {
+        const auto lHandle = mHandle;
+        mHandle = nullptr;
+
+        return lHandle;
+    }
+
+    const T& Get(void) const noexcept
+    {
+        return mHandle;
+    }
+
+    const Owner& GetOwner(void) const noexcept
+    {
+        return mOwner;
+    }
+
+    const T* operator->(void) const noexcept
+    {
+        return &mHandle;
+    }
+
+    operator const T&(void) const noexcept
+    {
+        return mHandle;
+    }
+
+    explicit operator bool(void) const noexcept
+    {
+        return IsValid();
+    }
+};
+
+
+
+}                   // End of namespace vkpp.
+
+
+
+#endif              // __VKPP_TYPE_UNIQUE_HANDLE_H__